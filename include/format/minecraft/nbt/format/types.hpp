@@ -35,7 +35,7 @@ struct NBTType {
   ~NBTType() {
     // Delete allocated components
     if (name != nullptr)
-      delete name;
+      delete[] name;
   }
 
   inline const char *getName() { return name; }
@@ -0,0 +1,81 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Entrypoint of the NBT benchmarks suite.
+//
+// Usage: bench_nbt [--filter <substr>] [--feed <contiguous|1|7|4096>]
+//                  [--min-time <seconds>] [--json <file|->]
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <optional>
+
+using namespace minecraft::nbt::bench;
+
+int main(int argc, char **argv) {
+  // Parse arguments
+  std::string filter;
+  std::optional<FeedStep> only_feed;
+  double min_time = 0.2;
+  const char *json_path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (!std::strcmp(argv[i], "--filter") && has_value)
+      filter = argv[++i];
+    else if (!std::strcmp(argv[i], "--feed") && has_value) {
+      ++i;
+      only_feed = std::strcmp(argv[i], "contiguous")
+                      ? std::strtoul(argv[i], nullptr, 10)
+                      : CONTIGUOUS;
+    } else if (!std::strcmp(argv[i], "--min-time") && has_value)
+      min_time = std::strtod(argv[++i], nullptr);
+    else if (!std::strcmp(argv[i], "--json") && has_value)
+      json_path = argv[++i];
+    else {
+      std::fprintf(stderr,
+                   "Usage: %s [--filter <substr>] [--feed <contiguous|N>] "
+                   "[--min-time <seconds>] [--json <file|->]\n",
+                   argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Run the selected benchmarks
+  std::vector<FeedStep> steps{std::begin(FEED_STEPS), std::end(FEED_STEPS)};
+  if (only_feed)
+    steps = {*only_feed};
+  std::vector<Result> results;
+  for (const auto &bench : make_benchmarks()) {
+    if (!filter.empty() && bench.name.find(filter) == std::string::npos)
+      continue;
+    for (auto step : bench.feedable ? steps : std::vector{CONTIGUOUS}) {
+      results.push_back(run(bench, step, min_time));
+      std::fprintf(stderr, "Done %s (%s)\n", bench.name.c_str(),
+                   feed_name(step).c_str());
+    }
+  }
+
+  // Report
+  write_table(stdout, results);
+  if (json_path != nullptr) {
+    const bool to_stdout = !std::strcmp(json_path, "-");
+    std::FILE *out = to_stdout ? stdout : std::fopen(json_path, "w");
+    if (out == nullptr) {
+      std::fprintf(stderr, "Can't open %s\n", json_path);
+      return EXIT_FAILURE;
+    }
+    write_json(out, results);
+    if (!to_stdout)
+      std::fclose(out);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Minimal benchmarking harness for the NBT parsers
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include <chrono>
+
+namespace minecraft::nbt::bench {
+
+// ============================================================================
+Result run(const Benchmark &bench, FeedStep step, double min_time) {
+  using Clock = std::chrono::steady_clock;
+
+  // Warm-up (caches, allocator, lazy initialization)
+  bench.run(step);
+
+  // Run until the minimal time is reached
+  std::size_t iterations = 0;
+  uint64_t total_cycles = 0;
+  const auto start = Clock::now();
+  std::chrono::duration<double> elapsed{0};
+  do {
+    const auto c0 = cycles();
+    bench.run(step);
+    total_cycles += cycles() - c0;
+    iterations++;
+    elapsed = Clock::now() - start;
+  } while (elapsed.count() < min_time);
+
+  // Compute metrics
+  const double ns_per_iter = elapsed.count() * 1e9 / iterations;
+  return Result{
+      .name = bench.name,
+      .parser = bench.parser,
+      .feed = step,
+      .bytes = bench.bytes,
+      .values = bench.values,
+      .iterations = iterations,
+      .ns_per_iter = ns_per_iter,
+      .mb_per_s = bench.bytes * 1e3 / ns_per_iter,
+      .ns_per_value = ns_per_iter / bench.values,
+      .cycles_per_value =
+          static_cast<double>(total_cycles) / iterations / bench.values,
+  };
+}
+
+// ============================================================================
+void write_json(std::FILE *out, const std::vector<Result> &results) {
+  std::fprintf(out, "{\n  \"suite\": \"bench_nbt\",\n");
+  std::fprintf(out, "  \"results\": [");
+  for (std::size_t i = 0; i < results.size(); i++) {
+    const auto &r = results[i];
+    std::fprintf(out,
+                 "%s\n    {\"name\": \"%s\", \"parser\": \"%s\", "
+                 "\"feed\": \"%s\", \"bytes\": %zu, \"values\": %zu, "
+                 "\"iterations\": %zu, \"ns_per_iter\": %.1f, "
+                 "\"mb_per_s\": %.2f, \"ns_per_value\": %.3f, "
+                 "\"cycles_per_value\": %.2f}",
+                 i == 0 ? "" : ",", r.name.c_str(), r.parser.c_str(),
+                 feed_name(r.feed).c_str(), r.bytes, r.values, r.iterations,
+                 r.ns_per_iter, r.mb_per_s, r.ns_per_value,
+                 r.cycles_per_value);
+  }
+  std::fprintf(out, "\n  ]\n}\n");
+}
+
+// ============================================================================
+void write_table(std::FILE *out, const std::vector<Result> &results) {
+  std::fprintf(out, "%-28s %-34s %-10s %12s %12s %12s\n", "Benchmark",
+               "Parser", "Feed", "MB/s", "ns/value", "cycles/value");
+  for (const auto &r : results)
+    std::fprintf(out, "%-28s %-34s %-10s %12.2f %12.3f %12.2f\n",
+                 r.name.c_str(), r.parser.c_str(), feed_name(r.feed).c_str(),
+                 r.mb_per_s, r.ns_per_value, r.cycles_per_value);
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,226 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Minimal benchmarking harness for the NBT parsers
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_BENCH_HPP
+#define SOLISMC_NBT_BENCH_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace minecraft::nbt::bench {
+
+// ============================================================================
+// Inputs feeding
+// ============================================================================
+
+/**
+ * @brief How the input buffer is handed to the parser:
+ *  - 0 means the whole buffer at once (contiguous)
+ *  - any other value is the size of the slices given to the parser
+ */
+using FeedStep = std::size_t;
+constexpr FeedStep CONTIGUOUS{0};
+constexpr FeedStep FEED_STEPS[]{CONTIGUOUS, 1, 7, 4096};
+
+/**
+ * @brief Get a printable name of the feeding step
+ */
+inline std::string feed_name(FeedStep step) {
+  return step == CONTIGUOUS ? "contiguous" : std::to_string(step);
+}
+
+/**
+ * @brief Prevent the compiler from optimizing out the computation of value
+ */
+template <typename T> inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r"(&value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+/**
+ * @brief Feed the whole buffer to the parser, slice by slice.
+ *
+ * @return the number of values the parser successfully parsed
+ */
+template <typename P>
+std::size_t feed(P &parser, const std::vector<StreamChar> &input,
+                 FeedStep step) {
+  std::size_t n_values = 0;
+  const StreamChar *strm = input.data();
+  std::size_t left = input.size();
+  while (left > 0) {
+    unsigned long N = step == CONTIGUOUS ? left : std::min(step, left);
+    left -= N;
+    while (N > 0) {
+      switch (parser.parse(strm, N)) {
+      case ParseResult::SUCCESS:
+        n_values++;
+        do_not_optimize(parser.get());
+        break;
+      case ParseResult::UNFINISHED:
+        break;
+      case ParseResult::FAILED:
+        std::fprintf(stderr, "Parser failed on benchmark input\n");
+        return n_values;
+      }
+    }
+  }
+  return n_values;
+}
+
+// ============================================================================
+// Benchmarks description
+// ============================================================================
+
+/**
+ * @brief A benchmark case: parsing one input with one parser
+ */
+struct Benchmark {
+  std::string name;     // Name of the benchmark (e.g. "int32")
+  std::string parser;   // Parser specialization under test
+  std::size_t bytes;    // Size of the input
+  std::size_t values;   // Number of NBT values in the input
+  bool feedable = true; // Whether the input can be fed by slices
+
+  // Parse the whole input once with the given feeding
+  std::function<void(FeedStep)> run;
+};
+
+/**
+ * @brief Measures of a benchmark case
+ */
+struct Result {
+  std::string name;
+  std::string parser;
+  FeedStep feed;
+  std::size_t bytes;
+  std::size_t values;
+  std::size_t iterations;
+  double ns_per_iter;
+  double mb_per_s;
+  double ns_per_value;
+  double cycles_per_value; // 0 when no cycle counter is available
+};
+
+/**
+ * @brief Register all the benchmarks of the suite
+ */
+std::vector<Benchmark> make_benchmarks();
+
+/**
+ * @brief Register the benchmarks of the files loading
+ */
+void add_loader_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the structural diff
+ */
+void add_diff_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the content hashing
+ */
+void add_hash_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the compressed chunk tier
+ */
+void add_tier_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the saving of regions
+ */
+void add_save_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the event-based parsing
+ */
+void add_sax_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the pull parsing
+ */
+void add_cursor_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the chunk compressions
+ */
+void add_compression_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the one-shot inflate against zlib
+ */
+void add_inflate_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the snapshots against parsing
+ */
+void add_snapshot_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the validation
+ */
+void add_validate_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the MUTF-8 conversions
+ */
+void add_mutf8_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Register the benchmarks of the compound lookups
+ */
+void add_compound_benchmarks(std::vector<Benchmark> &benchmarks);
+
+/**
+ * @brief Run the benchmark with the given feeding for at least min_time
+ * seconds
+ */
+Result run(const Benchmark &bench, FeedStep step, double min_time);
+
+/**
+ * @brief Write the results as a JSON document
+ */
+void write_json(std::FILE *out, const std::vector<Result> &results);
+
+/**
+ * @brief Write the results as a human-readable table
+ */
+void write_table(std::FILE *out, const std::vector<Result> &results);
+
+/**
+ * @brief Read the CPU cycle counter (0 when unavailable)
+ */
+inline uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+} // namespace minecraft::nbt::bench
+
+#endif
@@ -0,0 +1,91 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the compound lookups on the trees of the corpora: the fields
+// read by entity ticking, and every name of every compound
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+/**
+ * @brief Collect the compounds of a tree
+ */
+static void collect(const Tag &tag, std::vector<const Compound *> &out) {
+  if (const auto *list = tag.as_ptr<List>())
+    for (const auto &elem : *list)
+      collect(elem, out);
+  if (const auto *compound = tag.as_ptr<Compound>()) {
+    out.push_back(compound);
+    for (const auto &[name, value] : *compound)
+      collect(value, out);
+  }
+}
+
+void add_compound_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    const auto bytes = load_file(corpus.path);
+    if (bytes.size() != corpus.n_bytes)
+      continue;
+
+    // The tree is shared by the benchmarks, with its compounds
+    auto tree = std::make_shared<Tag>();
+    {
+      BytesParser<Tag> parser;
+      const StreamChar *strm = bytes.data();
+      unsigned long N = bytes.size();
+      parser.parse(strm, N);
+      *tree = parser.take();
+    }
+    std::vector<const Compound *> compounds;
+    collect(*tree, compounds);
+    auto entities = std::make_shared<std::vector<const Compound *>>();
+    std::size_t n_names = 0;
+    for (const auto *compound : compounds) {
+      if (compound->contains("Pos"))
+        entities->push_back(compound);
+      n_names += compound->size();
+    }
+    auto all = std::make_shared<std::vector<const Compound *>>(
+        std::move(compounds));
+
+    const auto make = [&](std::string parser, std::size_t values,
+                          std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "compound_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = bytes.size(),
+          .values = values,
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+    if (!entities->empty())
+      make("find Pos, Motion & Health", 3 * entities->size(),
+           [tree, entities]() {
+             for (const auto *entity : *entities)
+               for (const auto *name : {"Pos", "Motion", "Health"})
+                 do_not_optimize(entity->find(name) != entity->end());
+           });
+    make("find every name", n_names, [tree, all]() {
+      for (const auto *compound : *all)
+        for (const auto &[name, value] : *compound)
+          do_not_optimize(compound->find(name) != compound->end());
+    });
+  }
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,56 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the reading of a region depending on its chunk compression
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "minecraft/nbt/region.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <filesystem>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_compression_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind != "region")
+      continue;
+    const std::pair<const char *, ChunkCompression> compressions[]{
+        {"gzip", ChunkCompression::GZIP},
+        {"zlib", ChunkCompression::ZLIB},
+        {"none", ChunkCompression::NONE},
+        {"lz4", ChunkCompression::LZ4},
+    };
+    for (const auto &[name, compression] : compressions) {
+      const auto target = std::filesystem::temp_directory_path() /
+                          ("solismc_bench_" + std::string{corpus.name} + "_" +
+                           name + ".mca");
+      if (!transcode_region(std::string{corpus.path}, target, compression))
+        continue;
+
+      // Every chunk read, decompressed & parsed
+      benchmarks.push_back(Benchmark{
+          .name = "compression_" + std::string{corpus.name},
+          .parser = std::string{name} + ": read + decompress + parse",
+          .bytes = corpus.n_bytes,
+          .values = corpus.n_tags,
+          .feedable = false,
+          .run = [target](FeedStep) {
+            auto region = RegionFile::open(target);
+            Reader reader;
+            std::vector<StreamChar> buffer;
+            for (std::size_t i = 0; i < REGION_CHUNKS; i++)
+              do_not_optimize(region->parse_chunk(i, reader, buffer));
+          }});
+    }
+  }
+}
+
+} // namespace minecraft::nbt::bench
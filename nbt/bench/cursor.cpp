@@ -0,0 +1,62 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the pull parsing, next to the trees of the same corpora
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/cursor.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_cursor_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    auto bytes = std::make_shared<std::vector<StreamChar>>(
+        load_file(corpus.path));
+    if (bytes->size() != corpus.n_bytes)
+      continue;
+
+    const auto make = [&](std::string parser, std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "corpus_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = bytes->size(),
+          .values = corpus.n_tags,
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+    make("Cursor (all tokens)", [bytes]() {
+      Cursor cursor{*bytes};
+      std::size_t n_tokens = 0;
+      for (const auto &token : cursor)
+        n_tokens += token.kind != TokenKind::END;
+      do_not_optimize(n_tokens);
+    });
+    // A typed loader reading the scalars of the root only
+    make("Cursor (root scalars)", [bytes]() {
+      Cursor cursor{*bytes};
+      int64_t sum = 0;
+      for (const auto &token : cursor) {
+        if (token.kind == TokenKind::BEGIN && cursor.depth() > 1)
+          cursor.skip_value();
+        else if (token.tag == Tags::Int)
+          sum += token.get<int32_t>();
+      }
+      do_not_optimize(sum);
+    });
+  }
+}
+
+} // namespace minecraft::nbt::bench
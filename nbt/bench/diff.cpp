@@ -0,0 +1,92 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the structural diff of two versions of a chunk
+//
+// The new version differs by a few values, as between two saves of a chunk:
+// the diff is compared with parsing both versions and comparing the trees.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/diff.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+/**
+ * @brief Parse a whole document
+ */
+static Tag parse(BytesParser<Tag> &parser,
+                 const std::vector<StreamChar> &bytes) {
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  parser.reset();
+  parser.parse(strm, N);
+  return parser.take();
+}
+
+// ============================================================================
+void add_diff_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind != "chunk")
+      continue;
+    const auto bytes = load_file(corpus.path);
+    if (bytes.size() != corpus.n_bytes)
+      continue;
+
+    // Both versions are serialized by the writer, so that only the edited
+    // values differ
+    struct Versions {
+      std::vector<StreamChar> old_doc, new_doc;
+    };
+    auto versions = std::make_shared<Versions>();
+    BytesParser<Tag> parser;
+    Tag tree = parse(parser, bytes);
+    versions->old_doc = serialize(tree);
+    auto &chunk = tree.as<Compound>();
+    chunk.at("LastUpdate").as<int64_t>()++;
+    chunk.at("InhabitedTime").as<int64_t>()++;
+    auto &sections = chunk.at("sections").as<List>();
+    for (std::size_t i = 0; i < sections.size(); i += 4) {
+      auto &states =
+          sections[i].as<Compound>().at("block_states").as<Compound>();
+      if (const auto data = states.find("data"); data != states.end())
+        data->second.as<std::pmr::vector<int64_t>>()[0] ^= 1;
+    }
+    versions->new_doc = serialize(tree);
+
+    const auto make = [&](std::string parser_name,
+                          std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "diff_" + std::string{corpus.name},
+          .parser = std::move(parser_name),
+          .bytes = versions->old_doc.size() + versions->new_doc.size(),
+          .values = 2 * corpus.n_tags,
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+
+    // Reference: both trees are built and compared
+    make("parse & compare", [versions]() {
+      BytesParser<Tag> old_parser, new_parser;
+      do_not_optimize(parse(old_parser, versions->old_doc) ==
+                      parse(new_parser, versions->new_doc));
+    });
+    make("diff", [versions]() {
+      do_not_optimize(diff(versions->old_doc, versions->new_doc));
+    });
+  }
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,59 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the content hashing, used to detect the unchanged chunks
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/hash.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_hash_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    auto bytes = std::make_shared<std::vector<StreamChar>>(
+        load_file(corpus.path));
+    if (bytes->size() != corpus.n_bytes)
+      continue;
+    auto tree = std::make_shared<Tag>();
+    {
+      BytesParser<Tag> parser;
+      const StreamChar *strm = bytes->data();
+      unsigned long N = bytes->size();
+      parser.parse(strm, N);
+      *tree = parser.take();
+    }
+
+    const auto make = [&](std::string parser, std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "hash_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = bytes->size(),
+          .values = corpus.n_tags,
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+    make("hash_document",
+         [bytes]() { do_not_optimize(hash_document(*bytes)); });
+    make("hash_document + subtrees", [bytes]() {
+      std::vector<SubtreeHash> subtrees;
+      do_not_optimize(hash_document(*bytes, &subtrees));
+    });
+    make("hash(Tag)", [tree]() { do_not_optimize(hash(*tree)); });
+  }
+}
+
+} // namespace minecraft::nbt::bench
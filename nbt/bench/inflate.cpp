@@ -0,0 +1,66 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the one-shot inflate against zlib's streaming inflate
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/inflate.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+#include <zlib.h>
+
+namespace minecraft::nbt::bench {
+
+void add_inflate_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region" || corpus.kind == "nested")
+      continue;
+    const auto document = load_file(corpus.path);
+    auto compressed = std::make_shared<std::vector<StreamChar>>(
+        compressBound(static_cast<uLong>(document.size())));
+    uLongf n_compressed = static_cast<uLongf>(compressed->size());
+    if (compress2(compressed->data(), &n_compressed, document.data(),
+                  static_cast<uLong>(document.size()), 6) != Z_OK)
+      continue;
+    compressed->resize(n_compressed);
+    const auto size = document.size();
+
+    const auto make = [&](std::string parser, std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "inflate_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = size,
+          .values = corpus.n_tags,
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+    // Both into a buffer of the decompressed size
+    make("zlib inflate", [compressed, size]() {
+      std::vector<StreamChar> out(size);
+      uLongf n_out = static_cast<uLongf>(size);
+      do_not_optimize(uncompress(out.data(), &n_out, compressed->data(),
+                                 static_cast<uLong>(compressed->size())));
+    });
+    make("one-shot inflate", [compressed, size]() {
+      std::vector<StreamChar> out(size);
+      std::size_t n_out = 0;
+      do_not_optimize(inflate_oneshot(*compressed, out, n_out));
+    });
+    // Size to guess, as the chunks of a region
+    make("one-shot inflate (guessed size)", [compressed]() {
+      std::vector<StreamChar> out;
+      do_not_optimize(inflate_all(*compressed, out));
+    });
+  }
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,108 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Synthetic inputs generation for the NBT benchmarks
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "inputs.hpp"
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+static constexpr std::string_view ALPHABET{"abcdefghijklmnopqrstuvwxyz_:"};
+static constexpr std::array<std::string_view, 6> ENTITY_IDS{
+    "minecraft:zombie",  "minecraft:skeleton", "minecraft:item",
+    "minecraft:villager", "minecraft:cow",     "minecraft:armor_stand"};
+
+// ============================================================================
+std::vector<StreamChar> make_strings(std::size_t n) {
+  Random rng{SEED};
+  std::uniform_int_distribution<std::size_t> length{4, 32};
+  std::uniform_int_distribution<std::size_t> letter{0, ALPHABET.size() - 1};
+
+  ByteWriter out;
+  std::string str;
+  for (std::size_t i = 0; i < n; i++) {
+    str.resize(length(rng));
+    for (auto &c : str)
+      c = ALPHABET[letter(rng)];
+    out.put_string(str);
+  }
+  return out.bytes;
+}
+
+// ============================================================================
+/**
+ * @brief Write a list of 3 doubles (e.g. Pos, Motion)
+ */
+static void put_vec3(ByteWriter &out, std::string_view name, Random &rng) {
+  out.put_header(Tags::List, name);
+  out.put(static_cast<TagID_t>(Tags::Double));
+  out.put(int32_t{3});
+  for (int i = 0; i < 3; i++) {
+    out.put(std::uniform_real_distribution<double>{-3e4, 3e4}(rng));
+    out.n_values++;
+  }
+}
+
+std::vector<StreamChar> make_entities(std::size_t n_entities,
+                                      std::size_t &n_tags) {
+  Random rng{SEED};
+  ByteWriter out;
+
+  out.put_header(Tags::Compound, "");
+  out.put_header(Tags::Int, "DataVersion");
+  out.put(int32_t{3955});
+  out.put_header(Tags::List, "Entities");
+  out.put(static_cast<TagID_t>(Tags::Compound));
+  out.put(static_cast<int32_t>(n_entities));
+  for (std::size_t i = 0; i < n_entities; i++) {
+    out.n_values++;
+    out.put_header(Tags::String, "id");
+    out.put_string(ENTITY_IDS[rng() % ENTITY_IDS.size()]);
+    put_vec3(out, "Pos", rng);
+    put_vec3(out, "Motion", rng);
+    out.put_header(Tags::Float, "Health");
+    out.put(std::uniform_real_distribution<float>{0, 20}(rng));
+    out.put_header(Tags::Short, "Fire");
+    out.put(int16_t{-1});
+    out.put_header(Tags::Byte, "OnGround");
+    out.put(static_cast<int8_t>(rng() & 1));
+    out.put_header(Tags::IntArray, "UUID");
+    out.put_array(std::vector<int32_t>{static_cast<int32_t>(rng()),
+                                       static_cast<int32_t>(rng()),
+                                       static_cast<int32_t>(rng()),
+                                       static_cast<int32_t>(rng())});
+    out.put_header(Tags::Long, "WorldUUIDMost");
+    out.put(static_cast<int64_t>(rng()));
+    out.put_header(Tags::Compound, "Attributes");
+    out.put_header(Tags::Double, "generic.max_health");
+    out.put(20.0);
+    out.put(static_cast<TagID_t>(Tags::END));
+    out.put(static_cast<TagID_t>(Tags::END));
+  }
+  out.put(static_cast<TagID_t>(Tags::END));
+
+  n_tags = out.n_values;
+  return out.bytes;
+}
+
+// ============================================================================
+std::vector<StreamChar> load_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  if (!file)
+    return {};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,127 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Synthetic inputs generation for the NBT benchmarks
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_BENCH_INPUTS_HPP
+#define SOLISMC_NBT_BENCH_INPUTS_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/types.hpp"
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace minecraft::nbt::bench {
+
+/**
+ * @brief Random generator used by the inputs, seeded for reproducible runs
+ */
+using Random = std::mt19937_64;
+constexpr uint64_t SEED{0x50115};
+
+/**
+ * @brief Big-endian (JAVA) NBT bytes writer
+ */
+struct ByteWriter {
+  std::vector<StreamChar> bytes;
+  std::size_t n_values = 0; // Number of NBT values written
+
+  template <std::integral T> void put(T value) {
+    for (std::size_t i = sizeof(T); i > 0; i--)
+      bytes.push_back(static_cast<StreamChar>(
+          static_cast<std::make_unsigned_t<T>>(value) >>
+          ((i - 1) * BIT_PER_BYTES)));
+  }
+  void put(float value) { put(std::bit_cast<int32_t>(value)); }
+  void put(double value) { put(std::bit_cast<int64_t>(value)); }
+
+  void put_string(std::string_view str) {
+    put(static_cast<uint16_t>(str.size()));
+    bytes.insert(bytes.end(), str.begin(), str.end());
+  }
+
+  /**
+   * @brief Write the header of a named tag (ID + name)
+   */
+  void put_header(Tags tag, std::string_view name) {
+    put(static_cast<TagID_t>(tag));
+    put_string(name);
+    n_values++;
+  }
+
+  template <typename T> void put_array(const std::vector<T> &values) {
+    put(static_cast<int32_t>(values.size()));
+    for (auto v : values)
+      put(v);
+  }
+};
+
+// ============================================================================
+// Generators
+// ============================================================================
+
+/**
+ * @brief Stream of n random values of type T
+ */
+template <typename T> std::vector<StreamChar> make_values(std::size_t n) {
+  Random rng{SEED};
+  ByteWriter out;
+  for (std::size_t i = 0; i < n; i++) {
+    if constexpr (std::floating_point<T>)
+      out.put(std::uniform_real_distribution<T>{-1e6, 1e6}(rng));
+    else
+      out.put(static_cast<T>(rng()));
+  }
+  return out.bytes;
+}
+
+/**
+ * @brief Stream of n random identifier-like strings (4 to 32 characters)
+ */
+std::vector<StreamChar> make_strings(std::size_t n);
+
+/**
+ * @brief Stream of n arrays of `length` random values of type T
+ */
+template <typename T>
+std::vector<StreamChar> make_arrays(std::size_t n, std::size_t length) {
+  Random rng{SEED};
+  ByteWriter out;
+  std::vector<T> values(length);
+  for (std::size_t i = 0; i < n; i++) {
+    for (auto &v : values)
+      v = static_cast<T>(rng());
+    out.put_array(values);
+  }
+  return out.bytes;
+}
+
+/**
+ * @brief Compound-heavy document: a root compound holding a list of
+ * `n_entities` entity-like compounds.
+ *
+ * @param n_tags receives the number of tags in the document
+ */
+std::vector<StreamChar> make_entities(std::size_t n_entities,
+                                      std::size_t &n_tags);
+
+/**
+ * @brief Load a whole file (e.g. a generated corpus) in memory
+ *
+ * @return the bytes of the file, empty if it can't be read
+ */
+std::vector<StreamChar> load_file(std::string_view path);
+
+} // namespace minecraft::nbt::bench
+
+#endif
@@ -0,0 +1,113 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the loading of many small NBT files
+//
+// The files are generated once in the temporary directory, and are read from
+// the page cache: the benchmarks measure the system calls and parsing costs,
+// not the storage.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/loader.hpp"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <zlib.h>
+
+namespace minecraft::nbt::bench {
+
+namespace fs = std::filesystem;
+
+// Number of files in the batch (e.g. playerdata of a large server)
+static constexpr std::size_t N_FILES{10000};
+// Number of entities in each file (a few KB once compressed)
+static constexpr std::size_t FILE_ENTITIES{16};
+
+/**
+ * @brief gzip-compress a document, as the playerdata files are
+ */
+static std::vector<StreamChar> gzip(const std::vector<StreamChar> &input) {
+  z_stream zs{};
+  deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+               Z_DEFAULT_STRATEGY);
+  std::vector<StreamChar> out(deflateBound(&zs, input.size()));
+  zs.next_in = const_cast<Bytef *>(input.data());
+  zs.avail_in = static_cast<uInt>(input.size());
+  zs.next_out = out.data();
+  zs.avail_out = static_cast<uInt>(out.size());
+  deflate(&zs, Z_FINISH);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+  return out;
+}
+
+/**
+ * @brief Batch of files, written on first use
+ */
+struct FileBatch {
+  std::vector<StreamChar> bytes; // Content of every file
+  std::vector<fs::path> paths;
+  bool written = false;
+
+  const std::vector<fs::path> &get() {
+    if (written)
+      return paths;
+    const auto dir = fs::temp_directory_path() / "solismc_bench_files";
+    fs::create_directories(dir);
+    for (std::size_t i = 0; i < N_FILES; i++) {
+      paths.push_back(dir / (std::to_string(i) + ".dat"));
+      std::ofstream{paths.back(), std::ios::binary}.write(
+          reinterpret_cast<const char *>(bytes.data()),
+          static_cast<std::streamsize>(bytes.size()));
+    }
+    written = true;
+    return paths;
+  }
+};
+
+// ============================================================================
+void add_loader_benchmarks(std::vector<Benchmark> &benchmarks) {
+  std::size_t n_tags;
+  auto batch = std::make_shared<FileBatch>();
+  batch->bytes = gzip(make_entities(FILE_ENTITIES, n_tags));
+  const auto make = [&](std::string parser, std::function<void()> run) {
+    benchmarks.push_back(Benchmark{
+        .name = "files_10k",
+        .parser = std::move(parser),
+        .bytes = N_FILES * batch->bytes.size(),
+        .values = N_FILES,
+        .feedable = false,
+        .run = [run = std::move(run)](FeedStep) { run(); }});
+  };
+
+  // Reference: one file after the other
+  make("parse_file loop", [batch]() {
+    for (const auto &path : batch->get())
+      do_not_optimize(parse_file(path));
+  });
+
+  // Batch loaders (io_uring only when the kernel allows it)
+  const auto add_loader = [&](std::string parser, LoadBackend backend) {
+    auto loader =
+        std::make_shared<BatchLoader>(LoadOptions{.backend = backend});
+    make(std::move(parser), [batch, loader]() {
+      loader->load(batch->get(), [](std::size_t, std::optional<Tag> root) {
+        do_not_optimize(root);
+      });
+    });
+  };
+  if (BatchLoader{}.get_backend() == LoadBackend::IO_URING)
+    add_loader("BatchLoader<io_uring>", LoadBackend::IO_URING);
+  add_loader("BatchLoader<threads>", LoadBackend::THREADS);
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,78 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the MUTF-8 conversions on the strings of the corpora, next to
+// plain copies of the same strings
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/cursor.hpp"
+#include "minecraft/nbt/mutf8.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_mutf8_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    const auto bytes = load_file(corpus.path);
+    if (bytes.size() != corpus.n_bytes)
+      continue;
+
+    // Names and strings of the document
+    auto strings = std::make_shared<std::vector<std::string>>();
+    std::size_t n_bytes = 0;
+    Cursor cursor{bytes};
+    for (const auto &token : cursor) {
+      if (!token.name.empty())
+        strings->emplace_back(token.name);
+      if (token.kind == TokenKind::VALUE && token.tag == Tags::String)
+        strings->emplace_back(token.get<std::string_view>());
+    }
+    for (const auto &str : *strings)
+      n_bytes += str.size();
+
+    const auto make = [&](std::string parser, std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "mutf8_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = n_bytes,
+          .values = strings->size(),
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+    make("std::string copy", [strings]() {
+      std::string out;
+      for (const auto &str : *strings) {
+        out.assign(str);
+        do_not_optimize(out);
+      }
+    });
+    make("mutf8_to_utf8", [strings]() {
+      std::string out;
+      for (const auto &str : *strings) {
+        mutf8_to_utf8(str, out);
+        do_not_optimize(out);
+      }
+    });
+    make("utf8_to_mutf8", [strings]() {
+      std::string out;
+      for (const auto &str : *strings) {
+        utf8_to_mutf8(str, out);
+        do_not_optimize(out);
+      }
+    });
+  }
+}
+
+} // namespace minecraft::nbt::bench
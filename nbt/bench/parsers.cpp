@@ -0,0 +1,196 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the NBT bytes parsers
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/parser.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <memory_resource>
+
+namespace minecraft::nbt::bench {
+
+// Number of values in the primitives streams
+static constexpr std::size_t N_VALUES{1 << 16};
+// Number of strings in the strings stream
+static constexpr std::size_t N_STRINGS{1 << 14};
+// Number & length of arrays in the arrays streams
+static constexpr std::size_t N_ARRAYS{64};
+static constexpr std::size_t ARRAY_LENGTH{4096};
+// Number of entities in the compound-heavy document
+static constexpr std::size_t N_ENTITIES{4096};
+
+/**
+ * @brief Make a benchmark parsing the input with a BytesParser<T>
+ */
+template <typename T>
+static Benchmark make(std::string name, std::string parser,
+                      std::vector<StreamChar> input, std::size_t n_values) {
+  auto p_input =
+      std::make_shared<const std::vector<StreamChar>>(std::move(input));
+  auto p_parser = std::make_shared<BytesParser<T>>();
+  return Benchmark{
+      .name = std::move(name),
+      .parser = std::move(parser),
+      .bytes = p_input->size(),
+      .values = n_values,
+      .run = [p_input, p_parser](FeedStep step) {
+        p_parser->reset();
+        feed(*p_parser, *p_input, step);
+      }};
+}
+
+/**
+ * @brief Per-document arena: a monotonic resource over a preallocated buffer,
+ * released (rewound) before each parse
+ */
+struct MonotonicArena {
+  std::vector<std::byte> buffer;
+  std::pmr::monotonic_buffer_resource resource;
+
+  explicit MonotonicArena(std::size_t size)
+      : buffer(size), resource(buffer.data(), buffer.size()) {}
+  void recycle() { resource.release(); }
+};
+
+/**
+ * @brief Per-thread pool: freed nodes are recycled by the next parse
+ */
+struct PoolArena {
+  std::pmr::unsynchronized_pool_resource resource;
+
+  explicit PoolArena(std::size_t) {}
+  void recycle() {}
+};
+
+/**
+ * @brief Tree parser allocating from its own arena
+ */
+template <typename Arena> struct TreeParser {
+  Arena arena;
+  BytesParser<Tag> parser{&arena.resource};
+
+  explicit TreeParser(std::size_t size) : arena(size) {}
+};
+
+/**
+ * @brief Make a benchmark parsing trees allocated from an arena
+ */
+template <typename Arena>
+static Benchmark make_tree(std::string name, std::string arena,
+                           std::vector<StreamChar> input, std::size_t n_tags) {
+  auto p_input =
+      std::make_shared<const std::vector<StreamChar>>(std::move(input));
+  // Trees take a few times the size of their serialized form
+  auto p_tree = std::make_shared<TreeParser<Arena>>(8 * p_input->size());
+  return Benchmark{
+      .name = std::move(name),
+      .parser = "BytesParser<Tag> (" + arena + ")",
+      .bytes = p_input->size(),
+      .values = n_tags,
+      .run = [p_input, p_tree](FeedStep step) {
+        // The previous tree must be freed before recycling its memory
+        p_tree->parser.reset();
+        p_tree->arena.recycle();
+        feed(p_tree->parser, *p_input, step);
+      }};
+}
+
+/**
+ * @brief Register the benchmarks of a tree document with each kind of memory
+ * resource
+ */
+static void add_trees(std::vector<Benchmark> &benchmarks,
+                      const std::string &name,
+                      std::vector<StreamChar> input, std::size_t n_tags) {
+  benchmarks.push_back(
+      make_tree<MonotonicArena>(name, "monotonic", input, n_tags));
+  benchmarks.push_back(make_tree<PoolArena>(name, "pool", input, n_tags));
+  benchmarks.push_back(make<Tag>(name, "BytesParser<Tag>", std::move(input),
+                                 n_tags));
+}
+
+// ============================================================================
+std::vector<Benchmark> make_benchmarks() {
+  std::vector<Benchmark> benchmarks;
+
+  // Primitives
+  benchmarks.push_back(make<int8_t>("byte", "BytesParser<int8_t>",
+                                    make_values<int8_t>(N_VALUES), N_VALUES));
+  benchmarks.push_back(make<int16_t>("short", "BytesParser<int16_t>",
+                                     make_values<int16_t>(N_VALUES),
+                                     N_VALUES));
+  benchmarks.push_back(make<int32_t>("int", "BytesParser<int32_t>",
+                                     make_values<int32_t>(N_VALUES),
+                                     N_VALUES));
+  benchmarks.push_back(make<int64_t>("long", "BytesParser<int64_t>",
+                                     make_values<int64_t>(N_VALUES),
+                                     N_VALUES));
+  benchmarks.push_back(make<float>("float", "BytesParser<float>",
+                                   make_values<float>(N_VALUES), N_VALUES));
+  benchmarks.push_back(make<double>("double", "BytesParser<double>",
+                                    make_values<double>(N_VALUES), N_VALUES));
+
+  // Strings
+  benchmarks.push_back(make<std::string>("string", "BytesParser<std::string>",
+                                         make_strings(N_STRINGS), N_STRINGS));
+
+  // Arrays
+  benchmarks.push_back(make<std::vector<int8_t>>(
+      "byte_array", "BytesParser<std::vector<int8_t>>",
+      make_arrays<int8_t>(N_ARRAYS, ARRAY_LENGTH), N_ARRAYS * ARRAY_LENGTH));
+  benchmarks.push_back(make<std::vector<int32_t>>(
+      "int_array", "BytesParser<std::vector<int32_t>>",
+      make_arrays<int32_t>(N_ARRAYS, ARRAY_LENGTH), N_ARRAYS * ARRAY_LENGTH));
+  benchmarks.push_back(make<std::vector<int64_t>>(
+      "long_array", "BytesParser<std::vector<int64_t>>",
+      make_arrays<int64_t>(N_ARRAYS, ARRAY_LENGTH), N_ARRAYS * ARRAY_LENGTH));
+
+  // Trees
+  std::size_t n_tags;
+  auto entities = make_entities(N_ENTITIES, n_tags);
+  add_trees(benchmarks, "entities_compound", std::move(entities), n_tags);
+
+  // Generated corpora (regions are containers of compressed documents, they
+  // are benchmarked by the region readers)
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    auto bytes = load_file(corpus.path);
+    if (bytes.size() != corpus.n_bytes) {
+      std::fprintf(stderr, "Skipping corpus %s: can't read %s\n",
+                   corpus.name.data(), corpus.path.data());
+      continue;
+    }
+    add_trees(benchmarks, "corpus_" + std::string{corpus.name},
+              std::move(bytes), corpus.n_tags);
+  }
+
+  add_sax_benchmarks(benchmarks);
+  add_cursor_benchmarks(benchmarks);
+  add_loader_benchmarks(benchmarks);
+  add_diff_benchmarks(benchmarks);
+  add_hash_benchmarks(benchmarks);
+  add_tier_benchmarks(benchmarks);
+  add_save_benchmarks(benchmarks);
+  add_compression_benchmarks(benchmarks);
+  add_inflate_benchmarks(benchmarks);
+  add_snapshot_benchmarks(benchmarks);
+  add_validate_benchmarks(benchmarks);
+  add_mutf8_benchmarks(benchmarks);
+  add_compound_benchmarks(benchmarks);
+  return benchmarks;
+}
+
+} // namespace minecraft::nbt::bench
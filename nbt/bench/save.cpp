@@ -0,0 +1,65 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the saving of a region, depending on how much of it changed
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "minecraft/nbt/region.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_save_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind != "region")
+      continue;
+    auto region = RegionFile::open(std::string{corpus.path});
+    if (!region)
+      continue;
+
+    // Every chunk modified as a whole, or in a single entry
+    auto whole = std::make_shared<DirtyChunks>();
+    auto entry = std::make_shared<DirtyChunks>();
+    Reader reader;
+    std::vector<StreamChar> buffer;
+    for (std::size_t i = 0; i < REGION_CHUNKS; i++) {
+      auto root = region->parse_chunk(i, reader, buffer);
+      if (!root)
+        continue;
+      auto chunk = std::make_shared<const Tag>(std::move(*root));
+      whole->mark(i, chunk);
+      entry->mark(i, chunk, {"LastUpdate"});
+    }
+    const auto target = std::filesystem::temp_directory_path() /
+                        ("solismc_bench_" + std::string{corpus.name} + ".mca");
+
+    const auto make = [&](std::string parser,
+                          std::shared_ptr<DirtyChunks> dirty) {
+      benchmarks.push_back(Benchmark{
+          .name = "save_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = corpus.n_bytes,
+          .values = whole->size(),
+          .feedable = false,
+          .run = [source = std::string{corpus.path}, target,
+                  dirty](FeedStep) {
+            do_not_optimize(save_region(source, target, *dirty));
+          }});
+    };
+    make("all chunks re-encoded", whole);
+    make("one entry per chunk", entry);
+    make("no dirty chunk", std::make_shared<DirtyChunks>());
+  }
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,66 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the event-based parsing, next to the trees of the same corpora
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/sax.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+/**
+ * @brief Visitor counting the values of the document (a minimal forward pass)
+ */
+struct CountingVisitor : SaxVisitor {
+  std::size_t n_values = 0;
+
+  inline void begin_compound(std::string_view) { n_values++; }
+  inline void begin_list(Tags, int32_t) { n_values++; }
+  inline void begin_array(Tags, int32_t) { n_values++; }
+  template <typename T> inline void value(T) { n_values++; }
+};
+
+void add_sax_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    auto bytes = std::make_shared<std::vector<StreamChar>>(
+        load_file(corpus.path));
+    if (bytes->size() != corpus.n_bytes)
+      continue;
+
+    benchmarks.push_back(Benchmark{
+        .name = "corpus_" + std::string{corpus.name},
+        .parser = "SaxParser (counting)",
+        .bytes = bytes->size(),
+        .values = corpus.n_tags,
+        .run = [bytes](FeedStep step) {
+          CountingVisitor visitor;
+          SaxParser parser{visitor};
+          const StreamChar *strm = bytes->data();
+          std::size_t left = bytes->size();
+          while (left > 0) {
+            unsigned long N = step == CONTIGUOUS ? left : std::min(step, left);
+            left -= N;
+            if (parser.parse(strm, N) == ParseResult::FAILED) {
+              std::fprintf(stderr, "Parser failed on benchmark input\n");
+              return;
+            }
+          }
+          do_not_optimize(visitor.n_values);
+        }});
+  }
+}
+
+} // namespace minecraft::nbt::bench
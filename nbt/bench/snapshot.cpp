@@ -0,0 +1,83 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the snapshots: startup by mapping the snapshot of a document
+// against parsing the document
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/snapshot.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_snapshot_benchmarks(std::vector<Benchmark> &benchmarks) {
+  const auto dir =
+      std::filesystem::temp_directory_path() / "solismc_snapshot_bench";
+  std::filesystem::create_directories(dir);
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    auto bytes = std::make_shared<std::vector<StreamChar>>(
+        load_file(corpus.path));
+    if (bytes->size() != corpus.n_bytes)
+      continue;
+    Tag tree;
+    {
+      BytesParser<Tag> parser;
+      const StreamChar *strm = bytes->data();
+      unsigned long N = bytes->size();
+      parser.parse(strm, N);
+      tree = parser.take();
+    }
+    const auto snapshot = build_snapshot(tree);
+    if (!snapshot)
+      continue;
+    const auto path = dir / (std::string{corpus.name} + ".snap");
+    {
+      std::ofstream file{path, std::ios::binary | std::ios::trunc};
+      file.write(reinterpret_cast<const char *>(snapshot->data()),
+                 static_cast<std::streamsize>(snapshot->size()));
+    }
+    // Entry looked up once the document is loaded
+    const auto *root = std::get_if<Compound>(&tree);
+    const std::string key =
+        root && !root->empty() ? std::string{root->begin()->first} : "";
+
+    const auto make = [&](std::string parser, std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "snapshot_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = bytes->size(),
+          .values = corpus.n_tags,
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+    make("parse + find", [bytes, key]() {
+      BytesParser<Tag> parser;
+      const StreamChar *strm = bytes->data();
+      unsigned long N = bytes->size();
+      parser.parse(strm, N);
+      if (const auto *root = std::get_if<Compound>(parser.get()))
+        do_not_optimize(root->find(std::string_view{key}) != root->end());
+    });
+    make("Snapshot::open + find", [path, key]() {
+      const auto snapshot = Snapshot::open(path);
+      do_not_optimize(snapshot && snapshot->root().find(key));
+    });
+  }
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,63 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the reload of a chunk from the compressed tier and from its
+// region file
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "minecraft/nbt/cache.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_tier_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind != "region")
+      continue;
+    auto region = RegionFile::open(std::string{corpus.path});
+    if (!region)
+      continue;
+    std::size_t index = 0;
+    while (index < REGION_CHUNKS && !region->contains(index))
+      index++;
+    Reader reader;
+    std::vector<StreamChar> buffer;
+    const auto root = region->parse_chunk(index, reader, buffer);
+    if (!root)
+      continue;
+    const auto size = serialize(*root).size();
+    auto tier = std::make_shared<CompressedTier>();
+    tier->put({0, 0, 0}, *root);
+
+    const auto make = [&](std::string parser, std::function<void()> run) {
+      benchmarks.push_back(Benchmark{
+          .name = "tier_" + std::string{corpus.name},
+          .parser = std::move(parser),
+          .bytes = size,
+          .values = 1,
+          .feedable = false,
+          .run = [run = std::move(run)](FeedStep) { run(); }});
+    };
+    // The region stays open, as in a RegionLoader
+    auto file = std::make_shared<RegionFile>(std::move(*region));
+    make("region read + inflate + parse", [file, index]() {
+      Reader reader;
+      std::vector<StreamChar> buffer;
+      do_not_optimize(file->parse_chunk(index, reader, buffer));
+    });
+    make("tier lz4 + parse",
+         [tier]() { do_not_optimize(tier->get({0, 0, 0})); });
+  }
+}
+
+} // namespace minecraft::nbt::bench
@@ -0,0 +1,41 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Benchmarks of the validation, next to the parsing of the same corpora
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "bench.hpp"
+#include "inputs.hpp"
+#include "minecraft/nbt/validate.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <memory>
+#include <string>
+
+namespace minecraft::nbt::bench {
+
+void add_validate_benchmarks(std::vector<Benchmark> &benchmarks) {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    auto bytes = std::make_shared<std::vector<StreamChar>>(
+        load_file(corpus.path));
+    if (bytes->size() != corpus.n_bytes)
+      continue;
+
+    benchmarks.push_back(Benchmark{
+        .name = "corpus_" + std::string{corpus.name},
+        .parser = "validate",
+        .bytes = bytes->size(),
+        .values = corpus.n_tags,
+        .feedable = false,
+        .run = [bytes](FeedStep) { do_not_optimize(validate(*bytes)); }});
+  }
+}
+
+} // namespace minecraft::nbt::bench
@@ -11,6 +11,10 @@
 # =============================================================================
 
 option(NBT_BIG_ENDIAN "Do the NBT bytes translator should read values as little-endian (BEDROCK) or big-endian (JAVA)" 1)
+option(NBT_STATS "Maintain the parsing statistics counters (bytes, values, allocations, timings)" OFF)
+
+find_package(ZLIB REQUIRED)
+find_package(Threads REQUIRED)
 
 # =============================================================================
 # NBT library
@@ -22,13 +26,21 @@ add_solis_library( nbt
     SHARED
 )
 target_compile_definitions(nbt PRIVATE NBT_BIG_ENDIAN=1)
+target_compile_definitions(nbt PUBLIC NBT_STATS=$<BOOL:${NBT_STATS}>)
+target_link_libraries(nbt PRIVATE ZLIB::ZLIB Threads::Threads)
 
 # =============================================================================
 # Dataset generation
 # =============================================================================
+set(NBT_CORPUS_SEED "" CACHE STRING "Override the seed of the generated NBT corpora (empty to use corpora.yml)")
+set(NBT_CORPUS_SCALE "1.0" CACHE STRING "Scale factor of the generated NBT corpora")
 set(DATASET_GEN_DIR "${CMAKE_CURRENT_BINARY_DIR}/dataset")
+set(DATASET_GEN_ARGS --corpora "${CMAKE_CURRENT_LIST_DIR}/data/corpora.yml" --scale ${NBT_CORPUS_SCALE})
+if(NOT NBT_CORPUS_SEED STREQUAL "")
+  list(APPEND DATASET_GEN_ARGS --seed ${NBT_CORPUS_SEED})
+endif()
 add_custom_target( nbt_dataset
-    python3 ${CMAKE_CURRENT_LIST_DIR}/data/gen_data.py "${CMAKE_CURRENT_LIST_DIR}/data/models" "${DATASET_GEN_DIR}/solismc_dataset/nbt/"
+    python3 ${CMAKE_CURRENT_LIST_DIR}/data/gen_data.py "${CMAKE_CURRENT_LIST_DIR}/data/models" "${DATASET_GEN_DIR}/solismc_dataset/nbt/" ${DATASET_GEN_ARGS}
     COMMENT "Building dataset"
 )
 
@@ -41,4 +53,42 @@ add_solis_executable( test_parse
 )
 target_include_directories(test_parse PRIVATE "${DATASET_GEN_DIR}")
 add_dependencies(test_parse nbt_dataset)
-add_test(NAME test_nbt_parse COMMAND test_parse)
\ No newline at end of file
+add_test(NAME test_nbt_parse COMMAND test_parse)
+
+# =============================================================================
+# Tools
+# =============================================================================
+add_solis_executable( nbt_scan
+    DIRECTORIES "nbt/tools/scan"
+    DEPENDS nbt
+)
+target_link_libraries(nbt_scan PRIVATE Threads::Threads)
+set_target_properties(nbt_scan PROPERTIES OUTPUT_NAME nbt-scan)
+
+add_solis_executable( nbt_transcode
+    DIRECTORIES "nbt/tools/transcode"
+    DEPENDS nbt
+)
+target_link_libraries(nbt_transcode PRIVATE Threads::Threads)
+set_target_properties(nbt_transcode PROPERTIES OUTPUT_NAME nbt-transcode)
+
+# =============================================================================
+# Benchmarks
+# =============================================================================
+if(BENCHMARKS_ENABLED)
+  add_solis_executable( bench_nbt
+      DIRECTORIES "nbt/bench"
+      DEPENDS nbt
+  )
+  target_compile_definitions(bench_nbt PRIVATE NBT_BIG_ENDIAN=1)
+  target_link_libraries(bench_nbt PRIVATE ZLIB::ZLIB)
+  target_include_directories(bench_nbt PRIVATE "${DATASET_GEN_DIR}")
+  add_dependencies(bench_nbt nbt_dataset)
+
+  # Run the whole suite and keep a machine-readable report of the results
+  add_custom_target( bench_nbt_report
+      $<TARGET_FILE:bench_nbt> --json "${CMAKE_CURRENT_BINARY_DIR}/bench_nbt.json"
+      DEPENDS bench_nbt
+      COMMENT "Running NBT benchmarks"
+  )
+endif()
\ No newline at end of file
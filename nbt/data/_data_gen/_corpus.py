@@ -0,0 +1,478 @@
+# =============================================================================
+# Project: SOLISMC-FILEIO
+#
+# Generation of large synthetic NBT corpora (chunks, entities, structures,
+# region files, nested & wide compounds) for the benchmarks and the tests
+#
+# Author    Meltwin (github@meltwin.fr)
+# Date      19/10/2026 (created 19/10/2026)
+# Version   1.0.0
+# Copyright Solis Forge | 2026
+#           Distributed under MIT License (https://opensource.org/licenses/MIT)
+# =============================================================================
+from collections.abc import Callable
+from dataclasses import dataclass, field
+from hashlib import sha1
+from logging import getLogger
+from pathlib import Path
+from random import Random
+from solis.utils.types.patterns import LazyInit
+from typing import Any
+from ._nbt_writer import NBTWriter, Tag
+import struct
+import yaml
+import zlib
+
+LOGGER = LazyInit(lambda: getLogger("CorpusGenerator"))
+
+GENERATOR_VERSION = 1
+""" Bump to force the regeneration of existing corpora """
+
+DATA_VERSION = 3955
+""" Minecraft data version written in the generated documents (1.21.1) """
+
+SECTOR_SIZE = 4096
+""" Size of a region file sector """
+
+_BLOCKS = [
+    "minecraft:air", "minecraft:stone", "minecraft:deepslate", "minecraft:dirt",
+    "minecraft:grass_block", "minecraft:water", "minecraft:gravel",
+    "minecraft:andesite", "minecraft:diorite", "minecraft:granite",
+    "minecraft:coal_ore", "minecraft:iron_ore", "minecraft:copper_ore",
+    "minecraft:lava", "minecraft:tuff", "minecraft:oak_log",
+]  # fmt: skip
+_BIOMES = ["minecraft:plains", "minecraft:forest", "minecraft:river"]
+_ENTITIES = [
+    "minecraft:zombie", "minecraft:skeleton", "minecraft:item",
+    "minecraft:villager", "minecraft:cow", "minecraft:armor_stand",
+]  # fmt: skip
+_ITEMS = ["minecraft:stone", "minecraft:bread", "minecraft:iron_sword"]
+
+
+# =============================================================================
+# Configuration
+# =============================================================================
+@dataclass
+class CorpusEntry:
+    """
+    A corpus file to generate
+    """
+
+    name: str
+    kind: str
+    params: dict[str, Any] = field(default_factory=dict)
+    seed: int = 0
+
+
+@dataclass
+class CorpusFile:
+    """
+    A generated corpus file
+    """
+
+    name: str
+    kind: str
+    path: Path
+    n_bytes: int
+    n_tags: int
+
+
+def read_corpora(file_in: Path, seed: int | None, scale: float) -> list[CorpusEntry]:
+    """
+    Read the corpora description file.
+
+    The seed of each entry is derived from the global seed and its name so
+    that adding an entry does not change the content of the others.
+    """
+    with file_in.open("r") as handle:
+        content: dict[str, Any] = yaml.safe_load(handle)  # type: ignore
+
+    global_seed = int(content.get("seed", 0)) if seed is None else seed
+    entries = []
+    for name, params in (content.get("corpora") or {}).items():
+        params = dict(params)
+        kind = str(params.pop("kind"))
+        entry_seed = int(params.pop("seed", global_seed)) ^ zlib.crc32(name.encode())
+        params = {key: _scale(val, scale) for key, val in params.items()}
+        entries.append(CorpusEntry(name, kind, params, entry_seed))
+    return entries
+
+
+def _scale(value: Any, scale: float) -> Any:
+    """Scale a size parameter (integers and lists of integers)"""
+    if isinstance(value, bool):
+        return value
+    if isinstance(value, int):
+        return max(1, round(value * scale))
+    if isinstance(value, list):
+        return [_scale(v, scale) for v in value]
+    return value
+
+
+# =============================================================================
+# Generator entrypoint
+# =============================================================================
+def generate_corpora(
+    entries: list[CorpusEntry], output_d: Path
+) -> list[CorpusFile]:
+    """
+    Generate the corpus files in the output directory.
+
+    Files whose description did not change since the last generation are not
+    generated again.
+    """
+    output_d.mkdir(parents=True, exist_ok=True)
+    files = []
+    for entry in entries:
+        generator, extension = _GENERATORS[entry.kind]
+        path = output_d.joinpath(entry.name + extension)
+        stamp = output_d.joinpath(entry.name + ".stamp")
+        digest = sha1(
+            repr((GENERATOR_VERSION, entry.kind, entry.seed, entry.params)).encode()
+        ).hexdigest()
+
+        # Skip up-to-date files
+        if path.exists() and stamp.exists():
+            old_digest, n_tags = stamp.read_text().split()
+            if old_digest == digest:
+                files.append(
+                    CorpusFile(entry.name, entry.kind, path, path.stat().st_size, int(n_tags))
+                )
+                continue
+
+        LOGGER().info(f"Generating corpus {entry.name} ({entry.kind}) -> {path}")
+        data, n_tags = generator(Random(entry.seed), **entry.params)
+        path.write_bytes(data)
+        stamp.write_text(f"{digest} {n_tags}\n")
+        files.append(CorpusFile(entry.name, entry.kind, path, len(data), n_tags))
+    return files
+
+
+def generate_corpus_header(files: list[CorpusFile], output_file: Path) -> None:
+    """
+    Generate the header listing the corpus files
+    """
+    lines = ",\n".join(
+        f'    CorpusFile{{"{f.name}", "{f.kind}", "{f.path.resolve().as_posix()}", '
+        f"{f.n_bytes}, {f.n_tags}}}"
+        for f in files
+    )
+    output_file.write_text(
+        f"""// AUTOGENERATED FOR SOLISMC_FILEIO
+#ifndef SOLIS_DATASET_CORPUS
+#define SOLIS_DATASET_CORPUS
+#include <array>
+#include <string_view>
+
+struct CorpusFile {{
+    std::string_view name;  // Name of the corpus entry
+    std::string_view kind;  // Generator used (chunk, entities, region, ...)
+    std::string_view path;  // Absolute path of the generated file
+    unsigned long n_bytes;  // Size of the file
+    unsigned long n_tags;   // Number of tags in the document(s)
+}};
+
+static constexpr std::array<CorpusFile, {len(files)}> CORPUS {{
+{lines}
+}};
+#endif
+"""
+    )
+
+
+# =============================================================================
+# Chunk columns
+# =============================================================================
+def _pack(indices: list[int], bits: int) -> list[int]:
+    """
+    Pack palette indices into signed longs (entries do not span two longs)
+    """
+    per_long = 64 // bits
+    longs = []
+    for start in range(0, len(indices), per_long):
+        value = 0
+        for i, index in enumerate(indices[start : start + per_long]):
+            value |= index << (i * bits)
+        longs.append(value - (1 << 64) if value >= (1 << 63) else value)
+    return longs
+
+
+def _write_section(w: NBTWriter, rng: Random, y: int, palette: int) -> None:
+    """
+    Write a 16x16x16 chunk section with a palette of the given size
+    """
+    w.begin_compound(None)
+    w.put_byte("Y", y)
+
+    # Blocks
+    w.begin_compound("block_states")
+    w.begin_list("palette", Tag.COMPOUND, palette)
+    for i in range(palette):
+        w.begin_compound(None)
+        w.put_string("Name", _BLOCKS[i % len(_BLOCKS)])
+        if i >= len(_BLOCKS):
+            w.begin_compound("Properties")
+            w.put_string("variant", str(i))
+            w.end_compound()
+        w.end_compound()
+    if palette > 1:
+        # Skewed distribution: the first blocks of the palette are the most used
+        weights = [1.0 / (i + 1) for i in range(palette)]
+        indices = rng.choices(range(palette), weights=weights, k=4096)
+        w.put_long_array("data", _pack(indices, max(4, (palette - 1).bit_length())))
+    w.end_compound()
+
+    # Biomes
+    w.begin_compound("biomes")
+    w.begin_list("palette", Tag.STRING, 1)
+    w.put_string(None, rng.choice(_BIOMES))
+    w.end_compound()
+
+    # Lights
+    w.put_byte_array("BlockLight", rng.randbytes(2048))
+    w.put_byte_array("SkyLight", rng.randbytes(2048))
+    w.end_compound()
+
+
+def _write_chunk(
+    w: NBTWriter, rng: Random, x: int, z: int, palette: int, sections: int
+) -> None:
+    """
+    Write a full chunk column. Sections above the surface only hold air.
+    """
+    w.begin_compound("")
+    w.put_int("DataVersion", DATA_VERSION)
+    w.put_int("xPos", x)
+    w.put_int("yPos", -4)
+    w.put_int("zPos", z)
+    w.put_string("Status", "minecraft:full")
+    w.put_long("LastUpdate", rng.randrange(1 << 40))
+    w.put_long("InhabitedTime", rng.randrange(1 << 20))
+
+    # Sections
+    surface = rng.randrange(sections // 2, sections)
+    w.begin_list("sections", Tag.COMPOUND, sections)
+    for y in range(sections):
+        section_palette = rng.randint(max(1, palette // 2), palette) if y < surface else 1
+        _write_section(w, rng, y - 4, section_palette)
+
+    # Block entities
+    n_block_entities = rng.randrange(8)
+    w.begin_list("block_entities", Tag.COMPOUND, n_block_entities)
+    for _ in range(n_block_entities):
+        _write_container(w, rng)
+
+    # Heightmaps
+    w.begin_compound("Heightmaps")
+    for name in ("MOTION_BLOCKING", "WORLD_SURFACE", "OCEAN_FLOOR"):
+        w.put_long_array(name, [rng.getrandbits(63) for _ in range(37)])
+    w.end_compound()
+    w.end_compound()
+
+
+def _write_container(w: NBTWriter, rng: Random) -> None:
+    """
+    Write a chest block entity holding some items
+    """
+    w.begin_compound(None)
+    w.put_string("id", "minecraft:chest")
+    w.put_int("x", rng.randrange(-30000, 30000))
+    w.put_int("y", rng.randrange(-64, 320))
+    w.put_int("z", rng.randrange(-30000, 30000))
+    n_items = rng.randrange(27)
+    w.begin_list("Items", Tag.COMPOUND, n_items)
+    for slot in range(n_items):
+        w.begin_compound(None)
+        w.put_byte("Slot", slot)
+        w.put_string("id", rng.choice(_ITEMS))
+        w.put_int("count", rng.randint(1, 64))
+        w.end_compound()
+    w.end_compound()
+
+
+def gen_chunk(rng: Random, palette: int = 16, sections: int = 24) -> tuple[bytes, int]:
+    """
+    Generate a full chunk column
+    """
+    w = NBTWriter()
+    _write_chunk(w, rng, rng.randrange(-1000, 1000), rng.randrange(-1000, 1000), palette, sections)
+    return bytes(w.buffer), w.n_tags
+
+
+# =============================================================================
+# Entities
+# =============================================================================
+def _write_vec(w: NBTWriter, name: str, tag: Tag, values: list[float]) -> None:
+    w.begin_list(name, tag, len(values))
+    for v in values:
+        (w.put_double if tag == Tag.DOUBLE else w.put_float)(None, v)
+
+
+def _write_entity(w: NBTWriter, rng: Random) -> None:
+    """
+    Write a living entity with its equipment and attributes
+    """
+    w.begin_compound(None)
+    w.put_string("id", rng.choice(_ENTITIES))
+    _write_vec(w, "Pos", Tag.DOUBLE, [rng.uniform(-3e4, 3e4) for _ in range(3)])
+    _write_vec(w, "Motion", Tag.DOUBLE, [rng.uniform(-1, 1) for _ in range(3)])
+    _write_vec(w, "Rotation", Tag.FLOAT, [rng.uniform(-180, 180) for _ in range(2)])
+    w.put_float("Health", rng.uniform(0, 20))
+    w.put_float("FallDistance", 0.0)
+    w.put_short("Fire", -1)
+    w.put_short("Air", 300)
+    w.put_byte("OnGround", rng.randrange(2))
+    w.put_int_array("UUID", [rng.getrandbits(31) for _ in range(4)])
+    w.begin_list("ArmorItems", Tag.COMPOUND, 4)
+    for _ in range(4):
+        w.begin_compound(None)
+        if rng.random() < 0.3:
+            w.put_string("id", rng.choice(_ITEMS))
+            w.put_int("count", 1)
+        w.end_compound()
+    w.begin_list("attributes", Tag.COMPOUND, 2)
+    for name, base in (("minecraft:generic.max_health", 20.0), ("minecraft:generic.movement_speed", 0.25)):
+        w.begin_compound(None)
+        w.put_string("id", name)
+        w.put_double("base", base)
+        w.end_compound()
+    w.begin_compound("Brain")
+    w.begin_compound("memories")
+    w.end_compound()
+    w.end_compound()
+    w.end_compound()
+
+
+def gen_entities(rng: Random, count: int = 500) -> tuple[bytes, int]:
+    """
+    Generate an entity-heavy chunk (entities/*.mca chunk format)
+    """
+    w = NBTWriter()
+    w.begin_compound("")
+    w.put_int("DataVersion", DATA_VERSION)
+    w.put_int_array("Position", [rng.randrange(-1000, 1000), rng.randrange(-1000, 1000)])
+    w.begin_list("Entities", Tag.COMPOUND, count)
+    for _ in range(count):
+        _write_entity(w, rng)
+    w.end_compound()
+    return bytes(w.buffer), w.n_tags
+
+
+# =============================================================================
+# Structures
+# =============================================================================
+def gen_structure(rng: Random, size: list[int] | None = None, palette: int = 32) -> tuple[bytes, int]:
+    """
+    Generate a structure template (structure block .nbt format)
+    """
+    sx, sy, sz = size or [32, 32, 32]
+    w = NBTWriter()
+    w.begin_compound("")
+    w.put_int("DataVersion", DATA_VERSION)
+    w.begin_list("size", Tag.INT, 3)
+    for v in (sx, sy, sz):
+        w.put_int(None, v)
+
+    w.begin_list("palette", Tag.COMPOUND, palette)
+    for i in range(palette):
+        w.begin_compound(None)
+        w.put_string("Name", _BLOCKS[i % len(_BLOCKS)])
+        w.end_compound()
+
+    w.begin_list("blocks", Tag.COMPOUND, sx * sy * sz)
+    for x in range(sx):
+        for y in range(sy):
+            for z in range(sz):
+                w.begin_compound(None)
+                w.begin_list("pos", Tag.INT, 3)
+                w.put_int(None, x)
+                w.put_int(None, y)
+                w.put_int(None, z)
+                w.put_int("state", rng.randrange(palette))
+                w.end_compound()
+
+    w.begin_list("entities", Tag.COMPOUND, 0)
+    w.end_compound()
+    return bytes(w.buffer), w.n_tags
+
+
+# =============================================================================
+# Region files
+# =============================================================================
+def gen_region(rng: Random, chunks: int = 64, palette: int = 16, sections: int = 24) -> tuple[bytes, int]:
+    """
+    Generate a region file (.mca) holding `chunks` zlib-compressed chunk columns
+    """
+    locations = bytearray(SECTOR_SIZE)
+    timestamps = bytearray(SECTOR_SIZE)
+    body = bytearray()
+    n_tags = 0
+    for index in rng.sample(range(1024), min(chunks, 1024)):
+        w = NBTWriter()
+        _write_chunk(w, rng, index % 32, index // 32, palette, sections)
+        n_tags += w.n_tags
+
+        # Chunk payload: length, compression type (2 = zlib) & data
+        data = zlib.compress(bytes(w.buffer))
+        payload = struct.pack(">iB", len(data) + 1, 2) + data
+        payload += bytes(-len(payload) % SECTOR_SIZE)
+
+        offset = 2 + len(body) // SECTOR_SIZE
+        struct.pack_into(">I", locations, 4 * index, (offset << 8) | (len(payload) // SECTOR_SIZE))
+        struct.pack_into(">I", timestamps, 4 * index, rng.randrange(1 << 31))
+        body += payload
+    return bytes(locations + timestamps + body), n_tags
+
+
+# =============================================================================
+# Stress documents
+# =============================================================================
+def gen_nested(rng: Random, depth: int = 512) -> tuple[bytes, int]:
+    """
+    Generate a deeply nested document alternating compounds and lists
+    """
+    w = NBTWriter()
+    w.begin_compound("")
+    for level in range(depth):
+        if level % 2:
+            w.begin_list("list", Tag.COMPOUND, 1)
+            w.begin_compound(None)
+        else:
+            w.begin_compound("compound")
+        w.put_int("level", level)
+    w.put_long("leaf", rng.getrandbits(63))
+    for level in range(depth):
+        w.end_compound()
+    w.end_compound()
+    return bytes(w.buffer), w.n_tags
+
+
+def gen_wide(rng: Random, entries: int = 100000) -> tuple[bytes, int]:
+    """
+    Generate a very wide compound (many small entries of mixed types)
+    """
+    w = NBTWriter()
+    w.begin_compound("")
+    for i in range(entries):
+        match i % 4:
+            case 0:
+                w.put_int(f"int_{i}", rng.getrandbits(31))
+            case 1:
+                w.put_string(f"str_{i}", rng.choice(_ITEMS))
+            case 2:
+                w.put_double(f"double_{i}", rng.random())
+            case _:
+                w.put_byte(f"byte_{i}", rng.getrandbits(7))
+    w.end_compound()
+    return bytes(w.buffer), w.n_tags
+
+
+# =============================================================================
+_GENERATORS: dict[str, tuple[Callable[..., tuple[bytes, int]], str]] = {
+    "chunk": (gen_chunk, ".nbt"),
+    "entities": (gen_entities, ".nbt"),
+    "structure": (gen_structure, ".nbt"),
+    "region": (gen_region, ".mca"),
+    "nested": (gen_nested, ".nbt"),
+    "wide": (gen_wide, ".nbt"),
+}
@@ -0,0 +1,129 @@
+# =============================================================================
+# Project: SOLISMC-FILEIO
+#
+# Streaming writer of binary NBT documents
+#
+# Author    Meltwin (github@meltwin.fr)
+# Date      19/10/2026 (created 19/10/2026)
+# Version   1.0.0
+# Copyright Solis Forge | 2026
+#           Distributed under MIT License (https://opensource.org/licenses/MIT)
+# =============================================================================
+from enum import IntEnum
+from typing import Iterable
+import struct
+
+
+# =============================================================================
+class Tag(IntEnum):
+    """
+    NBT tags byte values
+    """
+
+    END = 0
+    BYTE = 1
+    SHORT = 2
+    INT = 3
+    LONG = 4
+    FLOAT = 5
+    DOUBLE = 6
+    BYTE_ARRAY = 7
+    STRING = 8
+    LIST = 9
+    COMPOUND = 10
+    INT_ARRAY = 11
+    LONG_ARRAY = 12
+
+
+# =============================================================================
+class NBTWriter:
+    """
+    Write a big-endian (JAVA) NBT document into a byte buffer.
+
+    Every method takes the name of the tag: a named tag is written with its
+    header (compound entry), while name=None writes the payload only (list
+    element).
+    """
+
+    def __init__(self) -> None:
+        self.buffer = bytearray()
+        self.n_tags = 0
+        """ Number of tags written (compound entries & list elements) """
+
+    # -------------------------------------------------------------------------
+    def _header(self, tag: Tag, name: str | None) -> None:
+        self.n_tags += 1
+        if name is not None:
+            self.buffer.append(tag)
+            self._str(name)
+
+    def _str(self, value: str) -> None:
+        raw = value.encode()
+        self.buffer += struct.pack(">H", len(raw))
+        self.buffer += raw
+
+    # -------------------------------------------------------------------------
+    # Primitives
+    # -------------------------------------------------------------------------
+    def put_byte(self, name: str | None, value: int) -> None:
+        self._header(Tag.BYTE, name)
+        self.buffer += struct.pack(">b", value)
+
+    def put_short(self, name: str | None, value: int) -> None:
+        self._header(Tag.SHORT, name)
+        self.buffer += struct.pack(">h", value)
+
+    def put_int(self, name: str | None, value: int) -> None:
+        self._header(Tag.INT, name)
+        self.buffer += struct.pack(">i", value)
+
+    def put_long(self, name: str | None, value: int) -> None:
+        self._header(Tag.LONG, name)
+        self.buffer += struct.pack(">q", value)
+
+    def put_float(self, name: str | None, value: float) -> None:
+        self._header(Tag.FLOAT, name)
+        self.buffer += struct.pack(">f", value)
+
+    def put_double(self, name: str | None, value: float) -> None:
+        self._header(Tag.DOUBLE, name)
+        self.buffer += struct.pack(">d", value)
+
+    def put_string(self, name: str | None, value: str) -> None:
+        self._header(Tag.STRING, name)
+        self._str(value)
+
+    # -------------------------------------------------------------------------
+    # Arrays
+    # -------------------------------------------------------------------------
+    def put_byte_array(self, name: str | None, values: bytes) -> None:
+        self._header(Tag.BYTE_ARRAY, name)
+        self.buffer += struct.pack(">i", len(values))
+        self.buffer += values
+
+    def put_int_array(self, name: str | None, values: Iterable[int]) -> None:
+        values = list(values)
+        self._header(Tag.INT_ARRAY, name)
+        self.buffer += struct.pack(f">i{len(values)}i", len(values), *values)
+
+    def put_long_array(self, name: str | None, values: Iterable[int]) -> None:
+        values = list(values)
+        self._header(Tag.LONG_ARRAY, name)
+        self.buffer += struct.pack(f">i{len(values)}q", len(values), *values)
+
+    # -------------------------------------------------------------------------
+    # Containers
+    # -------------------------------------------------------------------------
+    def begin_compound(self, name: str | None) -> None:
+        self._header(Tag.COMPOUND, name)
+
+    def end_compound(self) -> None:
+        self.buffer.append(Tag.END)
+
+    def begin_list(self, name: str | None, elem_tag: Tag, count: int) -> None:
+        """
+        Open a list, the caller must then write `count` unnamed elements
+        """
+        self._header(Tag.LIST, name)
+        self.buffer.append(Tag.END if count == 0 else elem_tag)
+        self.buffer += struct.pack(">i", count)
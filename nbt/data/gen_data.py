@@ -17,6 +17,7 @@ from solis.utils.types.patterns import LazyInit
 
 from _data_gen._reader import read_from_file
 from _data_gen._converter import generate_header
+from _data_gen._corpus import generate_corpora, generate_corpus_header, read_corpora
 
 LOGGER = LazyInit(lambda: getLogger("DataGenerator"))
 
@@ -50,6 +51,20 @@ def gen_data(input_d: Path, output_d: Path) -> None:
         process_file(file, output_d.joinpath(file.stem + ".hpp"))
 
 
+# =============================================================================
+def gen_corpora(
+    corpora_f: Path, output_d: Path, seed: int | None, scale: float
+) -> None:
+    """
+    Generate the binary corpora described in the YAML file, and the header
+    listing them
+    """
+    LOGGER().info(f"Building corpora from {corpora_f} in {output_d}")
+    entries = read_corpora(corpora_f, seed, scale)
+    files = generate_corpora(entries, output_d.joinpath("corpus"))
+    generate_corpus_header(files, output_d.joinpath("corpus.hpp"))
+
+
 # =============================================================================
 # =============================================================================
 # =============================================================================
@@ -64,6 +79,26 @@ if __name__ == "__main__":
     parser.add_argument(
         "output_folder", type=Path, help="Folder where to place generated headere files"
     )
+    parser.add_argument(
+        "--corpora",
+        type=Path,
+        default=None,
+        help="YAML file describing the binary corpora to generate",
+    )
+    parser.add_argument(
+        "--seed",
+        type=int,
+        default=None,
+        help="Override the random seed of the corpora description",
+    )
+    parser.add_argument(
+        "--scale",
+        type=float,
+        default=1.0,
+        help="Scale factor applied to the size parameters of the corpora",
+    )
     args = parser.parse_args()
 
     gen_data(args.input_folder, args.output_folder)
+    if args.corpora is not None:
+        gen_corpora(args.corpora, args.output_folder, args.seed, args.scale)
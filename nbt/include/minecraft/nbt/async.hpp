@@ -0,0 +1,297 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Coroutine-based asynchronous parsing of NBT documents
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_ASYNC_HPP
+#define SOLISMC_NBT_ASYNC_HPP
+
+#include "minecraft/nbt/reader.hpp"
+#include <algorithm>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace minecraft::nbt {
+
+// ============================================================================
+// Coroutine task
+// ============================================================================
+
+/**
+ * @brief Lazy coroutine producing a value of type T.
+ *
+ * The coroutine only starts when it is awaited by another coroutine (which is
+ * resumed when the task completes) or when start() is called. In the latter
+ * case, the task runs until its first suspension and is then resumed by
+ * whoever resumes the awaited operation (e.g. the byte source).
+ */
+template <typename T> class [[nodiscard]] Task {
+public:
+  struct promise_type;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  struct promise_type {
+    std::optional<T> value;
+    std::exception_ptr error;
+    std::coroutine_handle<> continuation;
+
+    /**
+     * @brief Resume the awaiting coroutine (if any) when the task completes
+     */
+    struct FinalAwaiter {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<> await_suspend(Handle h) const noexcept {
+        if (auto c = h.promise().continuation)
+          return c;
+        return std::noop_coroutine();
+      }
+      void await_resume() const noexcept {}
+    };
+
+    Task get_return_object() { return Task{Handle::from_promise(*this)}; }
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    template <std::convertible_to<T> U> void return_value(U &&v) {
+      value.emplace(std::forward<U>(v));
+    }
+    void unhandled_exception() { error = std::current_exception(); }
+  };
+
+  Task(Task &&other) noexcept
+      : handle_(std::exchange(other.handle_, {})),
+        started_(other.started_) {}
+  Task &operator=(Task &&other) noexcept {
+    if (this != &other) {
+      if (handle_)
+        handle_.destroy();
+      handle_ = std::exchange(other.handle_, {});
+      started_ = other.started_;
+    }
+    return *this;
+  }
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+  ~Task() {
+    if (handle_)
+      handle_.destroy();
+  }
+
+  /**
+   * @brief Run the coroutine until its first suspension (no-op if it already
+   * started)
+   */
+  inline void start() {
+    if (!started_) {
+      started_ = true;
+      handle_.resume();
+    }
+  }
+
+  /**
+   * @brief Whether the coroutine completed (with a value or an exception)
+   */
+  inline bool done() const { return handle_ && handle_.done(); }
+
+  /**
+   * @brief Move the produced value out of a completed task, rethrowing the
+   * exception the coroutine ended with.
+   */
+  T result() {
+    auto &promise = handle_.promise();
+    if (promise.error)
+      std::rethrow_exception(promise.error);
+    return std::move(*promise.value);
+  }
+
+  // Awaiting a task starts it, the awaiter being resumed on completion
+  bool await_ready() const noexcept { return done(); }
+  Handle await_suspend(std::coroutine_handle<> awaiting) noexcept {
+    started_ = true;
+    handle_.promise().continuation = awaiting;
+    return handle_;
+  }
+  T await_resume() { return result(); }
+
+private:
+  explicit Task(Handle handle) : handle_(handle) {}
+
+  Handle handle_;
+  bool started_ = false;
+};
+
+// ============================================================================
+// Byte sources
+// ============================================================================
+
+/**
+ * @brief Awaiter type whose result is a span of bytes
+ */
+template <typename A>
+concept BytesAwaiter = requires(A &a, std::coroutine_handle<> h) {
+  { a.await_ready() } -> std::convertible_to<bool>;
+  a.await_suspend(h);
+  { a.await_resume() } -> std::convertible_to<std::span<const StreamChar>>;
+};
+
+/**
+ * @brief Buffered source of bytes for the asynchronous parsers.
+ *
+ * - co_await fill(): the bytes available and not consumed yet, suspending
+ *   until some are available. An empty span means the end of the stream.
+ * - consume(n): drop the first n bytes returned by the last fill().
+ *
+ * The bytes returned by fill() stay valid until the next call on the source.
+ */
+template <typename S>
+concept ByteSource = requires(S &s, std::size_t n) {
+  { s.fill() } -> BytesAwaiter;
+  s.consume(n);
+};
+
+/**
+ * @brief Awaiter of bytes that are already available
+ */
+struct ReadyBytes {
+  std::span<const StreamChar> bytes;
+
+  bool await_ready() const noexcept { return true; }
+  void await_suspend(std::coroutine_handle<>) const noexcept {}
+  std::span<const StreamChar> await_resume() const noexcept { return bytes; }
+};
+
+/**
+ * @brief Byte source over a buffer held in memory, optionally delivered by
+ * chunks of at most chunk bytes (e.g. to mimic the packets of a socket).
+ */
+class MemorySource {
+public:
+  explicit MemorySource(std::span<const StreamChar> bytes,
+                        std::size_t chunk = SIZE_MAX)
+      : bytes_(bytes), chunk_(std::max<std::size_t>(chunk, 1)) {}
+
+  inline ReadyBytes fill() const {
+    return {bytes_.subspan(0, std::min(chunk_, bytes_.size()))};
+  }
+  inline void consume(std::size_t n) { bytes_ = bytes_.subspan(n); }
+
+private:
+  std::span<const StreamChar> bytes_;
+  std::size_t chunk_;
+};
+
+/**
+ * @brief Byte source fed by a producer (e.g. the network event loop).
+ *
+ * The coroutine waiting for bytes is resumed inline by push() and close(), so
+ * it runs on the producer thread: the source is not synchronized and must be
+ * used from a single thread at a time.
+ */
+class PushSource {
+public:
+  struct Awaiter {
+    PushSource &source;
+
+    bool await_ready() const noexcept {
+      return source.closed_ || source.available() > 0;
+    }
+    void await_suspend(std::coroutine_handle<> h) noexcept {
+      source.waiting_ = h;
+    }
+    std::span<const StreamChar> await_resume() const noexcept {
+      return {source.buffer_.data() + source.pos_, source.available()};
+    }
+  };
+
+  /**
+   * @brief Append bytes to the stream and resume the waiting coroutine
+   */
+  void push(std::span<const StreamChar> bytes);
+
+  /**
+   * @brief Mark the end of the stream and resume the waiting coroutine
+   */
+  void close();
+
+  inline Awaiter fill() { return {*this}; }
+  inline void consume(std::size_t n) { pos_ += n; }
+
+  /**
+   * @brief Number of bytes pushed and not consumed yet
+   */
+  inline std::size_t available() const { return buffer_.size() - pos_; }
+  inline bool is_closed() const { return closed_; }
+
+private:
+  void wake();
+
+  std::vector<StreamChar> buffer_;
+  std::size_t pos_ = 0; // First byte not consumed
+  bool closed_ = false;
+  std::coroutine_handle<> waiting_;
+};
+
+// ============================================================================
+// Asynchronous parsing
+// ============================================================================
+
+/**
+ * @brief Parse a whole (possibly compressed) document from a byte source,
+ * suspending whenever the source runs out of bytes.
+ *
+ * Only the bytes of the document are consumed, so that the next documents of
+ * the stream can be parsed by the next calls. The source and the reader must
+ * outlive the returned task.
+ *
+ * @return the root tag, nothing if the document is invalid or the stream
+ * ends before its end
+ */
+template <ByteSource S>
+Task<std::optional<Tag>> async_parse(S &source, Reader &reader) {
+  reader.reset();
+  while (true) {
+    const std::span<const StreamChar> bytes = co_await source.fill();
+    if (bytes.empty())
+      co_return std::nullopt;
+
+    const StreamChar *strm = bytes.data();
+    unsigned long N = bytes.size();
+    const auto ret = reader.parse(strm, N);
+    source.consume(bytes.size() - N);
+    if (ret == ParseResult::SUCCESS)
+      co_return reader.take();
+    if (ret == ParseResult::FAILED)
+      co_return std::nullopt;
+  }
+}
+
+/**
+ * @brief Parse a whole (possibly compressed) document from a byte source with
+ * a reader of its own.
+ *
+ * @param resource memory resource the tree is allocated from
+ */
+template <ByteSource S>
+Task<std::optional<Tag>> async_parse(
+    S &source,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+  Reader reader{resource};
+  co_return co_await async_parse(source, reader);
+}
+
+} // namespace minecraft::nbt
+
+#endif
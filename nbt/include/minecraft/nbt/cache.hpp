@@ -0,0 +1,281 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Bounded caches of decoded and compressed chunks
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_CACHE_HPP
+#define SOLISMC_NBT_CACHE_HPP
+
+#include "minecraft/nbt/region.hpp"
+#include "minecraft/nbt/tag.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Coordinates of a chunk in a world
+ */
+struct ChunkKey {
+  int32_t dimension; // Index of the dimension, as chosen by the server
+  int32_t x;
+  int32_t z;
+
+  bool operator==(const ChunkKey &) const = default;
+  auto operator<=>(const ChunkKey &) const = default;
+};
+
+struct ChunkKeyHash {
+  std::size_t operator()(const ChunkKey &key) const noexcept;
+};
+
+/**
+ * @brief Source of the chunks missing from a cache
+ *
+ * @param resource memory resource the tree must be allocated from
+ * @return the root tag of the chunk, nothing if it doesn't exist or can't be
+ * read
+ */
+using ChunkLoader = std::function<std::optional<Tag>(
+    const ChunkKey &key, std::pmr::memory_resource *resource)>;
+
+/**
+ * @brief Loader of the chunks from the region files of a world
+ *
+ * The last used regions are kept open (the least recently used one being
+ * closed when there are too many). The loader can be called from several
+ * threads: the reads of a region are serialized, those of different regions
+ * are not. It is given to a cache by reference (std::ref).
+ */
+class RegionLoader {
+public:
+  /**
+   * @param dimensions region directory of each dimension (e.g.
+   * "world/region", "world/DIM-1/region", ...)
+   * @param max_open maximum number of region files kept open
+   */
+  explicit RegionLoader(std::vector<std::filesystem::path> dimensions,
+                        std::size_t max_open = 64);
+
+  std::optional<Tag> operator()(const ChunkKey &key,
+                                std::pmr::memory_resource *resource);
+
+private:
+  struct Region {
+    std::mutex mutex;
+    bool opened = false;
+    std::optional<RegionFile> file; // Nothing if the file doesn't exist
+    uint64_t last_use = 0;
+  };
+  using RegionKey = std::tuple<int32_t, int32_t, int32_t>;
+
+  std::shared_ptr<Region> get_region(const RegionKey &key);
+
+  std::vector<std::filesystem::path> dimensions_;
+  std::size_t max_open_;
+  std::mutex mutex_;
+  std::map<RegionKey, std::shared_ptr<Region>> regions_;
+  uint64_t uses_ = 0;
+};
+
+/**
+ * @brief Configuration of a chunk cache
+ */
+struct CacheOptions {
+  std::size_t budget = 256 << 20; // Bytes of decoded chunks kept in memory
+  std::size_t n_shards = 16;      // Independently locked parts of the cache
+  // Called (out of the locks) with each chunk evicted to stay under the
+  // budget, e.g. to keep it in a CompressedTier
+  std::function<void(const ChunkKey &key, const Tag &chunk)> on_evict{};
+};
+
+/**
+ * @brief Counters of a chunk cache
+ */
+struct CacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;    // Lookups that called the loader
+  uint64_t evictions = 0; // Chunks evicted to stay under the budget
+  std::size_t entries = 0;
+  std::size_t bytes = 0; // Bytes of the cached chunks
+};
+
+/**
+ * @brief Cache of decoded chunks under a memory budget.
+ *
+ * The chunks are split between shards by their coordinates, each shard being
+ * locked independently and evicting its chunks with the CLOCK algorithm (an
+ * approximation of LRU) when it exceeds its share of the budget.
+ *
+ * Each chunk is parsed into its own arena, so that its size is the memory the
+ * parser actually allocated for it. The chunks are shared with the callers:
+ * an evicted chunk stays alive until its last user releases it.
+ */
+class ChunkCache {
+public:
+  explicit ChunkCache(ChunkLoader loader, CacheOptions options = {});
+  ~ChunkCache();
+  ChunkCache(const ChunkCache &) = delete;
+  ChunkCache &operator=(const ChunkCache &) = delete;
+
+  /**
+   * @brief Get a chunk, loading it on a cache miss.
+   *
+   * The loader is called without any lock held: concurrent misses of the same
+   * chunk may load it several times, only one copy being cached.
+   *
+   * @return the chunk, nullptr if the loader couldn't provide it
+   */
+  std::shared_ptr<const Tag> get(const ChunkKey &key);
+
+  /**
+   * @brief Get a chunk if it is cached, without loading it
+   */
+  std::shared_ptr<const Tag> find(const ChunkKey &key);
+
+  /**
+   * @brief Drop a chunk (e.g. when it has been modified)
+   *
+   * @return whether the chunk was cached
+   */
+  bool erase(const ChunkKey &key);
+
+  /**
+   * @brief Drop every chunk
+   */
+  void clear();
+
+  CacheStats get_stats() const;
+
+private:
+  struct Shard;
+
+  Shard &shard(const ChunkKey &key);
+
+  ChunkLoader loader_;
+  std::function<void(const ChunkKey &, const Tag &)> on_evict_;
+  std::size_t shard_budget_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+// ============================================================================
+// Compressed tier
+// ============================================================================
+
+/**
+ * @brief Configuration of a compressed chunk tier
+ */
+struct TierOptions {
+  std::size_t budget = 64 << 20; // Bytes of compressed chunks kept in memory
+  std::size_t n_shards = 16;     // Independently locked parts of the tier
+};
+
+/**
+ * @brief Counters of a compressed chunk tier
+ */
+struct TierStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0; // Chunks evicted to stay under the budget
+  std::size_t entries = 0;
+  std::size_t bytes = 0;     // Bytes of the compressed chunks
+  std::size_t raw_bytes = 0; // Serialized size of the same chunks
+
+  double hit_rate() const {
+    return hits + misses == 0
+               ? 0.0
+               : static_cast<double>(hits) / static_cast<double>(hits + misses);
+  }
+  double ratio() const {
+    return bytes == 0 ? 0.0
+                      : static_cast<double>(raw_bytes) /
+                            static_cast<double>(bytes);
+  }
+};
+
+/**
+ * @brief Tier of recently unloaded chunks, kept as LZ4-compressed NBT.
+ *
+ * It sits between a ChunkCache and the disk: reloading a chunk from it is a
+ * LZ4 decompression and a parse, instead of a region read and an inflate.
+ * The chunks are evicted with the CLOCK algorithm under a budget of
+ * compressed bytes, the tier being sharded like the cache.
+ *
+ * The tier is fed with the chunks evicted from a cache (CacheOptions::on_evict)
+ * or unloaded by the server, and used as the cache loader through over(). The
+ * chunks modified since they were put must be erased from it.
+ */
+class CompressedTier {
+public:
+  explicit CompressedTier(TierOptions options = {});
+  ~CompressedTier();
+  CompressedTier(const CompressedTier &) = delete;
+  CompressedTier &operator=(const CompressedTier &) = delete;
+
+  /**
+   * @brief Keep a chunk, replacing its previous version
+   */
+  void put(const ChunkKey &key, const Tag &chunk);
+
+  /**
+   * @brief Keep an already serialized (uncompressed) chunk
+   */
+  void put(const ChunkKey &key, std::span<const StreamChar> document);
+
+  /**
+   * @brief Decode a chunk if it is kept (it stays in the tier)
+   *
+   * @param resource memory resource the tree is allocated from
+   */
+  std::optional<Tag> get(
+      const ChunkKey &key,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief Drop a chunk (e.g. when it has been modified)
+   *
+   * @return whether the chunk was kept
+   */
+  bool erase(const ChunkKey &key);
+
+  /**
+   * @brief Drop every chunk
+   */
+  void clear();
+
+  /**
+   * @brief Loader looking up the tier first, then calling the fallback
+   * (e.g. a RegionLoader) on a miss. The tier must outlive it.
+   */
+  ChunkLoader over(ChunkLoader fallback);
+
+  TierStats get_stats() const;
+
+private:
+  struct Shard;
+
+  Shard &shard(const ChunkKey &key);
+
+  std::size_t shard_budget_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace minecraft::nbt
+
+#endif
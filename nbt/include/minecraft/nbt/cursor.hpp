@@ -0,0 +1,167 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Pull parsing of NBT documents: a cursor over their tokens
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_CURSOR_HPP
+#define SOLISMC_NBT_CURSOR_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/types.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Kind of a token of a document
+ */
+enum class TokenKind : uint8_t {
+  VALUE, // Scalar, string or array
+  BEGIN, // Start of a compound or a list, followed by its content
+  END,   // End of the last begun compound or list
+};
+
+/**
+ * @brief Token of a document, viewing its bytes
+ */
+struct Token {
+  TokenKind kind = TokenKind::VALUE;
+  Tags tag = Tags::END;      // Of the value (for END, of the container)
+  std::string_view name{};   // Of the root & compound entries
+  Tags elem_tag = Tags::END; // Of the elements of a list
+  uint32_t size = 0;         // Elements of a list or an array
+  // Bytes of a scalar, of a string (without its length) or of the elements
+  // of an array
+  std::span<const StreamChar> payload{};
+
+  /**
+   * @brief Decode a scalar (int8_t ... int64_t, float, double) or a string
+   * (std::string_view of its raw bytes) of the matching type
+   */
+  template <typename T> T get() const;
+
+  /**
+   * @brief Decode the element of an array (int8_t, int32_t or int64_t)
+   */
+  template <typename T> T at(std::size_t i) const;
+};
+
+/**
+ * @brief Cursor over the tokens of a whole document held in memory.
+ *
+ * The tokens are produced one at a time: the caller decodes the values it
+ * needs and skips the subtrees it doesn't. Nothing is allocated, the open
+ * containers being kept in a fixed stack (deeper documents are invalid).
+ *
+ * The cursor is a range of tokens, skip_value() being usable during the
+ * iteration:
+ * @code
+ * for (const auto &token : cursor)
+ *   if (token.kind == TokenKind::BEGIN && token.name == "Entities")
+ *     cursor.skip_value();
+ * @endcode
+ */
+class Cursor {
+public:
+  // Maximum nesting of compounds and lists
+  static constexpr std::size_t MAX_DEPTH{512};
+
+  explicit Cursor(std::span<const StreamChar> document)
+      : document_(document) {}
+
+  /**
+   * @brief Produce the next token
+   *
+   * @return the token, nothing at the end of the document or if it is
+   * invalid (see failed())
+   */
+  std::optional<Token> next();
+
+  /**
+   * @brief Skip the content of the compound or list whose BEGIN token was
+   * just produced (its END token included)
+   *
+   * @return the payload of the skipped container, nothing if the document is
+   * invalid or the last token doesn't begin a container
+   */
+  std::optional<std::span<const StreamChar>> skip_value();
+
+  /**
+   * @brief Number of open compounds and lists
+   */
+  inline std::size_t depth() const { return depth_; }
+
+  /**
+   * @brief Whether the document is invalid
+   */
+  inline bool failed() const { return failed_; }
+
+  // ==========================================================================
+  // Range of tokens
+  // ==========================================================================
+
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Token;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(Cursor *cursor) : cursor_(cursor) { ++*this; }
+
+    inline const Token &operator*() const { return *token_; }
+    inline const Token *operator->() const { return &*token_; }
+    inline iterator &operator++() {
+      token_ = cursor_->next();
+      return *this;
+    }
+    inline void operator++(int) { ++*this; }
+    inline bool operator==(std::default_sentinel_t) const {
+      return !token_.has_value();
+    }
+
+  private:
+    Cursor *cursor_ = nullptr;
+    std::optional<Token> token_;
+  };
+
+  inline iterator begin() { return iterator{this}; }
+  inline std::default_sentinel_t end() const { return {}; }
+
+private:
+  /**
+   * @brief Open compound or list
+   */
+  struct Frame {
+    Tags tag;           // Compound or List
+    Tags elem_tag;      // Of a list
+    uint32_t remaining; // Elements of a list
+    std::size_t start;  // Position of its payload
+  };
+
+  std::nullopt_t fail();
+
+  std::span<const StreamChar> document_;
+  std::size_t pos_ = 0;
+  bool started_ = false;
+  bool failed_ = false;
+  bool begun_ = false; // Whether the last token is a BEGIN
+  std::size_t depth_ = 0;
+  std::array<Frame, MAX_DEPTH> stack_;
+};
+
+} // namespace minecraft::nbt
+
+#endif
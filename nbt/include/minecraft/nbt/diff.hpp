@@ -0,0 +1,117 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Structural diff and patch of NBT documents
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_DIFF_HPP
+#define SOLISMC_NBT_DIFF_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/tag.hpp"
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Step of a path in a tree: a compound entry name or a list index
+ */
+using PathStep = std::variant<std::string, uint32_t>;
+using Path = std::vector<PathStep>;
+
+/**
+ * @brief Edition of a patch
+ */
+enum class PatchOp : uint8_t {
+  SET,      // Set (add or replace) the value at the path, an added compound
+            // entry being inserted at position `offset`
+  REMOVE,   // Remove the compound entry at the path
+  TRUNCATE, // Shrink the list or array at the path to `offset` elements
+  SPLICE,   // Replace `length` elements of the array at the path from
+            // `offset` by the elements of the payload
+};
+
+/**
+ * @brief An edition of a tree
+ *
+ * The values are kept as the NBT payload bytes found in the new document, so
+ * that diffing never builds a tree:
+ *  - SET: payload of a value of the given tag type
+ *  - SPLICE: the inserted elements of the array, without their count
+ */
+struct PatchEntry {
+  PatchOp op{PatchOp::SET};
+  Path path{};
+  Tags tag{Tags::END};
+  uint32_t offset = 0;
+  uint32_t length = 0;
+  std::vector<StreamChar> payload{};
+
+  bool operator==(const PatchEntry &) const = default;
+};
+
+/**
+ * @brief Editions turning a document into another one
+ */
+struct Patch {
+  std::optional<std::string> name; // New name of the root tag, if changed
+  std::vector<PatchEntry> entries;
+
+  inline bool empty() const { return !name && entries.empty(); }
+
+  /**
+   * @brief Apply the patch to the tree of the old document, turning it into
+   * the tree of the new one
+   *
+   * @param resource memory resource the new values are allocated from
+   * @return false if the patch doesn't match the tree (the tree may then be
+   * partially patched)
+   */
+  bool apply(Tag &root, std::pmr::memory_resource *resource =
+                            std::pmr::get_default_resource()) const;
+
+  /**
+   * @brief Serialize the patch in a compact binary form
+   */
+  std::vector<StreamChar> encode() const;
+
+  /**
+   * @brief Read a patch serialized with encode()
+   *
+   * @return the patch, nothing if the bytes are not a valid patch
+   */
+  static std::optional<Patch> decode(std::span<const StreamChar> bytes);
+
+  bool operator==(const Patch &) const = default;
+};
+
+/**
+ * @brief Compare two (uncompressed) documents.
+ *
+ * Both documents are walked directly from their bytes: subtrees whose bytes
+ * are equal are skipped with a single memcmp, and only the diverging ones are
+ * descended into. Arrays are compared element-wise and produce range editions.
+ * The patched tree is written as new_doc byte for byte: the added entries are
+ * inserted at their position, and the compounds whose common entries were
+ * reordered are replaced as a whole.
+ *
+ * @return the patch turning old_doc into new_doc, nothing if a document is
+ * invalid
+ */
+std::optional<Patch> diff(std::span<const StreamChar> old_doc,
+                          std::span<const StreamChar> new_doc);
+
+} // namespace minecraft::nbt
+
+#endif
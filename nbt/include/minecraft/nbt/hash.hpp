@@ -0,0 +1,74 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Content hashing of NBT documents and trees
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_HASH_HPP
+#define SOLISMC_NBT_HASH_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/tag.hpp"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace minecraft::nbt {
+
+using Hash = uint64_t;
+
+/**
+ * @brief XXH64 of the given bytes
+ */
+Hash hash_bytes(std::span<const StreamChar> bytes, uint64_t seed = 0);
+
+/**
+ * @brief Hash of a list or compound found while hashing a document
+ */
+struct SubtreeHash {
+  uint32_t offset; // Offset of the payload in the hashed bytes
+  uint32_t size;   // Size of the payload
+  Tags tag;
+  Hash hash;
+};
+
+/**
+ * @brief Canonical hash of a value, computed from its payload bytes without
+ * building a tree.
+ *
+ * The hash only depends on the content: the entries of the compounds are
+ * combined regardless of their order, so that two documents hash the same
+ * when their trees are equal, and the hash can be computed from a tree with
+ * hash(const Tag&). The names of the root tags are not hashed.
+ *
+ * @param subtrees if given, the hashes of the lists & compounds are appended
+ * to it, parents before their children
+ * @return the hash, nothing if the payload is invalid, has trailing bytes, is
+ * nested too deeply or has a compound with duplicated names (the parsed tree
+ * would only keep the last entry)
+ */
+std::optional<Hash> hash_payload(Tags tag, std::span<const StreamChar> payload,
+                                 std::vector<SubtreeHash> *subtrees = nullptr);
+
+/**
+ * @brief Canonical hash of the root value of an (uncompressed) document
+ *
+ * @see hash_payload
+ */
+std::optional<Hash> hash_document(std::span<const StreamChar> document,
+                                  std::vector<SubtreeHash> *subtrees = nullptr);
+
+/**
+ * @brief Canonical hash of a tree, equal to the hash of its documents
+ */
+Hash hash(const Tag &tag);
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,72 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// One-shot decompression of whole DEFLATE streams (raw, zlib or gzip)
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_INFLATE_HPP
+#define SOLISMC_NBT_INFLATE_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Result of a one-shot decompression
+ */
+enum class InflateResult : uint8_t {
+  SUCCESS,
+  SHORT_OUTPUT, // The output buffer is too small for the decompressed bytes
+  BAD_DATA,     // Invalid or truncated stream, or checksum mismatch
+};
+
+/**
+ * @brief Decompress a whole raw DEFLATE stream in a single call.
+ *
+ * Unlike zlib's inflate, the decompressor keeps no state between calls: the
+ * whole input must be available and the output written to a buffer large
+ * enough for the whole result, which lets it decode without the bound checks
+ * & window copies of a streaming decompressor.
+ *
+ * @param n_in set to the bytes of the stream (the input may have more)
+ * @param n_out set to the decompressed bytes on success
+ */
+InflateResult inflate_raw(std::span<const StreamChar> in,
+                          std::span<StreamChar> out, std::size_t &n_in,
+                          std::size_t &n_out);
+
+/**
+ * @brief Decompress a whole zlib or gzip stream (detected from its header) in
+ * a single call, checking its checksum
+ *
+ * @param n_out set to the decompressed bytes on success
+ */
+InflateResult inflate_oneshot(std::span<const StreamChar> in,
+                              std::span<StreamChar> out, std::size_t &n_out);
+
+/**
+ * @brief Decompress a whole zlib or gzip stream, replacing the content of out.
+ *
+ * The stream is decompressed in one shot into a buffer sized from the exact
+ * size of the gzip trailer, else from size_hint or the size of out's last
+ * content. If that guess is too small, it falls back to a streaming zlib
+ * inflate growing the buffer as needed.
+ *
+ * @param size_hint expected decompressed size, 0 if unknown
+ * @return false if the stream is invalid
+ */
+bool inflate_all(std::span<const StreamChar> in, std::vector<StreamChar> &out,
+                 std::size_t size_hint = 0);
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,111 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Batch loader of many (small) NBT files
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_LOADER_HPP
+#define SOLISMC_NBT_LOADER_HPP
+
+#include "minecraft/nbt/reader.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief I/O backend of the batch loader
+ */
+enum class LoadBackend : uint8_t {
+  AUTO,     // io_uring when available, threads otherwise
+  IO_URING, // Linux io_uring (opens, stats, reads and closes in batches)
+  THREADS,  // Pool of threads reading and parsing the files
+};
+
+/**
+ * @brief Options of the batch loader
+ */
+struct LoadOptions {
+  LoadBackend backend = LoadBackend::AUTO;
+  unsigned queue_depth = 64; // Files in flight (io_uring)
+  unsigned n_threads = 0;    // Size of the pool, 0 for one per core (threads)
+
+  // Memory resource the trees are allocated from. With the threads backend it
+  // is used concurrently by the workers, so it must be thread-safe.
+  std::pmr::memory_resource *resource = std::pmr::get_default_resource();
+};
+
+/**
+ * @brief Called once per file with its index in the batch and its root tag
+ * (nothing if the file can't be read or is invalid)
+ */
+using LoadCallback = std::function<void(std::size_t, std::optional<Tag>)>;
+
+/**
+ * @brief Loader of batches of (possibly compressed) NBT files, e.g. the
+ * playerdata, stats and data files of a world.
+ *
+ * With io_uring, the opens, reads and closes of the whole batch are submitted
+ * to the kernel in a few system calls, and each file is inflated and parsed on
+ * the calling thread as soon as its bytes are read, while the next files are
+ * being read. Otherwise, a pool of threads reads and parses the files.
+ */
+class BatchLoader {
+public:
+  /**
+   * @throw std::system_error if io_uring is explicitly requested but can't be
+   * used
+   */
+  explicit BatchLoader(const LoadOptions &options = {});
+  ~BatchLoader();
+  BatchLoader(const BatchLoader &) = delete;
+  BatchLoader &operator=(const BatchLoader &) = delete;
+
+  /**
+   * @brief Load every file of the batch, in any order
+   *
+   * @param on_loaded called for every file, from the calling thread with
+   * io_uring but concurrently from the workers with the threads backend
+   */
+  void load(std::span<const std::filesystem::path> paths,
+            const LoadCallback &on_loaded);
+
+  /**
+   * @brief Load every file of the batch
+   *
+   * @return the root tags, in the order of the paths
+   */
+  std::vector<std::optional<Tag>>
+  load(std::span<const std::filesystem::path> paths);
+
+  /**
+   * @brief Get the backend actually used by the loader
+   */
+  LoadBackend get_backend() const { return backend_; }
+
+private:
+  void load_threads(std::span<const std::filesystem::path>,
+                    const LoadCallback &);
+
+  struct Ring;
+
+  LoadOptions options_;
+  LoadBackend backend_;
+  std::unique_ptr<Ring> ring_;
+};
+
+} // namespace minecraft::nbt
+
+#endif
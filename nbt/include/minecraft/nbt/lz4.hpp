@@ -0,0 +1,71 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// LZ4 block compression
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_LZ4_HPP
+#define SOLISMC_NBT_LZ4_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Maximum size of the LZ4 block of an input of the given size
+ */
+constexpr std::size_t lz4_bound(std::size_t size) {
+  return size + size / 255 + 16;
+}
+
+/**
+ * @brief Compress bytes into a single LZ4 block (raw block format, without
+ * frame nor size header), replacing the content of out.
+ */
+void lz4_compress(std::span<const StreamChar> input,
+                  std::vector<StreamChar> &out);
+
+/**
+ * @brief Decompress a LZ4 block whose decompressed size is known
+ *
+ * @param out buffer of the decompressed size
+ * @return false if the block is invalid or doesn't decompress to exactly
+ * out.size() bytes
+ */
+bool lz4_decompress(std::span<const StreamChar> block,
+                    std::span<StreamChar> out);
+
+/**
+ * @brief Compress bytes into a LZ4 block stream, replacing the content of out.
+ *
+ * The stream is the one of the LZ4BlockOutputStream of lz4-java, used by the
+ * LZ4-compressed chunks: blocks of up to block_size bytes, each with a 21
+ * bytes header ("LZ4Block" magic, method & level, compressed & original
+ * sizes, XXH32 checksum), the incompressible ones being stored raw, and an
+ * empty block ending the stream.
+ *
+ * @param block_size power of two from 64 bytes to 32 MB
+ */
+void lz4_stream_compress(std::span<const StreamChar> input,
+                         std::vector<StreamChar> &out,
+                         std::size_t block_size = 1 << 16);
+
+/**
+ * @brief Decompress a LZ4 block stream, replacing the content of out
+ *
+ * @return false if the stream is invalid, truncated or a checksum mismatches
+ */
+bool lz4_stream_decompress(std::span<const StreamChar> stream,
+                           std::vector<StreamChar> &out);
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,99 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Conversions between the Modified UTF-8 of the NBT strings and UTF-8
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_MUTF8_HPP
+#define SOLISMC_NBT_MUTF8_HPP
+
+#include "minecraft/nbt/tag.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+namespace minecraft::nbt {
+
+// ============================================================================
+// Strings
+// ============================================================================
+//
+// The NBT strings are encoded in Java's Modified UTF-8 (MUTF-8): NUL is
+// written as the overlong C0 80, and the characters out of the BMP as their
+// UTF-16 surrogate pair, each surrogate encoded on 3 bytes. The strings parsed
+// from a document hold these bytes as is; the functions below convert them
+// from & to the standard UTF-8.
+//
+// The ASCII characters (but NUL) being identical in both encodings, the runs
+// of ASCII bytes are found 16 at a time and copied straight through.
+
+/**
+ * @brief Length of the run of ASCII bytes (0x01 to 0x7F) starting the string
+ */
+std::size_t ascii_prefix(std::string_view str);
+
+/**
+ * @brief Whether the string is valid MUTF-8 that can be converted to UTF-8
+ * (no 4-bytes sequences nor unpaired surrogates)
+ */
+bool is_valid_mutf8(std::string_view str);
+
+/**
+ * @brief Whether the string is valid UTF-8 (no overlong sequences, surrogates
+ * nor code points over U+10FFFF)
+ */
+bool is_valid_utf8(std::string_view str);
+
+/**
+ * @brief Convert a MUTF-8 string to UTF-8, replacing the content of out
+ *
+ * @return false if the string is not valid MUTF-8 (out is then unspecified)
+ */
+template <typename A>
+bool mutf8_to_utf8(std::string_view in,
+                   std::basic_string<char, std::char_traits<char>, A> &out);
+
+/**
+ * @brief Convert a UTF-8 string to MUTF-8, replacing the content of out
+ *
+ * @return false if the string is not valid UTF-8 (out is then unspecified)
+ */
+template <typename A>
+bool utf8_to_mutf8(std::string_view in,
+                   std::basic_string<char, std::char_traits<char>, A> &out);
+
+extern template bool mutf8_to_utf8(std::string_view, std::string &);
+extern template bool mutf8_to_utf8(std::string_view, std::pmr::string &);
+extern template bool utf8_to_mutf8(std::string_view, std::string &);
+extern template bool utf8_to_mutf8(std::string_view, std::pmr::string &);
+
+// ============================================================================
+// Trees
+// ============================================================================
+
+/**
+ * @brief Convert the strings and names of a parsed tree to UTF-8, in place
+ *
+ * @return false if one of them is not valid MUTF-8, or if two names of a
+ * compound become the same (the tree is then partially converted)
+ */
+bool tree_to_utf8(Tag &root);
+
+/**
+ * @brief Convert the strings and names of a tree to MUTF-8 before writing it,
+ * in place
+ *
+ * @return false if one of them is not valid UTF-8 (the tree is then partially
+ * converted)
+ */
+bool tree_to_mutf8(Tag &root);
+
+} // namespace minecraft::nbt
+
+#endif
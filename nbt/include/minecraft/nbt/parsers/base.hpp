@@ -12,7 +12,12 @@
 #ifndef SOLISMC_NBT_PARSER_BASE_HPP
 #define SOLISMC_NBT_PARSER_BASE_HPP
 
+#include <compare>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <type_traits>
 
 namespace minecraft::nbt {
 
@@ -91,28 +96,102 @@ template <typename T> struct BytesParser {
  * @param inc how many bytes we should move forward in the stream
  */
 inline void inc_stream(const StreamChar *&strm, unsigned long &N,
-                       unsigned int inc = 1) {
+                       unsigned long inc = 1) {
   strm += inc;
   N -= inc;
 }
 
-// ============================================================================
-// Parsing utility functions
-// ============================================================================
+/**
+ * @brief Decode a whole integral value from a stream holding at least
+ * sizeof(T) bytes.
+ *
+ * @tparam IS_BIG_ENDIAN whether the value is stored as big-endian (JAVA) or
+ * little-endian (BEDROCK)
+ * @param strm the stream to read the value from
+ */
+template <std::integral T, bool IS_BIG_ENDIAN>
+inline T load_integral(const StreamChar *strm) {
+  using U = std::make_unsigned_t<T>;
+  U value{0};
+  for (std::size_t i = 0; i < sizeof(T); i++) {
+    if constexpr (IS_BIG_ENDIAN)
+      value |= static_cast<U>(static_cast<U>(strm[i])
+                              << ((sizeof(T) - i - 1) * BIT_PER_BYTES));
+    else
+      value |= static_cast<U>(static_cast<U>(strm[i]) << (i * BIT_PER_BYTES));
+  }
+  return static_cast<T>(value);
+}
 
-#define NBT_PARSE_N_BYTE_BEGIN()                                               \
-  if (N <= 0)                                                                  \
-    return ParseResult::UNFINISHED;                                            \
-  do {
-#define NBT_PARSE_N_BYTE_END(curr_byte, len)                                   \
-  curr_byte++;                                                                 \
-  inc_stream(strm, N);                                                         \
-  }                                                                            \
-  while (N > 0 && curr_byte < len)                                             \
-    ;                                                                          \
-  if (curr_byte != len) {                                                      \
-    return ParseResult::UNFINISHED;                                            \
+/**
+ * @brief Encode a whole integral value into a stream holding at least
+ * sizeof(T) bytes (inverse of load_integral).
+ */
+template <std::integral T, bool IS_BIG_ENDIAN>
+inline void store_integral(StreamChar *strm, T value) {
+  using U = std::make_unsigned_t<T>;
+  const auto bits = static_cast<U>(value);
+  for (std::size_t i = 0; i < sizeof(T); i++) {
+    if constexpr (IS_BIG_ENDIAN)
+      strm[i] = static_cast<StreamChar>(
+          bits >> ((sizeof(T) - i - 1) * BIT_PER_BYTES));
+    else
+      strm[i] = static_cast<StreamChar>(bits >> (i * BIT_PER_BYTES));
   }
+}
+
+/**
+ * @brief Random-access iterator decoding consecutive integral values from a
+ * stream, so that a whole run of values can be appended to a container at
+ * once (without initializing the elements first).
+ */
+template <std::integral T, bool IS_BIG_ENDIAN> struct DecodeIterator {
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T *;
+  using reference = T;
+
+  const StreamChar *strm;
+
+  inline T operator*() const { return load_integral<T, IS_BIG_ENDIAN>(strm); }
+  inline T operator[](difference_type i) const { return *(*this + i); }
+
+  inline DecodeIterator &operator++() {
+    strm += sizeof(T);
+    return *this;
+  }
+  inline DecodeIterator operator++(int) {
+    auto it = *this;
+    ++*this;
+    return it;
+  }
+  inline DecodeIterator &operator--() {
+    strm -= sizeof(T);
+    return *this;
+  }
+  inline DecodeIterator operator--(int) {
+    auto it = *this;
+    --*this;
+    return it;
+  }
+  inline DecodeIterator &operator+=(difference_type n) {
+    strm += n * static_cast<difference_type>(sizeof(T));
+    return *this;
+  }
+  inline DecodeIterator operator+(difference_type n) const {
+    auto it = *this;
+    return it += n;
+  }
+  inline DecodeIterator &operator-=(difference_type n) { return *this += -n; }
+  inline DecodeIterator operator-(difference_type n) const {
+    return *this + -n;
+  }
+  inline difference_type operator-(const DecodeIterator &other) const {
+    return (strm - other.strm) / static_cast<difference_type>(sizeof(T));
+  }
+  inline auto operator<=>(const DecodeIterator &other) const = default;
+};
 
 } // namespace minecraft::nbt
 
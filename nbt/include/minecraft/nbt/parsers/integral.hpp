@@ -14,11 +14,16 @@
 
 #include "minecraft/nbt/parsers/base.hpp"
 #include <concepts>
+#include <cstdint>
 
 namespace minecraft::nbt {
 
 /**
  * @brief ByteParser specialization for integral types.
+ *
+ * Values are decoded in place from the stream. Only a value split between two
+ * buffers has its first bytes kept in a small carry buffer, and is completed
+ * from there by the next call.
  */
 template <std::integral T> struct BytesParser<T> {
 
@@ -28,15 +33,15 @@ template <std::integral T> struct BytesParser<T> {
 
   inline void reset() {
     value_ = 0;
-    n_bytes = 0;
+    n_carry_ = 0;
   }
 
-  inline bool is_parsed() const { return n_bytes == 0; }
+  inline bool is_parsed() const { return n_carry_ == 0; }
 
 private:
-  T value_;
-  std::size_t n_bytes = 0;
-  static constexpr auto TYPE_LENGTH{sizeof(T)};
+  T value_{0};
+  StreamChar carry_[sizeof(T)]; // Bytes of a value split between buffers
+  uint8_t n_carry_ = 0;
 };
 
 // ============================================================================
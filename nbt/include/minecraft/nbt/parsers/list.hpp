@@ -15,41 +15,77 @@
 #include "minecraft/nbt/parsers/integral.hpp"
 #include <bitset>
 #include <cstdint>
-#include <memory>
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
 namespace minecraft::nbt {
 
 /**
- * @brief Parser implementation for std::vector
+ * @brief Parser implementation for std::vector. The parsed vectors are
+ * allocated with the allocator given at construction, e.g. a
+ * std::pmr::polymorphic_allocator for std::pmr::vector.
+ *
+ * The parser owns the vector it fills: its capacity is kept from one parsing
+ * to the next, so that a reused parser stops allocating once its buffer is
+ * large enough. The vector can be read in place with get(), or moved out with
+ * take().
  */
-template <typename T> struct BytesParser<std::vector<T>> {
+template <typename T, typename A> struct BytesParser<std::vector<T, A>> {
+  using Vector = std::vector<T, A>;
+  using allocator_type = A;
+
+  BytesParser() = default;
+  explicit BytesParser(const A &alloc) : value_(alloc) {}
 
   ParseResult parse(const StreamChar *&, unsigned long &);
 
   /**
    * @brief Get a pointer to the parsed vector if the parsing was complete,
-   * nullptr otherwise.
+   * nullptr otherwise. The vector is overwritten by the next parsing.
+   */
+  inline const Vector *get() const { return is_parsed() ? &value_ : nullptr; }
+
+  /**
+   * @brief Move the parsed vector out of the parser (its buffer goes with it)
+   */
+  inline Vector take() {
+    auto value = std::exchange(value_, Vector(value_.get_allocator()));
+    reset();
+    return value;
+  }
+
+  /**
+   * @brief Give the parsed vector to dest. When both use the same allocator,
+   * the buffers are swapped: the parser recycles the former buffer of dest.
    */
-  std::shared_ptr<std::vector<T>> get() const {
-    return parsed_[0] && parsed_[1] ? p_value_ : nullptr;
+  inline void take(Vector &dest) {
+    if (dest.get_allocator() == value_.get_allocator())
+      dest.swap(value_);
+    else
+      dest.assign(value_.begin(), value_.end());
+    reset();
   }
 
+  /**
+   * @brief Reset the parser for a new vector, keeping the buffer capacity
+   */
   inline void reset() {
     size_parser_.reset();
     elem_parser_.reset();
-    p_value_.reset();
-    p_value_ = nullptr;
+    value_.clear();
     parsed_.reset();
     n_elements_expected_ = 0;
-    n_elements_parsed_ = 0;
   }
 
+  inline bool is_parsed() const { return parsed_[0] && parsed_[1]; }
+
+  inline A get_allocator() const { return value_.get_allocator(); }
+
 private:
+  Vector value_;
   BytesParser<int32_t> size_parser_;
   BytesParser<T> elem_parser_;
-  std::shared_ptr<std::vector<T>> p_value_ = nullptr;
-  uint32_t n_elements_parsed_ = 0;
   uint32_t n_elements_expected_ = 0;
 
   // Parsing flags
@@ -60,6 +96,9 @@ private:
 extern template struct BytesParser<std::vector<int8_t>>;  // nbt::ByteArray
 extern template struct BytesParser<std::vector<int32_t>>; // nbt::IntArray
 extern template struct BytesParser<std::vector<int64_t>>; // nbt::LongArray
+extern template struct BytesParser<std::pmr::vector<int8_t>>;
+extern template struct BytesParser<std::pmr::vector<int32_t>>;
+extern template struct BytesParser<std::pmr::vector<int64_t>>;
 
 } // namespace minecraft::nbt
 
@@ -14,39 +14,80 @@
 
 #include "minecraft/nbt/parsers/integral.hpp"
 #include <cstdint>
+#include <memory_resource>
 #include <string>
+#include <utility>
 
 namespace minecraft::nbt {
 
 /**
- * @brief Parser implementation for strings
+ * @brief Parser implementation for strings. The parsed string is allocated
+ * with the allocator given at construction, e.g. a
+ * std::pmr::polymorphic_allocator for std::pmr::string.
+ *
+ * As for the vectors, the string buffer is kept from one parsing to the next,
+ * and the parsed string can be read in place or moved out with take().
  */
-template <> struct BytesParser<std::string> {
+template <typename A>
+struct BytesParser<std::basic_string<char, std::char_traits<char>, A>> {
+  using String = std::basic_string<char, std::char_traits<char>, A>;
+  using allocator_type = A;
+
+  BytesParser() = default;
+  explicit BytesParser(const A &alloc) : value_(alloc) {}
 
   ParseResult parse(const StreamChar *&, unsigned long &);
 
-  std::string get() const { return is_parsed() ? value_ : EMPTY_STR; }
+  /**
+   * @brief Get the parsed string, or an empty one if unfinished. The string
+   * is overwritten by the next parsing.
+   */
+  inline const String &get() const { return is_parsed() ? value_ : EMPTY; }
+
+  /**
+   * @brief Move the parsed string out of the parser (its buffer goes with it)
+   */
+  inline String take() {
+    auto value = std::exchange(value_, String(value_.get_allocator()));
+    reset();
+    return value;
+  }
+
+  /**
+   * @brief Give the parsed string to dest. When both use the same allocator,
+   * the buffers are swapped: the parser recycles the former buffer of dest.
+   */
+  inline void take(String &dest) {
+    if (dest.get_allocator() == value_.get_allocator())
+      dest.swap(value_);
+    else
+      dest.assign(value_);
+    reset();
+  }
 
   /**
    * @brief Get the parsed length of the string or 0 if unfinished
    */
   uint16_t get_length() const { return size_parser_.get(); }
 
+  /**
+   * @brief Reset the parser for a new string, keeping the buffer capacity
+   */
   inline void reset() {
     size_parser_.reset();
-    n_bytes = 0;
-    value_.resize(0);
+    value_.clear();
     parsed_ = false;
     size_parsed_ = false;
   }
 
   inline bool is_parsed() const { return size_parsed_ && parsed_; }
 
+  inline A get_allocator() const { return value_.get_allocator(); }
+
 private:
-  static constexpr std::string EMPTY_STR{};
-  std::string value_;
+  static inline const String EMPTY{};
+  String value_;
   BytesParser<uint16_t> size_parser_;
-  std::size_t n_bytes;
   bool size_parsed_ = false;
   bool parsed_ = false;
 };
@@ -55,6 +96,7 @@ private:
 // Specialization export in this library
 // ============================================================================
 extern template struct BytesParser<std::string>;
+extern template struct BytesParser<std::pmr::string>;
 
 } // namespace minecraft::nbt
 
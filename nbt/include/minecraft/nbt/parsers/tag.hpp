@@ -0,0 +1,195 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Tag tree byte-parsing definition
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_PARSER_TAG_HPP
+#define SOLISMC_NBT_PARSER_TAG_HPP
+
+#include "minecraft/nbt/parsers/float.hpp"
+#include "minecraft/nbt/parsers/integral.hpp"
+#include "minecraft/nbt/parsers/list.hpp"
+#include "minecraft/nbt/parsers/string.hpp"
+#include "minecraft/nbt/tag.hpp"
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Parser implementation for a whole named tag (e.g. an NBT file root).
+ *
+ * Nested compounds and lists are parsed without recursion: the parser keeps a
+ * stack of the opened containers so that it can be resumed at any byte. The
+ * payload of each value is dispatched through a table indexed by its TagID_t
+ * and generated at compile time, so that the primitive decoding is inlined in
+ * the parsing loop.
+ *
+ * Every node of the parsed tree is allocated from the memory resource given
+ * at construction, which must outlive the trees.
+ * The parser's own buffers use the default resource, so that the tree
+ * resource can be released as soon as the tree is dropped.
+ */
+template <> struct BytesParser<Tag> {
+  // Maximum nesting of compounds and lists, the trees being destroyed,
+  // written and hashed recursively
+  static constexpr std::size_t MAX_DEPTH{512};
+
+  explicit BytesParser(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : resource_(resource) {}
+
+  // The parser keeps pointers in the tree it builds
+  BytesParser(const BytesParser &) = delete;
+  BytesParser &operator=(const BytesParser &) = delete;
+
+  ParseResult parse(const StreamChar *&, unsigned long &);
+
+  /**
+   * @brief Get a pointer to the parsed tag if the parsing was complete,
+   * nullptr otherwise. The tree is dropped by the next parsing.
+   */
+  inline const Tag *get() const { return is_parsed() ? &root_ : nullptr; }
+
+  /**
+   * @brief Move the parsed tree out of the parser
+   */
+  inline Tag take() {
+    auto root = std::move(root_);
+    reset();
+    return root;
+  }
+
+  /**
+   * @brief Get the name of the parsed root tag
+   */
+  const SmallString &get_name() const { return name_; }
+
+  /**
+   * @brief Get the memory resource the trees are allocated from
+   */
+  std::pmr::memory_resource *get_resource() const { return resource_; }
+
+  inline void reset() {
+    state_ = State::ROOT_ID;
+    tag_id_ = 0;
+    target_ = nullptr;
+    stack_.clear();
+    name_.clear();
+    root_ = Tag{};
+    // The arrays buffers come from the tree resource: don't keep them
+    std::apply([](auto &...parsers) { (parsers.take(), ...); },
+               array_parsers_);
+    leaf_pending_ = false;
+    list_tag_parsed_ = false;
+  }
+
+  inline bool is_parsed() const { return state_ == State::DONE; }
+
+private:
+  /**
+   * @brief Steps of the parsing of a tag
+   */
+  enum class State : uint8_t {
+    ROOT_ID,    // Type of the root tag
+    ROOT_NAME,  // Name of the root tag
+    ENTRY_ID,   // Type of the next compound entry (or END)
+    ENTRY_NAME, // Name of the compound entry
+    PAYLOAD,    // Value of the current tag
+    DONE,       // Parsing finished
+    ERROR,      // Parsing failed, the parser must be reset
+  };
+
+  /**
+   * @brief An opened container (compound or list) in the tree
+   */
+  struct Frame {
+    Tag *node;
+    uint32_t remaining; // Number of list elements still to parse
+  };
+
+  using PayloadParser = ParseResult (BytesParser<Tag>::*)(const StreamChar *&,
+                                                          unsigned long &,
+                                                          Tag &);
+
+  /**
+   * @brief Parse the payload of a TAG value into the given destination
+   */
+  template <Tags TAG>
+  ParseResult parse_payload(const StreamChar *&, unsigned long &, Tag &);
+
+  /**
+   * @brief Payload parser for unknown tags
+   */
+  ParseResult parse_invalid(const StreamChar *&, unsigned long &, Tag &);
+
+  /**
+   * @brief Read a fixed-size value, decoding it directly from the stream when
+   * it is contiguous and falling back to the resumable parser otherwise.
+   */
+  template <typename T>
+  ParseResult read_value(const StreamChar *&, unsigned long &, T &);
+
+  /**
+   * @brief Read a string, copying it directly from the stream when it is
+   * contiguous and falling back to the resumable parser otherwise.
+   */
+  ParseResult read_string(const StreamChar *&, unsigned long &,
+                          SmallString &);
+
+  /**
+   * @brief Parsing loop over the tree states
+   */
+  ParseResult parse_tree(const StreamChar *&, unsigned long &);
+
+  /**
+   * @brief Select the next value to parse from the opened containers
+   */
+  void next_value();
+
+  inline ParseResult fail() {
+    state_ = State::ERROR;
+    return ParseResult::FAILED;
+  }
+
+  // Tree state
+  std::pmr::memory_resource *resource_;
+  State state_{State::ROOT_ID};
+  TagID_t tag_id_{0};
+  Tag *target_ = nullptr;
+  std::vector<Frame> stack_;
+  SmallString name_;
+  SmallString key_;
+  Tag root_;
+
+  // Values parsers
+  std::tuple<BytesParser<int8_t>, BytesParser<int16_t>, BytesParser<int32_t>,
+             BytesParser<int64_t>, BytesParser<float>, BytesParser<double>>
+      value_parsers_;
+  std::tuple<BytesParser<std::pmr::vector<int8_t>>,
+             BytesParser<std::pmr::vector<int32_t>>,
+             BytesParser<std::pmr::vector<int64_t>>>
+      array_parsers_{resource_, resource_, resource_};
+  BytesParser<std::pmr::string> str_parser_;
+  bool leaf_pending_ = false;
+  bool list_tag_parsed_ = false;
+};
+
+// ============================================================================
+// Specialization export in this library
+// ============================================================================
+extern template struct BytesParser<Tag>;
+
+} // namespace minecraft::nbt
+
+#endif
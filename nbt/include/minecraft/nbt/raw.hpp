@@ -0,0 +1,74 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Walking of NBT documents directly from their bytes, without building trees
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_RAW_HPP
+#define SOLISMC_NBT_RAW_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/types.hpp"
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Named tag located in the bytes of a document
+ */
+struct RawTag {
+  Tags tag;
+  std::string_view name;
+  std::span<const StreamChar> payload;
+};
+
+/**
+ * @brief Elements of a list located in the bytes of a document
+ */
+struct RawList {
+  Tags elem_tag;
+  std::vector<std::span<const StreamChar>> elements;
+};
+
+/**
+ * @brief Size of the payload of a value starting at the given bytes, found by
+ * skipping over it (nested values included) without decoding it.
+ *
+ * @return the size, nothing if the value is invalid or truncated
+ */
+std::optional<std::size_t> payload_size(Tags tag,
+                                        std::span<const StreamChar> bytes);
+
+/**
+ * @brief Locate the named tag starting at the given bytes (e.g. the root of a
+ * document)
+ */
+std::optional<RawTag> read_named(std::span<const StreamChar> bytes);
+
+/**
+ * @brief Locate the entries of a compound from its payload
+ *
+ * @return false if the payload is invalid
+ */
+bool read_entries(std::span<const StreamChar> payload,
+                  std::vector<RawTag> &entries);
+
+/**
+ * @brief Locate the elements of a list from its payload
+ *
+ * @return false if the payload is invalid
+ */
+bool read_elements(std::span<const StreamChar> payload, RawList &list);
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,150 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Reader of (possibly compressed) NBT documents
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_READER_HPP
+#define SOLISMC_NBT_READER_HPP
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/segments.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Compression of an NBT document
+ */
+enum class Compression : uint8_t { NONE, GZIP, ZLIB };
+
+/**
+ * @brief Detect the compression of a document from its first byte
+ */
+constexpr Compression detect_compression(StreamChar first) {
+  switch (first) {
+  case 0x1f:
+    return Compression::GZIP;
+  case 0x78:
+    return Compression::ZLIB;
+  default:
+    return Compression::NONE;
+  }
+}
+
+/**
+ * @brief Reader of a whole NBT document, inflating it on the fly when it is
+ * compressed (gzip or zlib).
+ *
+ * The reader follows the protocol of the BytesParser: it can be fed with the
+ * (compressed) bytes in as many buffers as needed. The parsed trees are
+ * allocated from the given memory resource.
+ */
+class Reader {
+public:
+  explicit Reader(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+  ~Reader();
+  Reader(const Reader &) = delete;
+  Reader &operator=(const Reader &) = delete;
+
+  ParseResult parse(const StreamChar *&, unsigned long &);
+
+  /**
+   * @brief Get a pointer to the parsed tag if the parsing was complete,
+   * nullptr otherwise.
+   */
+  inline const Tag *get() const {
+    return is_parsed() ? parser_.get() : nullptr;
+  }
+
+  /**
+   * @brief Move the parsed tree out of the reader
+   */
+  inline Tag take() {
+    done_ = false;
+    return parser_.take();
+  }
+
+  /**
+   * @brief Get the name of the parsed root tag
+   */
+  const SmallString &get_name() const { return parser_.get_name(); }
+
+  /**
+   * @brief Get the compression detected for the current document
+   */
+  std::optional<Compression> get_compression() const { return compression_; }
+
+  void reset();
+
+  inline bool is_parsed() const { return done_; }
+
+private:
+  /**
+   * @brief Inflate the given bytes and feed them to the tree parser
+   */
+  ParseResult inflate(const StreamChar *&, unsigned long &);
+
+  inline ParseResult fail() {
+    failed_ = true;
+    return ParseResult::FAILED;
+  }
+
+  struct Inflater;
+
+  BytesParser<Tag> parser_;
+  std::optional<Compression> compression_;
+  std::unique_ptr<Inflater> inflater_;
+  std::vector<StreamChar> buffer_; // Inflated bytes
+  bool done_ = false;
+  bool failed_ = false;
+};
+
+/**
+ * @brief Parse a whole (possibly compressed) document held in memory
+ *
+ * @param resource memory resource the tree is allocated from
+ * @return the root tag, nothing if the document is invalid
+ */
+std::optional<Tag> parse_bytes(
+    const StreamChar *data, std::size_t size,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+/**
+ * @brief Parse a whole (possibly compressed) document spread over several
+ * segments in memory, without concatenating them
+ *
+ * @param resource memory resource the tree is allocated from
+ * @return the root tag, nothing if the document is invalid or truncated
+ */
+std::optional<Tag> parse_bytes(
+    std::span<const Segment> segments,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+/**
+ * @brief Parse a whole (possibly compressed) NBT file
+ *
+ * @param resource memory resource the tree is allocated from
+ * @return the root tag, nothing if the file can't be read or is invalid
+ */
+std::optional<Tag> parse_file(
+    const std::filesystem::path &path,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,278 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Reader and writer of region files (.mca), the containers of the chunks of
+// a world
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_REGION_HPP
+#define SOLISMC_NBT_REGION_HPP
+
+#include "minecraft/nbt/diff.hpp"
+#include "minecraft/nbt/reader.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace minecraft::nbt {
+
+// Size of the sectors of a region file
+constexpr std::size_t REGION_SECTOR_SIZE{4096};
+// Number of chunks in a region (32x32)
+constexpr std::size_t REGION_CHUNKS{1024};
+
+/**
+ * @brief Compression of a chunk in a region file
+ */
+enum class ChunkCompression : uint8_t {
+  GZIP = 1,
+  ZLIB = 2,
+  NONE = 3,
+  LZ4 = 4, // lz4-java block stream (since 1.20.5)
+};
+
+/**
+ * @brief Backend of a chunk compression
+ */
+struct ChunkCodec {
+  // Decompress a payload into its document (replacing its content)
+  bool (*decompress)(std::span<const StreamChar> payload,
+                     std::vector<StreamChar> &document) = nullptr;
+  // Compress a document into a payload (replacing its content)
+  bool (*compress)(std::span<const StreamChar> document, int level,
+                   std::vector<StreamChar> &payload) = nullptr;
+};
+
+/**
+ * @brief Replace the backend of a chunk compression (types 1 to 127).
+ *
+ * The default backends handle the four standard types, the gzip & zlib ones
+ * with zlib. Backends can be set while regions are read by other threads: the
+ * reads started before use either backend. As each call copies the table of
+ * the backends (kept until exit), they are meant to be set a few times only,
+ * typically at startup.
+ */
+void set_chunk_codec(ChunkCompression compression, ChunkCodec codec);
+
+/**
+ * @brief Backend of a chunk compression, without functions if it is unknown
+ */
+const ChunkCodec &get_chunk_codec(ChunkCompression compression);
+
+/**
+ * @brief Compressed payload of a chunk
+ */
+struct ChunkData {
+  ChunkCompression compression;
+  bool external; // Payload stored in a separate .mcc file (not read)
+  std::span<const StreamChar> bytes;
+};
+
+/**
+ * @brief Decompress the payload of a chunk into its document
+ *
+ * @return false if the chunk is external, its compression unknown or its
+ * payload invalid
+ */
+bool decompress_chunk(const ChunkData &chunk,
+                      std::vector<StreamChar> &document);
+
+/**
+ * @brief Compress a document into the payload of a chunk
+ *
+ * @param level compression level, ignored by the compressions without levels
+ */
+bool compress_chunk(std::span<const StreamChar> document,
+                    ChunkCompression compression, int level,
+                    std::vector<StreamChar> &payload);
+
+/**
+ * @brief Get the index of a chunk in its region from its coordinates
+ */
+constexpr std::size_t chunk_index(int x, int z) {
+  return static_cast<std::size_t>((x & 31) + (z & 31) * 32);
+}
+
+/**
+ * @brief Region file opened for reading.
+ *
+ * Only the header (locations and timestamps) is kept in memory: the chunks are
+ * read one at a time into a buffer given by the caller, so that scanning a
+ * region doesn't need more memory than its largest chunk.
+ */
+class RegionFile {
+public:
+  /**
+   * @brief Open a region file and read its header
+   *
+   * @return the region, nothing if the file can't be read or is not a region
+   */
+  static std::optional<RegionFile> open(const std::filesystem::path &path);
+
+  /**
+   * @brief Whether the region holds the chunk at the given index
+   */
+  inline bool contains(std::size_t index) const {
+    return locations_[index] != 0;
+  }
+
+  /**
+   * @brief Number of chunks in the region
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Last modification time of a chunk (seconds since the epoch)
+   */
+  inline uint32_t get_timestamp(std::size_t index) const {
+    return timestamps_[index];
+  }
+
+  /**
+   * @brief Read the compressed payload of a chunk
+   *
+   * @param buffer buffer (reused between calls) the payload is read into
+   * @return the payload, nothing if the chunk is missing, corrupted or of an
+   * unknown compression
+   */
+  std::optional<ChunkData> read_chunk(std::size_t index,
+                                      std::vector<StreamChar> &buffer);
+
+  /**
+   * @brief Read and parse a chunk
+   *
+   * @param reader reader (reused between calls) parsing the chunk
+   * @param buffer buffer (reused between calls) the payload is read into
+   * @return the root tag of the chunk, nothing if it is missing, external or
+   * invalid
+   */
+  std::optional<Tag> parse_chunk(std::size_t index, Reader &reader,
+                                 std::vector<StreamChar> &buffer);
+
+private:
+  RegionFile() = default;
+
+  std::ifstream file_;
+  std::size_t file_size_ = 0;
+  std::array<uint32_t, REGION_CHUNKS> locations_{}; // Offset << 8 | sectors
+  std::array<uint32_t, REGION_CHUNKS> timestamps_{};
+};
+
+// ============================================================================
+// Saving
+// ============================================================================
+
+/**
+ * @brief Chunk modified since the region was last saved
+ */
+struct DirtyChunk {
+  std::shared_ptr<const Tag> root; // New content, nullptr if removed
+  std::vector<Path> modified;      // Modified subtrees ({} for the whole chunk)
+  uint32_t timestamp = 0;          // Time of the last modification
+};
+
+/**
+ * @brief Chunks of a region modified since it was last saved
+ */
+class DirtyChunks {
+public:
+  /**
+   * @brief Mark a subtree of a chunk as modified
+   *
+   * @param root the tree of the chunk (kept until the save)
+   * @param path the modified subtree, the whole chunk by default
+   */
+  void mark(std::size_t index, std::shared_ptr<const Tag> root,
+            Path path = {});
+
+  /**
+   * @brief Mark a chunk as removed from the region
+   */
+  void remove(std::size_t index);
+
+  /**
+   * @brief The modifications of a chunk, nullptr if it is unmodified
+   */
+  const DirtyChunk *find(std::size_t index) const;
+
+  inline std::size_t size() const { return chunks_.size(); }
+  inline bool empty() const { return chunks_.empty(); }
+  inline void clear() { chunks_.clear(); }
+
+private:
+  std::map<std::size_t, DirtyChunk> chunks_;
+};
+
+/**
+ * @brief Configuration of the saving of a region
+ */
+struct SaveOptions {
+  ChunkCompression compression = ChunkCompression::ZLIB; // Of dirty chunks
+  int level = 6; // zlib compression level
+  // Re-compress the unmodified chunks of another compression (transcoding
+  // the region) instead of copying them verbatim
+  bool recompress = false;
+};
+
+/**
+ * @brief Counters of the saving of a region
+ */
+struct SaveStats {
+  std::size_t copied = 0;       // Unmodified chunks copied verbatim
+  std::size_t recompressed = 0; // Unmodified chunks of another compression
+  std::size_t patched = 0;      // Dirty chunks reusing unmodified subtrees
+  std::size_t encoded = 0;      // Dirty chunks serialized as a whole
+  std::size_t removed = 0;
+};
+
+/**
+ * @brief Save a region, encoding only its dirty chunks.
+ *
+ * The compressed payloads of the unmodified chunks are copied verbatim from
+ * the source region. The dirty chunks are serialized and compressed, their
+ * unmodified subtrees being copied from their original document (see
+ * serialize_modified). The new region is written next to the target and
+ * renamed over it once complete, so the source can be the target itself.
+ *
+ * Chunks of more than 255 sectors are written to a c.<x>.<z>.mcc file next to
+ * the target, the region only keeping their compression flagged as external.
+ * Their coordinates come from the name of the target, which must then be
+ * r.<x>.<z>.mca.
+ *
+ * @param source region the chunks come from (a new region if it is missing)
+ * @return the counters, nothing if the source can't be read, the target
+ * can't be written or it has an oversized chunk but isn't named after its
+ * region
+ */
+std::optional<SaveStats> save_region(const std::filesystem::path &source,
+                                     const std::filesystem::path &target,
+                                     const DirtyChunks &dirty,
+                                     SaveOptions options = {});
+
+/**
+ * @brief Rewrite a region with its chunks in the given compression (see
+ * SaveOptions::recompress), the external chunks being copied as is
+ *
+ * @return the counters, nothing if the source can't be read, a chunk can't be
+ * decompressed or the target can't be written
+ */
+std::optional<SaveStats> transcode_region(const std::filesystem::path &source,
+                                          const std::filesystem::path &target,
+                                          ChunkCompression compression,
+                                          int level = 6);
+
+} // namespace minecraft::nbt
+
+#endif
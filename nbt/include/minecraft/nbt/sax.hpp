@@ -0,0 +1,438 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Event-based (SAX) parsing of NBT documents, without building trees
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_SAX_HPP
+#define SOLISMC_NBT_SAX_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/types.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Visitor ignoring every event, to derive the visitors from so that
+ * they only define the events they need.
+ *
+ * The events of a document are:
+ *  - key(name) before each named value: the root and the compound entries
+ *  - value(v) for the scalars (int8_t ... int64_t, float, double) and the
+ *    strings (std::string_view of their raw bytes)
+ *  - begin_compound(name), then its entries and end(). The name is the one
+ *    given by the previous key() (empty for the elements of a list)
+ *  - begin_list(elem_tag, count), then its count elements and end()
+ *  - begin_array(tag, count), then its elements in one or several
+ *    array_chunk(std::span<const T>) and end()
+ *
+ * The events may return a bool instead of void, false stopping the parsing
+ * (which then fails). The views they are given are only valid during the call.
+ * A visitor overloading value() or array_chunk() for some types only must
+ * bring the ones of SaxVisitor in scope (using SaxVisitor::value).
+ */
+struct SaxVisitor {
+  inline void key(std::string_view) {}
+  inline void begin_compound(std::string_view) {}
+  inline void begin_list(Tags, int32_t) {}
+  inline void begin_array(Tags, int32_t) {}
+  template <typename T> inline void value(T) {}
+  template <typename T> inline void array_chunk(std::span<const T>) {}
+  inline void end() {}
+};
+
+/**
+ * @brief Parser of a document calling a visitor at each of its events.
+ *
+ * It follows the parsers interface: the document can be given in several
+ * parts, the parsing resuming where the previous part ended. Nothing is
+ * allocated besides the stack of the open containers and the strings split
+ * between two parts, both reused after a reset. The visitor calls are
+ * resolved at compile time.
+ *
+ * @tparam IS_BIG_ENDIAN whether the values are big-endian (JAVA) or
+ * little-endian (BEDROCK)
+ */
+template <typename Visitor, bool IS_BIG_ENDIAN = true> class SaxParser {
+public:
+  // Maximum nesting of compounds and lists
+  static constexpr std::size_t MAX_DEPTH{512};
+
+  explicit SaxParser(Visitor &visitor) : visitor_(visitor) {}
+
+  /**
+   * @brief Parse the given bytes, calling the visitor at each event
+   *
+   * @param strm the stream to read the document from
+   * @param N the number of bytes left in the stream
+   */
+  ParseResult parse(const StreamChar *&strm, unsigned long &N) {
+    while (true) {
+      switch (step_) {
+      case Step::DONE:
+        return ParseResult::SUCCESS;
+      case Step::FAILED:
+        return ParseResult::FAILED;
+
+      case Step::TAG: {
+        // Type of the root or of the next compound entry
+        if (N <= 0)
+          return ParseResult::UNFINISHED;
+        tag_ = static_cast<Tags>(strm[0]);
+        inc_stream(strm, N);
+        if (tag_ == Tags::END) {
+          if (frames_.empty() || !emit([&] { return visitor_.end(); }))
+            return fail();
+          frames_.pop_back();
+          if (!finish_value())
+            return fail();
+        } else if (tag_ > Tags::LongArray)
+          return fail();
+        else
+          step_ = Step::NAME;
+        break;
+      }
+
+      case Step::NAME: {
+        std::string_view name;
+        if (!take_text(strm, N, name))
+          return ParseResult::UNFINISHED;
+        if (!emit([&] { return visitor_.key(name); }) || !start_value(name))
+          return fail();
+        break;
+      }
+
+      case Step::VALUE:
+        if (const auto ret = read_value(strm, N); ret != ParseResult::SUCCESS)
+          return ret == ParseResult::FAILED ? fail() : ret;
+        break;
+
+      case Step::ARRAY:
+        if (const auto ret = read_array(strm, N); ret != ParseResult::SUCCESS)
+          return ret == ParseResult::FAILED ? fail() : ret;
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief Reset the parser for a new document
+   */
+  void reset() {
+    step_ = Step::TAG;
+    frames_.clear();
+    n_pending_ = 0;
+    text_size_ = -1;
+  }
+
+  /**
+   * @brief Whether a whole document has been parsed
+   */
+  inline bool is_parsed() const { return step_ == Step::DONE; }
+
+private:
+  enum class Step : uint8_t { TAG, NAME, VALUE, ARRAY, DONE, FAILED };
+
+  /**
+   * @brief Open compound or list
+   */
+  struct Frame {
+    Tags tag;      // Compound or List
+    Tags elem_tag; // Of the lists
+    uint32_t remaining;
+  };
+
+  // Decoded elements of int & long arrays given at once to the visitor
+  static constexpr std::size_t ARRAY_BATCH{256};
+
+  /**
+   * @brief Call an event, returning whether the parsing continues
+   */
+  template <typename Event> static inline bool emit(Event &&event) {
+    if constexpr (std::is_same_v<std::invoke_result_t<Event>, bool>)
+      return event();
+    else {
+      event();
+      return true;
+    }
+  }
+
+  inline ParseResult fail() {
+    step_ = Step::FAILED;
+    return ParseResult::FAILED;
+  }
+
+  /**
+   * @brief Get the next k (at most 8) bytes, buffering them across the parts
+   * of the document
+   *
+   * @return the bytes, nullptr if the stream ended before
+   */
+  const StreamChar *take(const StreamChar *&strm, unsigned long &N,
+                         std::size_t k) {
+    if (n_pending_ == 0 && N >= k) {
+      const StreamChar *bytes = strm;
+      inc_stream(strm, N, k);
+      return bytes;
+    }
+    const auto n = std::min<std::size_t>(k - n_pending_, N);
+    if (n != 0)
+      std::memcpy(pending_.data() + n_pending_, strm, n);
+    n_pending_ += n;
+    inc_stream(strm, N, n);
+    if (n_pending_ < k)
+      return nullptr;
+    n_pending_ = 0;
+    return pending_.data();
+  }
+
+  /**
+   * @brief Get the next string (length & bytes), viewing it in the stream
+   * when it isn't split between two parts
+   *
+   * @return false if the stream ended before
+   */
+  bool take_text(const StreamChar *&strm, unsigned long &N,
+                 std::string_view &text) {
+    if (text_size_ < 0) {
+      const auto *bytes = take(strm, N, sizeof(uint16_t));
+      if (bytes == nullptr)
+        return false;
+      text_size_ = load_integral<uint16_t, IS_BIG_ENDIAN>(bytes);
+      text_.clear();
+    }
+    const auto size = static_cast<std::size_t>(text_size_);
+    if (text_.empty() && N >= size) {
+      text = {reinterpret_cast<const char *>(strm), size};
+      inc_stream(strm, N, size);
+    } else {
+      const auto n = std::min<std::size_t>(size - text_.size(), N);
+      text_.append(reinterpret_cast<const char *>(strm), n);
+      inc_stream(strm, N, n);
+      if (text_.size() < size)
+        return false;
+      text = text_;
+    }
+    text_size_ = -1;
+    return true;
+  }
+
+  /**
+   * @brief Start the value of type tag_ (compounds are opened at once)
+   */
+  bool start_value(std::string_view name) {
+    if (tag_ != Tags::Compound) {
+      step_ = Step::VALUE;
+      return true;
+    }
+    if (frames_.size() >= MAX_DEPTH ||
+        !emit([&] { return visitor_.begin_compound(name); }))
+      return false;
+    frames_.push_back({Tags::Compound, Tags::END, 0});
+    step_ = Step::TAG;
+    return true;
+  }
+
+  /**
+   * @brief Go to what follows a complete value: the next compound entry, the
+   * next list element or the end of the document
+   */
+  bool finish_value() {
+    while (!frames_.empty()) {
+      auto &frame = frames_.back();
+      if (frame.tag == Tags::Compound) {
+        step_ = Step::TAG;
+        return true;
+      }
+      if (frame.remaining > 0) {
+        frame.remaining--;
+        tag_ = frame.elem_tag;
+        return start_value({});
+      }
+      if (!emit([&] { return visitor_.end(); }))
+        return false;
+      frames_.pop_back();
+    }
+    step_ = Step::DONE;
+    return true;
+  }
+
+  template <typename T>
+  ParseResult read_scalar(const StreamChar *&strm, unsigned long &N) {
+    const auto *bytes = take(strm, N, sizeof(T));
+    if (bytes == nullptr)
+      return ParseResult::UNFINISHED;
+    T value;
+    if constexpr (std::is_same_v<T, float>)
+      value =
+          std::bit_cast<float>(load_integral<int32_t, IS_BIG_ENDIAN>(bytes));
+    else if constexpr (std::is_same_v<T, double>)
+      value =
+          std::bit_cast<double>(load_integral<int64_t, IS_BIG_ENDIAN>(bytes));
+    else
+      value = load_integral<T, IS_BIG_ENDIAN>(bytes);
+    if (!emit([&] { return visitor_.value(value); }))
+      return ParseResult::FAILED;
+    return finish_value() ? ParseResult::SUCCESS : ParseResult::FAILED;
+  }
+
+  /**
+   * @brief Read the payload of a value of type tag_ (or the header of a list
+   * or an array)
+   */
+  ParseResult read_value(const StreamChar *&strm, unsigned long &N) {
+    switch (tag_) {
+    case Tags::Byte:
+      return read_scalar<int8_t>(strm, N);
+    case Tags::Short:
+      return read_scalar<int16_t>(strm, N);
+    case Tags::Int:
+      return read_scalar<int32_t>(strm, N);
+    case Tags::Long:
+      return read_scalar<int64_t>(strm, N);
+    case Tags::Float:
+      return read_scalar<float>(strm, N);
+    case Tags::Double:
+      return read_scalar<double>(strm, N);
+    case Tags::String: {
+      std::string_view text;
+      if (!take_text(strm, N, text))
+        return ParseResult::UNFINISHED;
+      if (!emit([&] { return visitor_.value(text); }))
+        return ParseResult::FAILED;
+      return finish_value() ? ParseResult::SUCCESS : ParseResult::FAILED;
+    }
+    case Tags::List: {
+      const auto *bytes = take(strm, N, 1 + sizeof(int32_t));
+      if (bytes == nullptr)
+        return ParseResult::UNFINISHED;
+      const auto elem_tag = static_cast<Tags>(bytes[0]);
+      const auto count = load_integral<int32_t, IS_BIG_ENDIAN>(bytes + 1);
+      if (count < 0 || frames_.size() >= MAX_DEPTH ||
+          (count > 0 &&
+           (elem_tag == Tags::END || elem_tag > Tags::LongArray)) ||
+          !emit([&] { return visitor_.begin_list(elem_tag, count); }))
+        return ParseResult::FAILED;
+      frames_.push_back({Tags::List, elem_tag, static_cast<uint32_t>(count)});
+      return finish_value() ? ParseResult::SUCCESS : ParseResult::FAILED;
+    }
+    case Tags::ByteArray:
+    case Tags::IntArray:
+    case Tags::LongArray: {
+      const auto *bytes = take(strm, N, sizeof(int32_t));
+      if (bytes == nullptr)
+        return ParseResult::UNFINISHED;
+      const auto count = load_integral<int32_t, IS_BIG_ENDIAN>(bytes);
+      if (count < 0 || !emit([&] { return visitor_.begin_array(tag_, count); }))
+        return ParseResult::FAILED;
+      array_remaining_ = static_cast<uint32_t>(count);
+      step_ = Step::ARRAY;
+      return ParseResult::SUCCESS;
+    }
+    default:
+      return ParseResult::FAILED;
+    }
+  }
+
+  /**
+   * @brief Give the elements of an array to the visitor as they arrive
+   */
+  template <typename T>
+  ParseResult read_elements(const StreamChar *&strm, unsigned long &N) {
+    while (array_remaining_ > 0) {
+      if constexpr (sizeof(T) == 1) {
+        // Viewed in the stream
+        const auto n = std::min<std::size_t>(array_remaining_, N);
+        if (n == 0)
+          return ParseResult::UNFINISHED;
+        const std::span<const T> chunk{reinterpret_cast<const T *>(strm), n};
+        if (!emit([&] { return visitor_.array_chunk(chunk); }))
+          return ParseResult::FAILED;
+        inc_stream(strm, N, n);
+        array_remaining_ -= static_cast<uint32_t>(n);
+      } else if (n_pending_ > 0 || N < sizeof(T)) {
+        // Element split between two parts
+        const auto *bytes = take(strm, N, sizeof(T));
+        if (bytes == nullptr)
+          return ParseResult::UNFINISHED;
+        const T value = load_integral<T, IS_BIG_ENDIAN>(bytes);
+        const std::span<const T> chunk{&value, 1};
+        if (!emit([&] { return visitor_.array_chunk(chunk); }))
+          return ParseResult::FAILED;
+        array_remaining_--;
+      } else {
+        // Decoded by batches
+        std::array<T, ARRAY_BATCH> batch;
+        const auto n = std::min<std::size_t>(
+            {array_remaining_, N / sizeof(T), ARRAY_BATCH});
+        std::copy_n(DecodeIterator<T, IS_BIG_ENDIAN>{strm}, n, batch.data());
+        const std::span<const T> chunk{batch.data(), n};
+        if (!emit([&] { return visitor_.array_chunk(chunk); }))
+          return ParseResult::FAILED;
+        inc_stream(strm, N, n * sizeof(T));
+        array_remaining_ -= static_cast<uint32_t>(n);
+      }
+    }
+    if (!emit([&] { return visitor_.end(); }))
+      return ParseResult::FAILED;
+    return finish_value() ? ParseResult::SUCCESS : ParseResult::FAILED;
+  }
+
+  ParseResult read_array(const StreamChar *&strm, unsigned long &N) {
+    switch (tag_) {
+    case Tags::ByteArray:
+      return read_elements<int8_t>(strm, N);
+    case Tags::IntArray:
+      return read_elements<int32_t>(strm, N);
+    default:
+      return read_elements<int64_t>(strm, N);
+    }
+  }
+
+  Visitor &visitor_;
+  Step step_ = Step::TAG;
+  Tags tag_ = Tags::END; // Type of the current value
+  std::vector<Frame> frames_;
+  uint32_t array_remaining_ = 0;
+
+  // Bytes of a fixed-size value split between two parts
+  std::array<StreamChar, 8> pending_{};
+  std::size_t n_pending_ = 0;
+  // String split between two parts, and its size (-1 while unknown)
+  std::string text_;
+  int32_t text_size_ = -1;
+};
+
+/**
+ * @brief Parse a whole document held in memory, calling the visitor at each
+ * of its events
+ *
+ * @return whether the document is valid (and the visitor didn't stop)
+ */
+template <typename Visitor>
+bool visit_document(std::span<const StreamChar> document, Visitor &visitor) {
+  SaxParser<Visitor> parser{visitor};
+  const StreamChar *strm = document.data();
+  unsigned long N = document.size();
+  return parser.parse(strm, N) == ParseResult::SUCCESS;
+}
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,78 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Parsing of documents split into several segments (scatter-gather input)
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_SEGMENTS_HPP
+#define SOLISMC_NBT_SEGMENTS_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include <cstddef>
+#include <span>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Contiguous part of a document (e.g. a network receive buffer, or the
+ * iov_base & iov_len of an iovec)
+ */
+using Segment = std::span<const StreamChar>;
+
+/**
+ * @brief Position in a sequence of segments
+ */
+struct SegmentPosition {
+  std::size_t segment = 0; // Index of the current segment
+  std::size_t offset = 0;  // Bytes of the current segment already read
+};
+
+/**
+ * @brief Parse a document spread over a sequence of segments, without
+ * concatenating them.
+ *
+ * Each segment is given whole to the parser, which keeps its bulk paths
+ * within a segment and resumes across the boundaries (only the values split
+ * between two segments are buffered). Works with any parser following the
+ * parsers interface (BytesParser, Reader, SaxParser, ...).
+ *
+ * @param position where to start, advanced to the byte following the
+ * document on success (so that a following document can be parsed from it)
+ * @return UNFINISHED if the segments end before the document
+ */
+template <typename Parser>
+ParseResult parse_segments(Parser &parser, std::span<const Segment> segments,
+                           SegmentPosition &position) {
+  for (; position.segment < segments.size();
+       position.segment++, position.offset = 0) {
+    const auto segment = segments[position.segment];
+    const StreamChar *strm = segment.data() + position.offset;
+    unsigned long N = segment.size() - position.offset;
+    while (N > 0) {
+      const auto ret = parser.parse(strm, N);
+      position.offset = segment.size() - N;
+      if (ret != ParseResult::UNFINISHED)
+        return ret;
+    }
+  }
+  return ParseResult::UNFINISHED;
+}
+
+/**
+ * @brief Parse a document spread over a sequence of segments, from their
+ * start
+ */
+template <typename Parser>
+ParseResult parse_segments(Parser &parser, std::span<const Segment> segments) {
+  SegmentPosition position;
+  return parse_segments(parser, segments, position);
+}
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,235 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// String of the NBT tree, storing the short names and values inline
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_SMALL_STRING_HPP
+#define SOLISMC_NBT_SMALL_STRING_HPP
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <string_view>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief String of the tree (compound names and String values).
+ *
+ * Nearly all the names and most values are short: up to INLINE_CAPACITY
+ * bytes are stored in the string itself, so that they cost no allocation
+ * and no pointer chase when the tree is walked. The longer ones are allocated
+ * from the string's memory resource.
+ *
+ * The string is 32 bytes (against 40 for a std::pmr::string, which only
+ * keeps 15 bytes inline) and, like it, always NUL-terminated. It follows the
+ * allocator rules of std::pmr::string: copies use the default resource unless
+ * given one, moves keep the resource of the moved string, and assignments
+ * keep the resource of the assigned one.
+ */
+class SmallString {
+public:
+  using allocator_type = std::pmr::polymorphic_allocator<char>;
+  using value_type = char;
+  using size_type = std::size_t;
+  using iterator = char *;
+  using const_iterator = const char *;
+
+  // Bytes stored without allocation
+  static constexpr std::size_t INLINE_CAPACITY{23};
+
+  SmallString() noexcept : SmallString(allocator_type{}) {}
+  explicit SmallString(const allocator_type &alloc) noexcept
+      : resource_(alloc.resource()) {
+    set_inline_size(0);
+  }
+  SmallString(std::string_view str, const allocator_type &alloc = {})
+      : SmallString(alloc) {
+    assign(str);
+  }
+  SmallString(const char *str, const allocator_type &alloc = {})
+      : SmallString(std::string_view{str}, alloc) {}
+  SmallString(const char *str, std::size_t size,
+              const allocator_type &alloc = {})
+      : SmallString(std::string_view{str, size}, alloc) {}
+
+  SmallString(const SmallString &other) : SmallString(other.view()) {}
+  SmallString(const SmallString &other, const allocator_type &alloc)
+      : SmallString(other.view(), alloc) {}
+  SmallString(SmallString &&other) noexcept;
+  SmallString(SmallString &&other, const allocator_type &alloc);
+
+  SmallString &operator=(const SmallString &other) {
+    if (this != &other)
+      assign(other.view());
+    return *this;
+  }
+  SmallString &operator=(SmallString &&other);
+  SmallString &operator=(std::string_view str) {
+    assign(str);
+    return *this;
+  }
+  SmallString &operator=(const char *str) {
+    assign(std::string_view{str});
+    return *this;
+  }
+
+  ~SmallString() { release(); }
+
+  // ==========================================================================
+  // Content
+  // ==========================================================================
+
+  inline bool is_inline() const { return bytes_[FLAG] != HEAP; }
+  inline std::size_t size() const {
+    return is_inline() ? INLINE_CAPACITY - bytes_[FLAG] : load<std::size_t>(8);
+  }
+  inline std::size_t length() const { return size(); }
+  inline bool empty() const { return size() == 0; }
+  inline std::size_t capacity() const {
+    return is_inline() ? INLINE_CAPACITY : load<uint32_t>(16);
+  }
+
+  inline char *data() {
+    return is_inline() ? reinterpret_cast<char *>(bytes_) : load<char *>(0);
+  }
+  inline const char *data() const {
+    return is_inline() ? reinterpret_cast<const char *>(bytes_)
+                       : load<char *>(0);
+  }
+  inline const char *c_str() const { return data(); }
+
+  inline char *begin() { return data(); }
+  inline char *end() { return data() + size(); }
+  inline const char *begin() const { return data(); }
+  inline const char *end() const { return data() + size(); }
+
+  inline char &operator[](std::size_t i) { return data()[i]; }
+  inline const char &operator[](std::size_t i) const { return data()[i]; }
+
+  inline std::string_view view() const { return {data(), size()}; }
+  inline operator std::string_view() const { return view(); }
+
+  inline allocator_type get_allocator() const { return {resource_}; }
+
+  // ==========================================================================
+  // Modifiers
+  // ==========================================================================
+
+  /**
+   * @brief Replace the content, reusing the current storage if large enough
+   */
+  void assign(std::string_view str);
+  inline void assign(const char *str, std::size_t size) {
+    assign(std::string_view{str, size});
+  }
+
+  /**
+   * @brief Make room for size bytes, keeping the content
+   */
+  void reserve(std::size_t size);
+
+  /**
+   * @brief Change the size, the added bytes being NUL
+   */
+  void resize(std::size_t size);
+
+  inline void clear() { set_size(0); }
+
+  /**
+   * @brief Swap the contents, along with the resources
+   */
+  void swap(SmallString &other) noexcept;
+
+  // ==========================================================================
+  // Comparisons
+  // ==========================================================================
+
+  friend inline bool operator==(const SmallString &a, const SmallString &b) {
+    return a.view() == b.view();
+  }
+  friend inline bool operator==(const SmallString &a, std::string_view b) {
+    return a.view() == b;
+  }
+  friend inline bool operator==(const SmallString &a, const char *b) {
+    return a.view() == b;
+  }
+  friend inline std::strong_ordering operator<=>(const SmallString &a,
+                                                 const SmallString &b) {
+    return a.view() <=> b.view();
+  }
+  friend inline std::strong_ordering operator<=>(const SmallString &a,
+                                                 std::string_view b) {
+    return a.view() <=> b;
+  }
+  friend inline std::strong_ordering operator<=>(const SmallString &a,
+                                                 const char *b) {
+    return a.view() <=> std::string_view{b};
+  }
+
+private:
+  // Last byte of the storage: INLINE_CAPACITY - size for the inline strings
+  // (so that it is the NUL of a full one), HEAP for the others
+  static constexpr std::size_t FLAG{INLINE_CAPACITY};
+  static constexpr uint8_t HEAP{0x80};
+
+  // The heap strings store their buffer, size and capacity at the offsets 0,
+  // 8 and 16 of the storage
+  template <typename T> inline T load(std::size_t offset) const {
+    T value;
+    std::memcpy(&value, bytes_ + offset, sizeof(T));
+    return value;
+  }
+  template <typename T> inline void store(std::size_t offset, T value) {
+    std::memcpy(bytes_ + offset, &value, sizeof(T));
+  }
+
+  inline void set_inline_size(std::size_t size) {
+    bytes_[size] = 0;
+    bytes_[FLAG] = static_cast<uint8_t>(INLINE_CAPACITY - size);
+  }
+  inline void set_size(std::size_t size) {
+    if (is_inline())
+      set_inline_size(size);
+    else {
+      store<std::size_t>(8, size);
+      load<char *>(0)[size] = 0;
+    }
+  }
+
+  /**
+   * @brief Move the content to a heap buffer of the given capacity (throws
+   * std::length_error over 4 GB)
+   */
+  void grow(std::size_t capacity);
+
+  /**
+   * @brief Free the heap buffer, if any
+   */
+  void release();
+
+  alignas(8) uint8_t bytes_[INLINE_CAPACITY + 1];
+  std::pmr::memory_resource *resource_;
+};
+
+static_assert(sizeof(SmallString) == 32);
+
+} // namespace minecraft::nbt
+
+template <> struct std::hash<minecraft::nbt::SmallString> {
+  inline std::size_t
+  operator()(const minecraft::nbt::SmallString &str) const noexcept {
+    return std::hash<std::string_view>{}(str.view());
+  }
+};
+
+#endif
@@ -0,0 +1,281 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Snapshots of parsed documents: a relocatable binary layout of their tree,
+// memory-mapped and queried in place without parsing
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_SNAPSHOT_HPP
+#define SOLISMC_NBT_SNAPSHOT_HPP
+
+#include "minecraft/nbt/hash.hpp"
+#include "minecraft/nbt/tag.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace minecraft::nbt {
+
+// Version of the snapshot layout, snapshots of other versions are rebuilt
+constexpr uint32_t SNAPSHOT_VERSION{1};
+
+/**
+ * @brief Node of a snapshot (native-endian, 8-bytes aligned)
+ */
+struct SnapshotRecord {
+  uint8_t tag;      // Tags of the value
+  uint8_t elem_tag; // Tags of the elements of a list
+  uint16_t reserved;
+  uint32_t size;  // Elements of a list, array or compound, length of a string
+  uint64_t value; // Bits of a scalar, else offset of its content
+};
+
+/**
+ * @brief Entry of a compound in a snapshot, the entries being sorted by name
+ */
+struct SnapshotEntry {
+  uint32_t name; // Offset of the name
+  uint32_t name_size;
+  SnapshotRecord record;
+};
+
+/**
+ * @brief Header of a snapshot
+ */
+struct SnapshotHeader {
+  char magic[8];       // "NBTSNAP\0"
+  uint32_t version;    // SNAPSHOT_VERSION
+  uint32_t byte_order; // 0x01020304 in the byte order of the writer
+  Hash source_hash;    // Of the bytes of the source document
+  uint64_t size;       // Of the whole snapshot
+  uint32_t name;       // Offset of the name of the root
+  uint32_t name_size;
+  SnapshotRecord root;
+};
+
+/**
+ * @brief Value of a snapshot, viewing its bytes.
+ *
+ * The strings and arrays are views on the snapshot, the arrays being stored
+ * decoded. Looking up a missing entry or element gives an invalid value (of
+ * tag END), so that the lookups can be chained:
+ * @code
+ * const auto x = snapshot.root().find("Level").find("xPos").get<int32_t>();
+ * @endcode
+ */
+class SnapshotValue {
+public:
+  SnapshotValue() = default;
+  SnapshotValue(const StreamChar *base, const SnapshotRecord *record)
+      : base_(base), record_(record) {}
+
+  inline Tags tag() const {
+    return record_ ? static_cast<Tags>(record_->tag) : Tags::END;
+  }
+  inline explicit operator bool() const { return record_ != nullptr; }
+
+  /**
+   * @brief Elements of a list, array or compound, length of a string
+   */
+  inline std::size_t size() const { return record_ ? record_->size : 0; }
+
+  /**
+   * @brief Tag of the elements of a list
+   */
+  inline Tags elem_tag() const {
+    return record_ ? static_cast<Tags>(record_->elem_tag) : Tags::END;
+  }
+
+  /**
+   * @brief Value of a scalar (int8_t ... int64_t, float, double), 0 on type
+   * mismatch
+   */
+  template <typename T> inline T get() const {
+    if (tag() != getTag<T>())
+      return T{};
+    if constexpr (std::is_same_v<T, float>)
+      return std::bit_cast<float>(static_cast<uint32_t>(record_->value));
+    else if constexpr (std::is_same_v<T, double>)
+      return std::bit_cast<double>(record_->value);
+    else
+      return static_cast<T>(record_->value);
+  }
+
+  /**
+   * @brief Content of a string, empty on type mismatch
+   */
+  inline std::string_view string() const {
+    if (tag() != Tags::String)
+      return {};
+    return {reinterpret_cast<const char *>(base_ + record_->value),
+            record_->size};
+  }
+
+  /**
+   * @brief Elements of an array (int8_t, int32_t or int64_t), empty on type
+   * mismatch
+   */
+  template <typename T> inline std::span<const T> array() const {
+    if (tag() != getTag<std::vector<T>>())
+      return {};
+    return {reinterpret_cast<const T *>(base_ + record_->value),
+            record_->size};
+  }
+
+  /**
+   * @brief Element of a list, invalid if out of range
+   */
+  inline SnapshotValue operator[](std::size_t i) const {
+    if (tag() != Tags::List || i >= record_->size)
+      return {};
+    return {base_, records() + i};
+  }
+
+  /**
+   * @brief Entry of a compound, invalid if missing (binary search)
+   */
+  inline SnapshotValue find(std::string_view name) const {
+    if (tag() != Tags::Compound)
+      return {};
+    const auto *first = entries(), *last = first + record_->size;
+    const auto *it = std::lower_bound(
+        first, last, name, [this](const SnapshotEntry &entry, auto key) {
+          return entry_name(entry) < key;
+        });
+    if (it == last || entry_name(*it) != name)
+      return {};
+    return {base_, &it->record};
+  }
+
+  /**
+   * @brief Name of the i-th entry of a compound (in name order)
+   */
+  inline std::string_view name_at(std::size_t i) const {
+    return entry_name(entries()[i]);
+  }
+
+  /**
+   * @brief Value of the i-th entry of a compound (in name order)
+   */
+  inline SnapshotValue value_at(std::size_t i) const {
+    return {base_, &entries()[i].record};
+  }
+
+  /**
+   * @brief Copy the value into a tree
+   */
+  Tag to_tag(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      const;
+
+private:
+  inline const SnapshotRecord *records() const {
+    return reinterpret_cast<const SnapshotRecord *>(base_ + record_->value);
+  }
+  inline const SnapshotEntry *entries() const {
+    return reinterpret_cast<const SnapshotEntry *>(base_ + record_->value);
+  }
+  inline std::string_view entry_name(const SnapshotEntry &entry) const {
+    return {reinterpret_cast<const char *>(base_ + entry.name),
+            entry.name_size};
+  }
+
+  const StreamChar *base_ = nullptr;
+  const SnapshotRecord *record_ = nullptr;
+};
+
+/**
+ * @brief Snapshot of a parsed document, memory-mapped from its file (or held
+ * in memory).
+ *
+ * Opening a snapshot only checks its header: the nodes are read in place
+ * when queried, so a snapshot must come from build_snapshot (see verify()
+ * for the snapshots of untrusted origin).
+ */
+class Snapshot {
+public:
+  /**
+   * @brief Map a snapshot file
+   *
+   * @return the snapshot, nothing if the file can't be read, is not a
+   * snapshot, or one of another version or byte order
+   */
+  static std::optional<Snapshot> open(const std::filesystem::path &path);
+
+  /**
+   * @brief Use a snapshot held in memory
+   */
+  static std::optional<Snapshot> from_bytes(std::vector<StreamChar> bytes);
+
+  Snapshot(Snapshot &&other) noexcept;
+  Snapshot &operator=(Snapshot &&other) noexcept;
+  ~Snapshot();
+
+  inline SnapshotValue root() const { return {data_, &header().root}; }
+  inline std::string_view root_name() const {
+    return {reinterpret_cast<const char *>(data_ + header().name),
+            header().name_size};
+  }
+  inline Hash source_hash() const { return header().source_hash; }
+  inline std::span<const StreamChar> bytes() const { return {data_, size_}; }
+
+  /**
+   * @brief Check that every node, string and array lies in the snapshot
+   */
+  bool verify() const;
+
+private:
+  Snapshot() = default;
+  inline const SnapshotHeader &header() const {
+    return *reinterpret_cast<const SnapshotHeader *>(data_);
+  }
+  bool check_header() const;
+
+  const StreamChar *data_ = nullptr;
+  std::size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<StreamChar> owned_;
+};
+
+/**
+ * @brief Build the snapshot of a tree
+ *
+ * The identical strings (names and values) are stored once.
+ *
+ * @param source_hash hash of the bytes of the source document
+ * @return the snapshot, nothing if it would exceed 4 GB
+ */
+std::optional<std::vector<StreamChar>>
+build_snapshot(const Tag &root, std::string_view name = "",
+               Hash source_hash = 0);
+
+/**
+ * @brief Load the snapshot of a (possibly compressed) document, rebuilding it
+ * if it is missing or stale.
+ *
+ * The source is hashed (without being parsed) and compared with the hash
+ * recorded in the snapshot. If they differ, the source is parsed and its
+ * snapshot written next to the given path and renamed over it.
+ *
+ * @return the snapshot (held in memory if it couldn't be written), nothing if
+ * the source can't be read or parsed
+ */
+std::optional<Snapshot> load_snapshot(const std::filesystem::path &source,
+                                      const std::filesystem::path &snapshot);
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,174 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Parsing statistics and counters
+//
+// The counters are only maintained when the library is compiled with
+// NBT_STATS=1. Otherwise every hook is discarded at compile time and the
+// getters return empty statistics.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_STATS_HPP
+#define SOLISMC_NBT_STATS_HPP
+
+#include "minecraft/nbt/types.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#ifndef NBT_STATS
+#define NBT_STATS 0
+#endif
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Whether the statistics counters are compiled in the library
+ */
+constexpr bool STATS_ENABLED{NBT_STATS != 0};
+
+// Number of tag types tracked by the statistics (END to LongArray)
+constexpr std::size_t N_STATS_TAGS{13};
+
+/**
+ * @brief Statistics of the parsing, parametrized on the counter type so that
+ * the same layout is used for the live (per-thread) counters and for the
+ * exported snapshots.
+ */
+template <typename C> struct BasicParseStats {
+  C bytes{};            // Bytes consumed by the tree parsers
+  C compressed_bytes{}; // Bytes consumed by the readers before inflating
+  C documents{};        // Documents completely parsed
+  C failures{};         // Parsing that ended with FAILED
+  C resumptions{};      // Parsing interrupted with UNFINISHED
+  C allocations{};      // Heap allocations requested for the parsed trees
+  C allocated_bytes{};  // Bytes requested by these allocations
+  C inflate_ns{};       // Time spent decompressing
+  C parse_ns{};         // Time spent parsing the decompressed bytes
+  C largest_array{};    // Largest array or list (number of elements)
+  C largest_string{};   // Largest string (bytes)
+  std::array<C, N_STATS_TAGS> values{}; // Values parsed per tag type
+};
+
+/**
+ * @brief Snapshot of the parsing statistics
+ */
+struct ParseStats : BasicParseStats<uint64_t> {
+  /**
+   * @brief Aggregate other statistics in these ones (sums and maxima)
+   */
+  ParseStats &operator+=(const ParseStats &other);
+};
+
+/**
+ * @brief Statistics of the calling thread
+ */
+ParseStats thread_stats();
+
+/**
+ * @brief Statistics aggregated over every thread (alive or exited)
+ */
+ParseStats collect_stats();
+
+/**
+ * @brief Reset the statistics of the calling thread
+ */
+void reset_thread_stats();
+
+/**
+ * @brief Export the statistics in the Prometheus text exposition format
+ *
+ * @param prefix prefix of the metrics names
+ */
+std::string to_prometheus(const ParseStats &stats,
+                          std::string_view prefix = "solismc_nbt");
+
+// ============================================================================
+// Instrumentation hooks (used by the parsers)
+// ============================================================================
+namespace stats {
+
+/**
+ * @brief Counter only written by its owning thread but readable from any
+ * other: updates are plain relaxed load/store, no locked instruction.
+ */
+struct Counter {
+  std::atomic<uint64_t> value{0};
+
+  inline void add(uint64_t n) {
+    value.store(value.load(std::memory_order_relaxed) + n,
+                std::memory_order_relaxed);
+  }
+  inline void max(uint64_t n) {
+    if (n > value.load(std::memory_order_relaxed))
+      value.store(n, std::memory_order_relaxed);
+  }
+  inline uint64_t get() const { return value.load(std::memory_order_relaxed); }
+};
+
+using LiveStats = BasicParseStats<Counter>;
+
+/**
+ * @brief Live counters of the calling thread
+ */
+LiveStats &local();
+
+/**
+ * @brief Monotonic clock in nanoseconds, used for the timings
+ */
+inline uint64_t now_ns() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+/**
+ * @brief Count an allocation of n bytes for the parsed tree
+ */
+inline void allocation(std::size_t n) {
+  if constexpr (STATS_ENABLED) {
+    auto &s = local();
+    s.allocations.add(1);
+    s.allocated_bytes.add(n);
+  }
+}
+
+/**
+ * @brief Track the size of a parsed array or list (number of elements)
+ */
+inline void array_size(std::size_t n) {
+  if constexpr (STATS_ENABLED)
+    local().largest_array.max(n);
+}
+
+/**
+ * @brief Track the size of a parsed string (bytes)
+ */
+inline void string_size(std::size_t n) {
+  if constexpr (STATS_ENABLED)
+    local().largest_string.max(n);
+}
+
+/**
+ * @brief Count a parsed value of the given (valid) tag type
+ */
+inline void value(TagID_t tag) {
+  if constexpr (STATS_ENABLED)
+    local().values[tag].add(1);
+}
+
+} // namespace stats
+
+} // namespace minecraft::nbt
+
+#endif
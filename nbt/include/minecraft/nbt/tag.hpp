@@ -0,0 +1,389 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Definition of the NBT tree (tag values, lists and compounds)
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_TAG_HPP
+#define SOLISMC_NBT_TAG_HPP
+
+#include "minecraft/nbt/small_string.hpp"
+#include "minecraft/nbt/types.hpp"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace minecraft::nbt {
+
+struct Tag;
+
+// ============================================================================
+// Containers
+// ============================================================================
+
+// Every container of the tree is allocated from a std::pmr::memory_resource
+// (the default resource if none is given), so that a whole tree can live in a
+// per-chunk arena or a per-thread pool.
+
+/**
+ * @brief NBT list of anonymous tags sharing the same type
+ */
+struct List : std::pmr::vector<Tag> {
+  using std::pmr::vector<Tag>::vector;
+
+  Tags elem_tag{Tags::END};
+
+  bool operator==(const List &other) const;
+};
+
+/**
+ * @brief NBT compound, mapping tag names to their values.
+ *
+ * The entries are stored contiguously in their insertion order, so that a
+ * parsed compound is written back byte for byte and walked without chasing
+ * pointers. The small compounds are searched linearly; past INDEX_THRESHOLD
+ * entries, the names are indexed by an open-addressing table of their hashes.
+ *
+ * As in a std::map, the names are unique and must not be modified through
+ * the iterators (see rename()). Unlike a std::map, an insertion or an erasure
+ * invalidates the iterators and the references to the values.
+ */
+struct Compound {
+  using key_type = SmallString;
+  using mapped_type = Tag;
+  using value_type = std::pair<SmallString, Tag>;
+  using allocator_type = std::pmr::polymorphic_allocator<value_type>;
+  using iterator = std::pmr::vector<value_type>::iterator;
+  using const_iterator = std::pmr::vector<value_type>::const_iterator;
+  using size_type = std::size_t;
+
+  // Number of entries from which the names are indexed
+  static constexpr std::size_t INDEX_THRESHOLD{8};
+
+  Compound() = default;
+  explicit Compound(const allocator_type &alloc)
+      : entries_(alloc), index_(alloc) {}
+
+  // ==========================================================================
+  // Entries
+  // ==========================================================================
+
+  inline std::size_t size() const { return entries_.size(); }
+  inline bool empty() const { return entries_.empty(); }
+  inline std::size_t capacity() const { return entries_.capacity(); }
+  inline void reserve(std::size_t size) { entries_.reserve(size); }
+
+  inline iterator begin() { return entries_.begin(); }
+  inline iterator end() { return entries_.end(); }
+  inline const_iterator begin() const { return entries_.begin(); }
+  inline const_iterator end() const { return entries_.end(); }
+  inline const_iterator cbegin() const { return entries_.cbegin(); }
+  inline const_iterator cend() const { return entries_.cend(); }
+
+  inline allocator_type get_allocator() const {
+    return entries_.get_allocator();
+  }
+
+  // ==========================================================================
+  // Lookup
+  // ==========================================================================
+
+  /**
+   * @brief Find the entry of the given name, or end()
+   */
+  iterator find(std::string_view name);
+  const_iterator find(std::string_view name) const;
+
+  bool contains(std::string_view name) const;
+  std::size_t count(std::string_view name) const;
+
+  /**
+   * @brief Access the value of the given name (throws std::out_of_range if
+   * there is none)
+   */
+  Tag &at(std::string_view name);
+  const Tag &at(std::string_view name) const;
+
+  // ==========================================================================
+  // Modifiers
+  // ==========================================================================
+
+  /**
+   * @brief Append an entry constructed from args, unless the name is already
+   * present
+   *
+   * @return the entry of the name, and whether it was inserted
+   */
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K &&name, Args &&...args);
+  template <typename K, typename... Args>
+  inline std::pair<iterator, bool> emplace(K &&name, Args &&...args) {
+    return try_emplace(std::forward<K>(name), std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Insert an entry before pos, unless the name is already present
+   *
+   * @return the entry of the name, and whether it was inserted
+   */
+  std::pair<iterator, bool> insert(const_iterator pos, value_type &&entry);
+
+  /**
+   * @brief Append an entry, or assign the value of the present one
+   *
+   * @return the entry of the name, and whether it was inserted
+   */
+  template <typename K, typename M>
+  std::pair<iterator, bool> insert_or_assign(K &&name, M &&value);
+
+  /**
+   * @brief Access the value of the given name, appending an END tag if absent
+   */
+  Tag &operator[](std::string_view name);
+
+  /**
+   * @brief Remove an entry, keeping the order of the others
+   *
+   * @return the iterator following the removed entry
+   */
+  iterator erase(const_iterator pos);
+  std::size_t erase(std::string_view name);
+
+  /**
+   * @brief Rename an entry in place, keeping its position
+   *
+   * @return false if another entry already has this name
+   */
+  bool rename(const_iterator pos, std::string_view name);
+
+  void clear();
+
+  /**
+   * @brief Compare the entries of both compounds, whatever their order
+   */
+  bool operator==(const Compound &other) const;
+
+private:
+  /**
+   * @brief Slot of the name index: the 32 lower bits of the name hash and the
+   * position of its entry plus one (0 for the empty slots)
+   */
+  struct Slot {
+    uint32_t hash;
+    uint32_t position;
+  };
+
+  static inline uint32_t hash(std::string_view name) {
+    return static_cast<uint32_t>(std::hash<std::string_view>{}(name));
+  }
+
+  /**
+   * @brief Position of the entry of the given name, or size()
+   */
+  std::size_t position(std::string_view name) const;
+
+  /**
+   * @brief Index the last appended entry, growing the index if needed
+   */
+  void index_back();
+
+  /**
+   * @brief Rebuild the whole index (or drop it under INDEX_THRESHOLD)
+   */
+  void rebuild_index();
+
+  std::pmr::vector<value_type> entries_;
+  std::pmr::vector<Slot> index_;
+};
+
+// ============================================================================
+// Tag value
+// ============================================================================
+
+/**
+ * @brief Storage of a tag value. The alternative index of each type is its
+ * NBT tag ID, so that the variant can be dispatched on with a TagID_t.
+ */
+using TagVariant =
+    std::variant<std::monostate,            // Tags::END
+                 int8_t,                    // Tags::Byte
+                 int16_t,                   // Tags::Short
+                 int32_t,                   // Tags::Int
+                 int64_t,                   // Tags::Long
+                 float,                     // Tags::Float
+                 double,                    // Tags::Double
+                 std::pmr::vector<int8_t>,  // Tags::ByteArray
+                 SmallString,               // Tags::String
+                 List,                      // Tags::List
+                 Compound,                  // Tags::Compound
+                 std::pmr::vector<int32_t>, // Tags::IntArray
+                 std::pmr::vector<int64_t>  // Tags::LongArray
+                 >;
+
+/**
+ * @brief Number of valid tag IDs (END included)
+ */
+constexpr std::size_t N_TAGS{std::variant_size_v<TagVariant>};
+
+/**
+ * @brief C++ type stored in a Tag for the given NBT tag
+ */
+template <Tags TAG>
+using tag_type_t =
+    std::variant_alternative_t<static_cast<std::size_t>(TAG), TagVariant>;
+
+/**
+ * @brief Node of the NBT tree
+ */
+struct Tag : TagVariant {
+  using TagVariant::TagVariant;
+  using TagVariant::operator=;
+
+  /**
+   * @brief Get the NBT tag of the stored value
+   */
+  inline Tags tag() const { return static_cast<Tags>(index()); }
+
+  /**
+   * @brief Check whether the stored value is of type T
+   */
+  template <typename T> inline bool is() const {
+    return std::holds_alternative<T>(*this);
+  }
+
+  /**
+   * @brief Access the stored value as a T (throws std::bad_variant_access on
+   * type mismatch)
+   */
+  template <typename T> inline T &as() { return std::get<T>(*this); }
+  template <typename T> inline const T &as() const {
+    return std::get<T>(*this);
+  }
+
+  /**
+   * @brief Access the stored value as a T, or nullptr on type mismatch
+   */
+  template <typename T> inline T *as_ptr() { return std::get_if<T>(this); }
+  template <typename T> inline const T *as_ptr() const {
+    return std::get_if<T>(this);
+  }
+
+  bool operator==(const Tag &other) const {
+    return static_cast<const TagVariant &>(*this) ==
+           static_cast<const TagVariant &>(other);
+  }
+};
+
+inline bool List::operator==(const List &other) const {
+  return elem_tag == other.elem_tag &&
+         static_cast<const std::pmr::vector<Tag> &>(*this) ==
+             static_cast<const std::pmr::vector<Tag> &>(other);
+}
+
+inline std::size_t Compound::position(std::string_view name) const {
+  if (index_.empty()) {
+    // Small compound: linear search, on the sizes first
+    for (std::size_t i = 0; i < entries_.size(); i++) {
+      const auto &key = entries_[i].first;
+      if (key.size() == name.size() &&
+          std::memcmp(key.data(), name.data(), name.size()) == 0)
+        return i;
+    }
+    return entries_.size();
+  }
+
+  // Linear probing from the slot of the hash
+  const uint32_t h = hash(name);
+  const std::size_t mask = index_.size() - 1;
+  for (std::size_t i = h & mask;; i = (i + 1) & mask) {
+    const auto slot = index_[i];
+    if (slot.position == 0)
+      return entries_.size();
+    if (slot.hash == h && entries_[slot.position - 1].first == name)
+      return slot.position - 1;
+  }
+}
+
+inline Compound::iterator Compound::find(std::string_view name) {
+  return entries_.begin() + static_cast<std::ptrdiff_t>(position(name));
+}
+
+inline Compound::const_iterator Compound::find(std::string_view name) const {
+  return entries_.begin() + static_cast<std::ptrdiff_t>(position(name));
+}
+
+inline bool Compound::contains(std::string_view name) const {
+  return position(name) != entries_.size();
+}
+
+inline std::size_t Compound::count(std::string_view name) const {
+  return contains(name) ? 1 : 0;
+}
+
+template <typename K, typename... Args>
+std::pair<Compound::iterator, bool> Compound::try_emplace(K &&name,
+                                                          Args &&...args) {
+  if (auto it = find(std::string_view{name}); it != end())
+    return {it, false};
+  entries_.emplace_back(std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<K>(name)),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+  index_back();
+  return {std::prev(end()), true};
+}
+
+template <typename K, typename M>
+std::pair<Compound::iterator, bool> Compound::insert_or_assign(K &&name,
+                                                               M &&value) {
+  auto ret = try_emplace(std::forward<K>(name), std::forward<M>(value));
+  if (!ret.second)
+    ret.first->second = std::forward<M>(value);
+  return ret;
+}
+
+// ============================================================================
+// Type registration
+// ============================================================================
+template <> constexpr Tags getTag<std::string>() { return Tags::String; }
+template <> constexpr Tags getTag<std::pmr::string>() { return Tags::String; }
+template <> constexpr Tags getTag<SmallString>() { return Tags::String; }
+using String = NBTTypeInfo<SmallString>;
+template <> constexpr Tags getTag<std::vector<int8_t>>() {
+  return Tags::ByteArray;
+}
+template <> constexpr Tags getTag<std::pmr::vector<int8_t>>() {
+  return Tags::ByteArray;
+}
+using ByteArray = NBTTypeInfo<std::pmr::vector<int8_t>>;
+template <> constexpr Tags getTag<std::vector<int32_t>>() {
+  return Tags::IntArray;
+}
+template <> constexpr Tags getTag<std::pmr::vector<int32_t>>() {
+  return Tags::IntArray;
+}
+using IntArray = NBTTypeInfo<std::pmr::vector<int32_t>>;
+template <> constexpr Tags getTag<std::vector<int64_t>>() {
+  return Tags::LongArray;
+}
+template <> constexpr Tags getTag<std::pmr::vector<int64_t>>() {
+  return Tags::LongArray;
+}
+using LongArray = NBTTypeInfo<std::pmr::vector<int64_t>>;
+template <> constexpr Tags getTag<List>() { return Tags::List; }
+template <> constexpr Tags getTag<Compound>() { return Tags::Compound; }
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,78 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Validation of untrusted NBT documents, without parsing them
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_VALIDATE_HPP
+#define SOLISMC_NBT_VALIDATE_HPP
+
+#include "minecraft/nbt/parsers/base.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Limits on the content of a valid document
+ */
+struct ValidationLimits {
+  // Maximum nesting of compounds and lists that can be validated
+  static constexpr std::size_t MAX_DEPTH{512};
+
+  std::size_t max_depth = MAX_DEPTH; // Nesting of compounds and lists
+  // Elements of the lists and arrays plus entries of the compounds, in total
+  uint64_t max_elements = UINT64_MAX;
+  uint32_t max_array_size = INT32_MAX;  // Elements of a single list or array
+  uint16_t max_string_size = UINT16_MAX; // Bytes of a string or a name
+};
+
+/**
+ * @brief Reason a document is invalid
+ */
+enum class ValidationError : uint8_t {
+  NONE,
+  TRUNCATED,         // A length or value goes past the end of the document
+  INVALID_TAG,       // Unknown tag ID, or END as a value or list elements
+  NEGATIVE_SIZE,     // List or array of negative length
+  TOO_DEEP,          // Nesting over max_depth
+  TOO_MANY_ELEMENTS, // Elements over max_elements
+  ARRAY_TOO_LARGE,   // List or array over max_array_size
+  STRING_TOO_LONG,   // String or name over max_string_size
+};
+
+/**
+ * @brief Outcome of a validation
+ */
+struct Validation {
+  ValidationError error = ValidationError::NONE;
+  // Bytes of the document if valid, else position of the error
+  std::size_t offset = 0;
+
+  inline explicit operator bool() const {
+    return error == ValidationError::NONE;
+  }
+};
+
+/**
+ * @brief Check that a named tag (uncompressed) is well-formed and within the
+ * limits, before handing it to a parser.
+ *
+ * The document is walked without decoding nor allocating anything: the runs
+ * of fixed-size elements (arrays, lists of scalars) are skipped at once. Each
+ * length is checked against the remaining bytes, so a valid document can't
+ * make a parser reserve more than its own size in elements. The bytes after
+ * the document are not read (see Validation::offset).
+ */
+Validation validate(std::span<const StreamChar> document,
+                    const ValidationLimits &limits = {});
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,64 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Serialization of NBT trees
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_WRITER_HPP
+#define SOLISMC_NBT_WRITER_HPP
+
+#include "minecraft/nbt/diff.hpp"
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/tag.hpp"
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Append the payload of a tag (its value without type nor name)
+ */
+void write_payload(std::vector<StreamChar> &out, const Tag &tag);
+
+/**
+ * @brief Append a named tag (type, name & payload)
+ */
+void write_named(std::vector<StreamChar> &out, const Tag &tag,
+                 std::string_view name);
+
+/**
+ * @brief Serialize a whole (uncompressed) document
+ *
+ * @param name name of the root tag
+ */
+std::vector<StreamChar> serialize(const Tag &root, std::string_view name = "");
+
+/**
+ * @brief Serialize a modified tree, copying its unmodified subtrees from the
+ * bytes of the document it was parsed from.
+ *
+ * Only the modified subtrees are serialized, the compounds and lists on their
+ * paths being rebuilt from the tree. The entries and elements that are not
+ * under a modified path are copied from the original bytes: the caller must
+ * list every modification (an empty path standing for the whole tree). The
+ * ones missing from the original, or whose type changed, are serialized.
+ *
+ * @param original uncompressed document the tree was parsed from (its root
+ * name is kept)
+ * @param modified paths of the modified subtrees (descendants included)
+ * @return the new document, nothing if the original is invalid
+ */
+std::optional<std::vector<StreamChar>>
+serialize_modified(const Tag &root, std::span<const StreamChar> original,
+                   std::span<const Path> modified);
+
+} // namespace minecraft::nbt
+
+#endif
@@ -0,0 +1,42 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Coroutine-based asynchronous parsing implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/async.hpp"
+
+namespace minecraft::nbt {
+
+static_assert(ByteSource<MemorySource>);
+static_assert(ByteSource<PushSource>);
+
+void PushSource::push(std::span<const StreamChar> bytes) {
+  // Drop the consumed bytes before growing the buffer
+  if (pos_ > 0) {
+    buffer_.erase(buffer_.begin(),
+                  buffer_.begin() + static_cast<std::ptrdiff_t>(pos_));
+    pos_ = 0;
+  }
+  buffer_.insert(buffer_.end(), bytes.begin(), bytes.end());
+  if (!bytes.empty())
+    wake();
+}
+
+void PushSource::close() {
+  closed_ = true;
+  wake();
+}
+
+void PushSource::wake() {
+  if (auto h = std::exchange(waiting_, {}))
+    h.resume();
+}
+
+} // namespace minecraft::nbt
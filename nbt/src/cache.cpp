@@ -0,0 +1,449 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Bounded caches of decoded and compressed chunks implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/cache.hpp"
+#include "minecraft/nbt/lz4.hpp"
+#include "minecraft/nbt/reader.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+namespace minecraft::nbt {
+
+// First block of the arena of a chunk (the smallest chunks fit in it)
+static constexpr std::size_t CHUNK_ARENA_BLOCK{16 << 10};
+
+std::size_t ChunkKeyHash::operator()(const ChunkKey &key) const noexcept {
+  uint64_t h = static_cast<uint64_t>(static_cast<uint32_t>(key.x)) << 32 |
+               static_cast<uint32_t>(key.z);
+  h ^= static_cast<uint64_t>(static_cast<uint32_t>(key.dimension)) *
+       0xC2B2AE3D27D4EB4FULL;
+  h *= 0x9E3779B97F4A7C15ULL;
+  return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+// ============================================================================
+// Region loader
+// ============================================================================
+
+RegionLoader::RegionLoader(std::vector<std::filesystem::path> dimensions,
+                           std::size_t max_open)
+    : dimensions_(std::move(dimensions)),
+      max_open_(std::max<std::size_t>(max_open, 1)) {}
+
+std::shared_ptr<RegionLoader::Region>
+RegionLoader::get_region(const RegionKey &key) {
+  std::lock_guard lock{mutex_};
+  auto it = regions_.find(key);
+  if (it == regions_.end()) {
+    // Close the least recently used region (still open for its current
+    // readers)
+    if (regions_.size() >= max_open_)
+      regions_.erase(std::min_element(
+          regions_.begin(), regions_.end(), [](const auto &a, const auto &b) {
+            return a.second->last_use < b.second->last_use;
+          }));
+    it = regions_.emplace(key, std::make_shared<Region>()).first;
+  }
+  it->second->last_use = ++uses_;
+  return it->second;
+}
+
+std::optional<Tag> RegionLoader::operator()(
+    const ChunkKey &key, std::pmr::memory_resource *resource) {
+  if (key.dimension < 0 ||
+      static_cast<std::size_t>(key.dimension) >= dimensions_.size())
+    return std::nullopt;
+  const int32_t rx = key.x >> 5, rz = key.z >> 5;
+  const auto region = get_region({key.dimension, rx, rz});
+
+  std::vector<StreamChar> buffer;
+  std::optional<ChunkData> chunk;
+  {
+    std::lock_guard lock{region->mutex};
+    if (!region->opened) {
+      region->file = RegionFile::open(
+          dimensions_[static_cast<std::size_t>(key.dimension)] /
+          ("r." + std::to_string(rx) + "." + std::to_string(rz) + ".mca"));
+      region->opened = true;
+    }
+    if (!region->file)
+      return std::nullopt;
+    chunk = region->file->read_chunk(chunk_index(key.x, key.z), buffer);
+  }
+  // Decompressed & parsed out of the lock, with the backend of the chunk
+  // compression (in a buffer kept by the thread, as done by parse_chunk)
+  thread_local std::vector<StreamChar> document;
+  if (!chunk || !decompress_chunk(*chunk, document))
+    return std::nullopt;
+  return parse_bytes(document.data(), document.size(), resource);
+}
+
+// ============================================================================
+// Cache
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Memory resource counting the bytes allocated from its upstream
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+  std::size_t allocated = 0;
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    allocated += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    allocated -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+/**
+ * @brief A cached chunk with the arena its tree is allocated from
+ */
+struct CachedChunk {
+  CountingResource counter;
+  std::pmr::monotonic_buffer_resource arena{CHUNK_ARENA_BLOCK, &counter};
+  Tag root;
+
+  std::size_t size() const { return sizeof(CachedChunk) + counter.allocated; }
+};
+
+/**
+ * @brief Part of a cache, with its own lock and CLOCK eviction
+ *
+ * The removed values are moved to a list given by the caller, to be released
+ * out of the lock.
+ */
+template <typename V> struct ClockShard {
+  using Entries = std::vector<std::pair<ChunkKey, std::shared_ptr<const V>>>;
+
+  struct Slot {
+    ChunkKey key;
+    std::shared_ptr<const V> value; // nullptr for the free slots
+    std::size_t bytes = 0;
+    bool referenced = false; // Used since the clock hand last passed
+  };
+
+  mutable std::mutex mutex;
+  std::unordered_map<ChunkKey, std::size_t, ChunkKeyHash> index;
+  std::vector<Slot> slots;
+  std::vector<std::size_t> free_slots;
+  std::size_t hand = 0;
+  std::size_t bytes = 0;
+  uint64_t hits = 0, misses = 0, evictions = 0;
+
+  std::shared_ptr<const V> lookup(const ChunkKey &key) {
+    const auto it = index.find(key);
+    if (it == index.end())
+      return nullptr;
+    auto &slot = slots[it->second];
+    slot.referenced = true;
+    return slot.value;
+  }
+
+  void remove(std::size_t i, Entries &garbage) {
+    auto &slot = slots[i];
+    index.erase(slot.key);
+    bytes -= slot.bytes;
+    garbage.emplace_back(slot.key, std::move(slot.value));
+    slot = {};
+    free_slots.push_back(i);
+  }
+
+  bool erase(const ChunkKey &key, Entries &garbage) {
+    const auto it = index.find(key);
+    if (it == index.end())
+      return false;
+    remove(it->second, garbage);
+    return true;
+  }
+
+  void clear(Entries &garbage) {
+    for (std::size_t i = 0; i < slots.size(); i++)
+      if (slots[i].value != nullptr)
+        remove(i, garbage);
+  }
+
+  /**
+   * @brief Evict the first value not referenced since the hand last passed
+   */
+  void evict(Entries &evicted) {
+    while (true) {
+      if (hand >= slots.size())
+        hand = 0;
+      auto &slot = slots[hand];
+      if (slot.value != nullptr && !slot.referenced) {
+        remove(hand++, evicted);
+        evictions++;
+        return;
+      }
+      slot.referenced = false;
+      hand++;
+    }
+  }
+
+  void insert(const ChunkKey &key, std::shared_ptr<const V> value,
+              std::size_t size, std::size_t budget, Entries &evicted) {
+    while (!index.empty() && bytes + size > budget)
+      evict(evicted);
+    std::size_t i = slots.size();
+    if (free_slots.empty())
+      slots.emplace_back();
+    else {
+      i = free_slots.back();
+      free_slots.pop_back();
+    }
+    // Unreferenced until used again, so that the values inserted once are
+    // evicted before the ones used repeatedly
+    slots[i] = {.key = key,
+                .value = std::move(value),
+                .bytes = size,
+                .referenced = false};
+    index.emplace(key, i);
+    bytes += size;
+  }
+};
+
+} // namespace
+
+struct ChunkCache::Shard : ClockShard<Tag> {};
+
+// ============================================================================
+ChunkCache::ChunkCache(ChunkLoader loader, CacheOptions options)
+    : loader_(std::move(loader)), on_evict_(std::move(options.on_evict)) {
+  const auto n_shards = std::max<std::size_t>(options.n_shards, 1);
+  shard_budget_ = options.budget / n_shards;
+  for (std::size_t i = 0; i < n_shards; i++)
+    shards_.push_back(std::make_unique<Shard>());
+}
+
+ChunkCache::~ChunkCache() = default;
+
+ChunkCache::Shard &ChunkCache::shard(const ChunkKey &key) {
+  return *shards_[ChunkKeyHash{}(key) % shards_.size()];
+}
+
+std::shared_ptr<const Tag> ChunkCache::get(const ChunkKey &key) {
+  auto &s = shard(key);
+  {
+    std::lock_guard lock{s.mutex};
+    if (auto chunk = s.lookup(key)) {
+      s.hits++;
+      return chunk;
+    }
+    s.misses++;
+  }
+
+  // Load the chunk in its own arena
+  auto cached = std::make_shared<CachedChunk>();
+  auto root = loader_(key, &cached->arena);
+  if (!root)
+    return nullptr;
+  cached->root = std::move(*root);
+  const auto size = cached->size();
+  std::shared_ptr<const Tag> chunk{cached, &cached->root};
+
+  // Chunks larger than a shard are not cached
+  if (size > shard_budget_)
+    return chunk;
+  Shard::Entries evicted;
+  {
+    std::lock_guard lock{s.mutex};
+    // Loaded by another thread in the meantime
+    if (auto other = s.lookup(key))
+      return other;
+    s.insert(key, chunk, size, shard_budget_, evicted);
+  }
+  if (on_evict_)
+    for (const auto &[evicted_key, evicted_chunk] : evicted)
+      on_evict_(evicted_key, *evicted_chunk);
+  return chunk;
+}
+
+std::shared_ptr<const Tag> ChunkCache::find(const ChunkKey &key) {
+  auto &s = shard(key);
+  std::lock_guard lock{s.mutex};
+  auto chunk = s.lookup(key);
+  if (chunk)
+    s.hits++;
+  return chunk;
+}
+
+bool ChunkCache::erase(const ChunkKey &key) {
+  auto &s = shard(key);
+  Shard::Entries garbage;
+  std::lock_guard lock{s.mutex};
+  return s.erase(key, garbage);
+}
+
+void ChunkCache::clear() {
+  for (auto &s : shards_) {
+    Shard::Entries garbage;
+    std::lock_guard lock{s->mutex};
+    s->clear(garbage);
+  }
+}
+
+CacheStats ChunkCache::get_stats() const {
+  CacheStats stats;
+  for (const auto &s : shards_) {
+    std::lock_guard lock{s->mutex};
+    stats.hits += s->hits;
+    stats.misses += s->misses;
+    stats.evictions += s->evictions;
+    stats.entries += s->index.size();
+    stats.bytes += s->bytes;
+  }
+  return stats;
+}
+
+// ============================================================================
+// Compressed tier
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief A chunk serialized and compressed into a LZ4 block
+ */
+struct TierEntry {
+  std::vector<StreamChar> block;
+  std::size_t raw_size;
+
+  std::size_t size() const { return sizeof(TierEntry) + block.capacity(); }
+};
+
+} // namespace
+
+struct CompressedTier::Shard : ClockShard<TierEntry> {
+  std::size_t raw_bytes = 0;
+
+  void release(const Entries &garbage) {
+    for (const auto &entry : garbage)
+      raw_bytes -= entry.second->raw_size;
+  }
+};
+
+CompressedTier::CompressedTier(TierOptions options) {
+  const auto n_shards = std::max<std::size_t>(options.n_shards, 1);
+  shard_budget_ = options.budget / n_shards;
+  for (std::size_t i = 0; i < n_shards; i++)
+    shards_.push_back(std::make_unique<Shard>());
+}
+
+CompressedTier::~CompressedTier() = default;
+
+CompressedTier::Shard &CompressedTier::shard(const ChunkKey &key) {
+  return *shards_[ChunkKeyHash{}(key) % shards_.size()];
+}
+
+void CompressedTier::put(const ChunkKey &key, const Tag &chunk) {
+  put(key, serialize(chunk));
+}
+
+void CompressedTier::put(const ChunkKey &key,
+                         std::span<const StreamChar> document) {
+  // Compressed out of the lock, in a buffer reused by the thread
+  thread_local std::vector<StreamChar> buffer;
+  lz4_compress(document, buffer);
+  auto entry = std::make_shared<TierEntry>(
+      TierEntry{{buffer.begin(), buffer.end()}, document.size()});
+  const auto size = entry->size();
+
+  auto &s = shard(key);
+  Shard::Entries garbage;
+  std::lock_guard lock{s.mutex};
+  s.erase(key, garbage);
+  // Chunks larger than a shard are not kept
+  if (size <= shard_budget_) {
+    s.insert(key, std::move(entry), size, shard_budget_, garbage);
+    s.raw_bytes += document.size();
+  }
+  s.release(garbage);
+}
+
+std::optional<Tag> CompressedTier::get(const ChunkKey &key,
+                                       std::pmr::memory_resource *resource) {
+  auto &s = shard(key);
+  std::shared_ptr<const TierEntry> entry;
+  {
+    std::lock_guard lock{s.mutex};
+    entry = s.lookup(key);
+    if (entry == nullptr) {
+      s.misses++;
+      return std::nullopt;
+    }
+    s.hits++;
+  }
+
+  // Decoded out of the lock
+  thread_local std::vector<StreamChar> buffer;
+  buffer.resize(entry->raw_size);
+  if (!lz4_decompress(entry->block, buffer))
+    return std::nullopt;
+  return parse_bytes(buffer.data(), buffer.size(), resource);
+}
+
+bool CompressedTier::erase(const ChunkKey &key) {
+  auto &s = shard(key);
+  Shard::Entries garbage;
+  std::lock_guard lock{s.mutex};
+  const bool erased = s.erase(key, garbage);
+  s.release(garbage);
+  return erased;
+}
+
+void CompressedTier::clear() {
+  for (auto &s : shards_) {
+    Shard::Entries garbage;
+    std::lock_guard lock{s->mutex};
+    s->clear(garbage);
+    s->release(garbage);
+  }
+}
+
+ChunkLoader CompressedTier::over(ChunkLoader fallback) {
+  return [this, fallback = std::move(fallback)](
+             const ChunkKey &key,
+             std::pmr::memory_resource *resource) -> std::optional<Tag> {
+    if (auto chunk = get(key, resource))
+      return chunk;
+    return fallback(key, resource);
+  };
+}
+
+TierStats CompressedTier::get_stats() const {
+  TierStats stats;
+  for (const auto &s : shards_) {
+    std::lock_guard lock{s->mutex};
+    stats.hits += s->hits;
+    stats.misses += s->misses;
+    stats.evictions += s->evictions;
+    stats.entries += s->index.size();
+    stats.bytes += s->bytes;
+    stats.raw_bytes += s->raw_bytes;
+  }
+  return stats;
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,285 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Pull parsing of NBT documents implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/cursor.hpp"
+#include <bit>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Size of the payload of the fixed-size tags (0 for the others)
+ */
+static constexpr std::size_t fixed_size(Tags tag) {
+  switch (tag) {
+  case Tags::Byte:
+    return 1;
+  case Tags::Short:
+    return 2;
+  case Tags::Int:
+  case Tags::Float:
+    return 4;
+  case Tags::Long:
+  case Tags::Double:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief Size of the elements of the array tags (0 for the others)
+ */
+static constexpr std::size_t array_elem_size(Tags tag) {
+  switch (tag) {
+  case Tags::ByteArray:
+    return 1;
+  case Tags::IntArray:
+    return 4;
+  case Tags::LongArray:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+// ============================================================================
+// Tokens
+// ============================================================================
+
+template <typename T> T Token::get() const {
+  if constexpr (std::is_same_v<T, std::string_view>)
+    return {reinterpret_cast<const char *>(payload.data()), payload.size()};
+  else {
+    if (payload.size() < sizeof(T))
+      return T{};
+    if constexpr (std::is_same_v<T, float>)
+      return std::bit_cast<float>(
+          load_integral<int32_t, NBT_BIG_ENDIAN>(payload.data()));
+    else if constexpr (std::is_same_v<T, double>)
+      return std::bit_cast<double>(
+          load_integral<int64_t, NBT_BIG_ENDIAN>(payload.data()));
+    else
+      return load_integral<T, NBT_BIG_ENDIAN>(payload.data());
+  }
+}
+
+template int8_t Token::get<int8_t>() const;
+template int16_t Token::get<int16_t>() const;
+template int32_t Token::get<int32_t>() const;
+template int64_t Token::get<int64_t>() const;
+template float Token::get<float>() const;
+template double Token::get<double>() const;
+template std::string_view Token::get<std::string_view>() const;
+
+template <typename T> T Token::at(std::size_t i) const {
+  return load_integral<T, NBT_BIG_ENDIAN>(payload.data() + i * sizeof(T));
+}
+
+template int8_t Token::at<int8_t>(std::size_t) const;
+template int32_t Token::at<int32_t>(std::size_t) const;
+template int64_t Token::at<int64_t>(std::size_t) const;
+
+// ============================================================================
+// Cursor
+// ============================================================================
+
+std::nullopt_t Cursor::fail() {
+  failed_ = true;
+  return std::nullopt;
+}
+
+std::optional<Token> Cursor::next() {
+  if (failed_)
+    return std::nullopt;
+  begun_ = false;
+  const StreamChar *b = document_.data();
+  const std::size_t n = document_.size();
+  Token token;
+
+  // Type & name of the value
+  bool named = true;
+  if (depth_ == 0) {
+    if (started_)
+      return std::nullopt;
+    started_ = true;
+    if (n - pos_ < 1)
+      return fail();
+    token.tag = static_cast<Tags>(b[pos_++]);
+  } else if (auto &frame = stack_[depth_ - 1]; frame.tag == Tags::Compound) {
+    if (n - pos_ < 1)
+      return fail();
+    token.tag = static_cast<Tags>(b[pos_++]);
+    if (token.tag == Tags::END) {
+      depth_--;
+      token.kind = TokenKind::END;
+      token.tag = Tags::Compound;
+      return token;
+    }
+  } else {
+    if (frame.remaining == 0) {
+      depth_--;
+      token.kind = TokenKind::END;
+      token.tag = Tags::List;
+      return token;
+    }
+    frame.remaining--;
+    token.tag = frame.elem_tag;
+    named = false;
+  }
+  if (named) {
+    if (n - pos_ < 2)
+      return fail();
+    const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos_);
+    if (n - pos_ - 2 < length)
+      return fail();
+    token.name = {reinterpret_cast<const char *>(b + pos_ + 2), length};
+    pos_ += 2 + length;
+  }
+
+  // Payload
+  if (const auto size = fixed_size(token.tag)) {
+    if (n - pos_ < size)
+      return fail();
+    token.payload = {b + pos_, size};
+    pos_ += size;
+  } else if (const auto elem = array_elem_size(token.tag)) {
+    if (n - pos_ < 4)
+      return fail();
+    const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(b + pos_);
+    if (count < 0 || (n - pos_ - 4) / elem < static_cast<std::size_t>(count))
+      return fail();
+    token.size = static_cast<uint32_t>(count);
+    token.payload = {b + pos_ + 4, token.size * elem};
+    pos_ += 4 + token.payload.size();
+  } else if (token.tag == Tags::String) {
+    if (n - pos_ < 2)
+      return fail();
+    const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos_);
+    if (n - pos_ - 2 < length)
+      return fail();
+    token.payload = {b + pos_ + 2, length};
+    pos_ += 2 + length;
+  } else if (token.tag == Tags::List || token.tag == Tags::Compound) {
+    if (depth_ >= MAX_DEPTH)
+      return fail();
+    auto &frame = stack_[depth_];
+    frame = {.tag = token.tag,
+             .elem_tag = Tags::END,
+             .remaining = 0,
+             .start = pos_};
+    if (token.tag == Tags::List) {
+      if (n - pos_ < 5)
+        return fail();
+      const auto elem_tag = static_cast<Tags>(b[pos_]);
+      const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(b + pos_ + 1);
+      if (count < 0 ||
+          (count > 0 && (elem_tag == Tags::END || elem_tag > Tags::LongArray)))
+        return fail();
+      pos_ += 5;
+      token.elem_tag = frame.elem_tag = elem_tag;
+      token.size = frame.remaining = static_cast<uint32_t>(count);
+    }
+    depth_++;
+    token.kind = TokenKind::BEGIN;
+    begun_ = true;
+  } else
+    return fail();
+  return token;
+}
+
+std::optional<std::span<const StreamChar>> Cursor::skip_value() {
+  if (!begun_ || failed_)
+    return std::nullopt;
+  begun_ = false;
+  const StreamChar *b = document_.data();
+  const std::size_t n = document_.size();
+  const std::size_t target = depth_ - 1;
+  const std::size_t start = stack_[target].start;
+
+  // Same walk as next(), without producing the tokens
+  while (depth_ > target) {
+    auto &frame = stack_[depth_ - 1];
+    Tags tag;
+    if (frame.tag == Tags::Compound) {
+      if (n - pos_ < 1)
+        return fail();
+      tag = static_cast<Tags>(b[pos_++]);
+      if (tag == Tags::END) {
+        depth_--;
+        continue;
+      }
+      if (n - pos_ < 2)
+        return fail();
+      const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos_);
+      if (n - pos_ - 2 < length)
+        return fail();
+      pos_ += 2 + length;
+    } else if (const auto size = fixed_size(frame.elem_tag)) {
+      // Elements of fixed size skipped at once
+      if ((n - pos_) / size < frame.remaining)
+        return fail();
+      pos_ += frame.remaining * size;
+      depth_--;
+      continue;
+    } else {
+      if (frame.remaining == 0) {
+        depth_--;
+        continue;
+      }
+      frame.remaining--;
+      tag = frame.elem_tag;
+    }
+
+    if (const auto size = fixed_size(tag)) {
+      if (n - pos_ < size)
+        return fail();
+      pos_ += size;
+    } else if (const auto elem = array_elem_size(tag)) {
+      if (n - pos_ < 4)
+        return fail();
+      const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(b + pos_);
+      if (count < 0 || (n - pos_ - 4) / elem < static_cast<std::size_t>(count))
+        return fail();
+      pos_ += 4 + static_cast<std::size_t>(count) * elem;
+    } else if (tag == Tags::String) {
+      if (n - pos_ < 2)
+        return fail();
+      const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos_);
+      if (n - pos_ - 2 < length)
+        return fail();
+      pos_ += 2 + length;
+    } else if (tag == Tags::List || tag == Tags::Compound) {
+      if (depth_ >= MAX_DEPTH)
+        return fail();
+      auto &child = stack_[depth_++];
+      child = {
+          .tag = tag, .elem_tag = Tags::END, .remaining = 0, .start = pos_};
+      if (tag == Tags::List) {
+        if (n - pos_ < 5)
+          return fail();
+        child.elem_tag = static_cast<Tags>(b[pos_]);
+        const auto count =
+            load_integral<int32_t, NBT_BIG_ENDIAN>(b + pos_ + 1);
+        if (count < 0 ||
+            (count > 0 &&
+             (child.elem_tag == Tags::END || child.elem_tag > Tags::LongArray)))
+          return fail();
+        child.remaining = static_cast<uint32_t>(count);
+        pos_ += 5;
+      }
+    } else
+      return fail();
+  }
+  return document_.subspan(start, pos_ - start);
+}
+
+} // namespace minecraft::nbt
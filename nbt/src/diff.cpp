@@ -0,0 +1,541 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Structural diff and patch of NBT documents implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/diff.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/raw.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace minecraft::nbt {
+
+// Deepest subtree descended into, deeper changes replace the whole subtree
+static constexpr std::size_t MAX_DEPTH{512};
+// Equal elements between two changed runs of an array below which the runs
+// are merged into a single splice
+static constexpr std::size_t SPLICE_GAP{8};
+
+// ============================================================================
+// Diff
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Comparison of two documents, emitting the editions in a patch
+ */
+struct Differ {
+  Patch &patch;
+  Path path;
+
+  static bool equal(std::span<const StreamChar> a,
+                    std::span<const StreamChar> b) {
+    return a.size() == b.size() &&
+           std::memcmp(a.data(), b.data(), a.size()) == 0;
+  }
+
+  void emit(PatchOp op, Tags tag, std::span<const StreamChar> payload,
+            uint32_t offset = 0, uint32_t length = 0) {
+    patch.entries.push_back({.op = op,
+                             .path = path,
+                             .tag = tag,
+                             .offset = offset,
+                             .length = length,
+                             .payload = {payload.begin(), payload.end()}});
+  }
+
+  /**
+   * @brief Compare two values of the same type
+   *
+   * @return false if a value is invalid
+   */
+  bool diff_value(Tags tag, std::span<const StreamChar> a,
+                  std::span<const StreamChar> b) {
+    if (equal(a, b))
+      return true;
+    if (path.size() < MAX_DEPTH) {
+      switch (tag) {
+      case Tags::Compound:
+        return diff_compound(a, b);
+      case Tags::List:
+        return diff_list(a, b);
+      case Tags::ByteArray:
+        return diff_array<int8_t>(tag, a, b);
+      case Tags::IntArray:
+        return diff_array<int32_t>(tag, a, b);
+      case Tags::LongArray:
+        return diff_array<int64_t>(tag, a, b);
+      default:
+        break;
+      }
+    }
+    emit(PatchOp::SET, tag, b);
+    return true;
+  }
+
+  bool diff_compound(std::span<const StreamChar> a,
+                     std::span<const StreamChar> b) {
+    std::vector<RawTag> old_entries, new_entries;
+    if (!read_entries(a, old_entries) || !read_entries(b, new_entries))
+      return false;
+
+    // Entries are matched by name
+    std::unordered_map<std::string_view, std::size_t> new_index;
+    new_index.reserve(new_entries.size());
+    for (std::size_t i = 0; i < new_entries.size(); i++)
+      new_index.emplace(new_entries[i].name, i);
+    std::vector<std::size_t> matches(old_entries.size(), new_entries.size());
+    std::vector<bool> matched(new_entries.size(), false);
+    std::size_t last = 0;
+    for (std::size_t i = 0; i < old_entries.size(); i++) {
+      const auto it = new_index.find(old_entries[i].name);
+      if (it == new_index.end())
+        continue;
+      // Reordered entries: the patch couldn't restore their order
+      if (it->second < last) {
+        emit(PatchOp::SET, Tags::Compound, b);
+        return true;
+      }
+      last = it->second;
+      matches[i] = it->second;
+      matched[it->second] = true;
+    }
+
+    for (std::size_t i = 0; i < old_entries.size(); i++) {
+      const auto &old_entry = old_entries[i];
+      path.emplace_back(std::string{old_entry.name});
+      bool ok = true;
+      if (matches[i] == new_entries.size())
+        emit(PatchOp::REMOVE, Tags::END, {});
+      else {
+        const auto &new_entry = new_entries[matches[i]];
+        if (new_entry.tag != old_entry.tag)
+          emit(PatchOp::SET, new_entry.tag, new_entry.payload);
+        else
+          ok = diff_value(new_entry.tag, old_entry.payload, new_entry.payload);
+      }
+      path.pop_back();
+      if (!ok)
+        return false;
+    }
+
+    // Added entries, inserted in order once the removed ones are gone
+    for (std::size_t i = 0; i < new_entries.size(); i++) {
+      if (matched[i])
+        continue;
+      path.emplace_back(std::string{new_entries[i].name});
+      emit(PatchOp::SET, new_entries[i].tag, new_entries[i].payload,
+           static_cast<uint32_t>(i));
+      path.pop_back();
+    }
+    return true;
+  }
+
+  bool diff_list(std::span<const StreamChar> a,
+                 std::span<const StreamChar> b) {
+    RawList old_list, new_list;
+    if (!read_elements(a, old_list) || !read_elements(b, new_list))
+      return false;
+    const auto &old_elems = old_list.elements;
+    const auto &new_elems = new_list.elements;
+
+    // Type changed, or nothing to compare: replace the whole list
+    if (old_elems.empty() || new_elems.empty() ||
+        old_list.elem_tag != new_list.elem_tag) {
+      emit(PatchOp::SET, Tags::List, b);
+      return true;
+    }
+
+    const auto n_common = std::min(old_elems.size(), new_elems.size());
+    for (std::size_t i = 0; i < n_common; i++) {
+      path.emplace_back(static_cast<uint32_t>(i));
+      const bool ok = diff_value(new_list.elem_tag, old_elems[i], new_elems[i]);
+      path.pop_back();
+      if (!ok)
+        return false;
+    }
+    for (std::size_t i = n_common; i < new_elems.size(); i++) {
+      path.emplace_back(static_cast<uint32_t>(i));
+      emit(PatchOp::SET, new_list.elem_tag, new_elems[i]);
+      path.pop_back();
+    }
+    if (new_elems.size() < old_elems.size())
+      emit(PatchOp::TRUNCATE, Tags::List, {},
+           static_cast<uint32_t>(new_elems.size()));
+    return true;
+  }
+
+  template <typename T>
+  bool diff_array(Tags tag, std::span<const StreamChar> a,
+                  std::span<const StreamChar> b) {
+    // The payloads were checked when they were located
+    const auto n_old = static_cast<std::size_t>(
+        load_integral<int32_t, NBT_BIG_ENDIAN>(a.data()));
+    const auto n_new = static_cast<std::size_t>(
+        load_integral<int32_t, NBT_BIG_ENDIAN>(b.data()));
+    const StreamChar *old_elems = a.data() + 4;
+    const StreamChar *new_elems = b.data() + 4;
+    const auto elem_equal = [&](std::size_t i, std::size_t j) {
+      return std::memcmp(old_elems + i * sizeof(T), new_elems + j * sizeof(T),
+                         sizeof(T)) == 0;
+    };
+    const auto splice = [&](std::size_t offset, std::size_t length,
+                            std::size_t from, std::size_t count) {
+      emit(PatchOp::SPLICE, tag,
+           {new_elems + from * sizeof(T), count * sizeof(T)},
+           static_cast<uint32_t>(offset), static_cast<uint32_t>(length));
+    };
+
+    if (n_old != n_new) {
+      // Single edition between the common prefix and suffix
+      std::size_t prefix = 0, suffix = 0;
+      const auto n_min = std::min(n_old, n_new);
+      while (prefix < n_min && elem_equal(prefix, prefix))
+        prefix++;
+      while (suffix < n_min - prefix &&
+             elem_equal(n_old - suffix - 1, n_new - suffix - 1))
+        suffix++;
+      splice(prefix, n_old - prefix - suffix, prefix, n_new - prefix - suffix);
+      return true;
+    }
+
+    // Same length: one edition per run of changed elements
+    std::size_t i = 0;
+    while (i < n_new) {
+      if (elem_equal(i, i)) {
+        i++;
+        continue;
+      }
+      const std::size_t begin = i;
+      std::size_t end = i + 1; // After the last changed element
+      for (std::size_t j = end; j < n_new && j - end < SPLICE_GAP; j++)
+        if (!elem_equal(j, j))
+          end = j + 1;
+      splice(begin, end - begin, begin, end - begin);
+      i = end;
+    }
+    return true;
+  }
+};
+
+} // namespace
+
+std::optional<Patch> diff(std::span<const StreamChar> old_doc,
+                          std::span<const StreamChar> new_doc) {
+  const auto old_root = read_named(old_doc);
+  const auto new_root = read_named(new_doc);
+  if (!old_root || !new_root)
+    return std::nullopt;
+
+  Patch patch;
+  if (old_root->name != new_root->name)
+    patch.name = std::string{new_root->name};
+  Differ differ{.patch = patch, .path = {}};
+  if (old_root->tag != new_root->tag)
+    differ.emit(PatchOp::SET, new_root->tag, new_root->payload);
+  else if (!differ.diff_value(new_root->tag, old_root->payload,
+                              new_root->payload))
+    return std::nullopt;
+  return patch;
+}
+
+// ============================================================================
+// Application
+// ============================================================================
+
+/**
+ * @brief Follow the path from the root, nullptr if it doesn't exist
+ */
+static Tag *resolve(Tag &root, std::span<const PathStep> path) {
+  Tag *node = &root;
+  for (const auto &step : path) {
+    if (const auto *name = std::get_if<std::string>(&step)) {
+      auto *compound = node->as_ptr<Compound>();
+      if (compound == nullptr)
+        return nullptr;
+      const auto it = compound->find(std::string_view{*name});
+      if (it == compound->end())
+        return nullptr;
+      node = &it->second;
+    } else {
+      auto *list = node->as_ptr<List>();
+      const auto index = std::get<uint32_t>(step);
+      if (list == nullptr || index >= list->size())
+        return nullptr;
+      node = &(*list)[index];
+    }
+  }
+  return node;
+}
+
+/**
+ * @brief Replace a range of an array by the elements of the payload
+ */
+template <typename T>
+static bool splice(std::pmr::vector<T> &array, const PatchEntry &entry) {
+  if (entry.offset > array.size() ||
+      entry.length > array.size() - entry.offset ||
+      entry.payload.size() % sizeof(T) != 0)
+    return false;
+  const auto at = array.begin() + entry.offset;
+  const auto n = entry.payload.size() / sizeof(T);
+  using It = DecodeIterator<T, NBT_BIG_ENDIAN>;
+  const It first{entry.payload.data()};
+  // Overwrite the common part, then insert or erase the difference
+  const auto n_common = std::min<std::size_t>(n, entry.length);
+  std::copy(first, first + static_cast<std::ptrdiff_t>(n_common), at);
+  if (n > entry.length)
+    array.insert(at + static_cast<std::ptrdiff_t>(n_common),
+                 first + static_cast<std::ptrdiff_t>(n_common),
+                 first + static_cast<std::ptrdiff_t>(n));
+  else
+    array.erase(at + static_cast<std::ptrdiff_t>(n),
+                at + static_cast<std::ptrdiff_t>(entry.length));
+  return true;
+}
+
+bool Patch::apply(Tag &root, std::pmr::memory_resource *resource) const {
+  BytesParser<Tag> parser{resource};
+  std::vector<StreamChar> document;
+
+  // Decode a payload as an anonymous root tag
+  const auto decode = [&](const PatchEntry &entry) -> std::optional<Tag> {
+    document.assign({static_cast<StreamChar>(entry.tag), 0, 0});
+    document.insert(document.end(), entry.payload.begin(),
+                    entry.payload.end());
+    const StreamChar *strm = document.data();
+    unsigned long N = document.size();
+    parser.reset();
+    if (parser.parse(strm, N) != ParseResult::SUCCESS || N != 0)
+      return std::nullopt;
+    return parser.take();
+  };
+
+  for (const auto &entry : entries) {
+    const std::span<const PathStep> path{entry.path};
+    switch (entry.op) {
+    case PatchOp::SET: {
+      auto value = decode(entry);
+      if (!value)
+        return false;
+      if (path.empty()) {
+        root = std::move(*value);
+        break;
+      }
+      Tag *parent = resolve(root, path.first(path.size() - 1));
+      if (parent == nullptr)
+        return false;
+      if (const auto *name = std::get_if<std::string>(&path.back())) {
+        auto *compound = parent->as_ptr<Compound>();
+        if (compound == nullptr)
+          return false;
+        if (const auto it = compound->find(std::string_view{*name});
+            it != compound->end())
+          it->second = std::move(*value);
+        else {
+          const auto position =
+              std::min<std::size_t>(entry.offset, compound->size());
+          compound->insert(
+              compound->begin() + static_cast<std::ptrdiff_t>(position),
+              {SmallString{*name, compound->get_allocator()},
+               std::move(*value)});
+        }
+      } else {
+        auto *list = parent->as_ptr<List>();
+        const auto index = std::get<uint32_t>(path.back());
+        if (list == nullptr || index > list->size())
+          return false;
+        if (index == list->size())
+          list->push_back(std::move(*value));
+        else
+          (*list)[index] = std::move(*value);
+      }
+      break;
+    }
+
+    case PatchOp::REMOVE: {
+      Tag *parent =
+          path.empty() ? nullptr : resolve(root, path.first(path.size() - 1));
+      const auto *name =
+          path.empty() ? nullptr : std::get_if<std::string>(&path.back());
+      auto *compound = parent ? parent->as_ptr<Compound>() : nullptr;
+      if (name == nullptr || compound == nullptr)
+        return false;
+      const auto it = compound->find(std::string_view{*name});
+      if (it == compound->end())
+        return false;
+      compound->erase(it);
+      break;
+    }
+
+    case PatchOp::TRUNCATE:
+    case PatchOp::SPLICE: {
+      Tag *target = resolve(root, path);
+      if (target == nullptr)
+        return false;
+      const bool ok = std::visit(
+          [&entry](auto &value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, List> ||
+                          std::is_same_v<T, std::pmr::vector<int8_t>> ||
+                          std::is_same_v<T, std::pmr::vector<int32_t>> ||
+                          std::is_same_v<T, std::pmr::vector<int64_t>>) {
+              if (entry.op == PatchOp::TRUNCATE) {
+                if (entry.offset > value.size())
+                  return false;
+                value.erase(value.begin() + entry.offset, value.end());
+                return true;
+              }
+              if constexpr (!std::is_same_v<T, List>)
+                return splice(value, entry);
+            }
+            return false;
+          },
+          static_cast<TagVariant &>(*target));
+      if (!ok)
+        return false;
+      break;
+    }
+    }
+  }
+  return true;
+}
+
+// ============================================================================
+// Serialization
+// ============================================================================
+
+// Header of the serialized patches
+static constexpr StreamChar PATCH_MAGIC[]{'N', 'B', 'T', 'P', 2};
+
+namespace {
+
+/**
+ * @brief Big-endian writer / reader of the serialized patches
+ */
+struct PatchWriter {
+  std::vector<StreamChar> out;
+
+  template <std::integral T> void put(T value) {
+    const auto size = out.size();
+    out.resize(size + sizeof(T));
+    store_integral<T, true>(out.data() + size, value);
+  }
+  void put_bytes(std::span<const StreamChar> bytes) {
+    put(static_cast<uint32_t>(bytes.size()));
+    out.insert(out.end(), bytes.begin(), bytes.end());
+  }
+};
+
+struct PatchReader {
+  std::span<const StreamChar> in;
+  bool ok = true;
+
+  template <std::integral T> T get() {
+    if (in.size() < sizeof(T)) {
+      ok = false;
+      return 0;
+    }
+    const T value = load_integral<T, true>(in.data());
+    in = in.subspan(sizeof(T));
+    return value;
+  }
+  std::span<const StreamChar> get_bytes() {
+    const auto size = get<uint32_t>();
+    if (!ok || in.size() < size) {
+      ok = false;
+      return {};
+    }
+    const auto bytes = in.first(size);
+    in = in.subspan(size);
+    return bytes;
+  }
+  std::string get_string() {
+    const auto bytes = get_bytes();
+    return {reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+  }
+};
+
+} // namespace
+
+std::vector<StreamChar> Patch::encode() const {
+  PatchWriter w;
+  w.out.assign(std::begin(PATCH_MAGIC), std::end(PATCH_MAGIC));
+  w.put(static_cast<uint8_t>(name.has_value()));
+  if (name)
+    w.put_bytes({reinterpret_cast<const StreamChar *>(name->data()),
+                 name->size()});
+  w.put(static_cast<uint32_t>(entries.size()));
+  for (const auto &entry : entries) {
+    w.put(static_cast<uint8_t>(entry.op));
+    w.put(static_cast<TagID_t>(entry.tag));
+    w.put(static_cast<uint16_t>(entry.path.size()));
+    for (const auto &step : entry.path) {
+      if (const auto *key = std::get_if<std::string>(&step)) {
+        w.put(uint8_t{0});
+        w.put_bytes({reinterpret_cast<const StreamChar *>(key->data()),
+                     key->size()});
+      } else {
+        w.put(uint8_t{1});
+        w.put(std::get<uint32_t>(step));
+      }
+    }
+    if (entry.op != PatchOp::REMOVE)
+      w.put(entry.offset);
+    if (entry.op == PatchOp::SPLICE)
+      w.put(entry.length);
+    if (entry.op == PatchOp::SET || entry.op == PatchOp::SPLICE)
+      w.put_bytes(entry.payload);
+  }
+  return std::move(w.out);
+}
+
+std::optional<Patch> Patch::decode(std::span<const StreamChar> bytes) {
+  if (bytes.size() < sizeof(PATCH_MAGIC) ||
+      !std::equal(std::begin(PATCH_MAGIC), std::end(PATCH_MAGIC),
+                  bytes.begin()))
+    return std::nullopt;
+  PatchReader r{.in = bytes.subspan(sizeof(PATCH_MAGIC))};
+  Patch patch;
+  if (r.get<uint8_t>())
+    patch.name = r.get_string();
+  const auto n_entries = r.get<uint32_t>();
+  for (uint32_t i = 0; r.ok && i < n_entries; i++) {
+    PatchEntry entry{.op = static_cast<PatchOp>(r.get<uint8_t>())};
+    entry.tag = static_cast<Tags>(r.get<TagID_t>());
+    if (entry.op > PatchOp::SPLICE)
+      return std::nullopt;
+    const auto n_steps = r.get<uint16_t>();
+    for (uint16_t s = 0; r.ok && s < n_steps; s++) {
+      if (r.get<uint8_t>() == 0)
+        entry.path.emplace_back(r.get_string());
+      else
+        entry.path.emplace_back(r.get<uint32_t>());
+    }
+    if (entry.op != PatchOp::REMOVE)
+      entry.offset = r.get<uint32_t>();
+    if (entry.op == PatchOp::SPLICE)
+      entry.length = r.get<uint32_t>();
+    if (entry.op == PatchOp::SET || entry.op == PatchOp::SPLICE) {
+      const auto payload = r.get_bytes();
+      entry.payload.assign(payload.begin(), payload.end());
+    }
+    patch.entries.push_back(std::move(entry));
+  }
+  if (!r.ok || !r.in.empty())
+    return std::nullopt;
+  return patch;
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,482 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Content hashing of NBT documents and trees implementation
+//
+// The values are hashed with XXH64, seeded by their tag ID:
+//  - scalars, strings & arrays: their payload bytes
+//  - lists: their header, then either the payload of their elements if these
+//    have a fixed size, or the (big-endian) hashes of the elements
+//  - compounds: their number of entries & the sum of the hashes of their
+//    entries, each being the hash of the entry bytes (ID, name & payload) for
+//    the leaf values, or of the entry ID & name seeded by the hash of the
+//    value for the lists & compounds
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/hash.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <string_view>
+
+namespace minecraft::nbt {
+
+// Deepest value hashed from bytes, deeper documents are rejected
+static constexpr std::size_t MAX_DEPTH{512};
+
+// ============================================================================
+// XXH64
+// ============================================================================
+
+static constexpr uint64_t PRIME_1{0x9E3779B185EBCA87ULL};
+static constexpr uint64_t PRIME_2{0xC2B2AE3D27D4EB4FULL};
+static constexpr uint64_t PRIME_3{0x165667B19E3779F9ULL};
+static constexpr uint64_t PRIME_4{0x85EBCA77C2B2AE63ULL};
+static constexpr uint64_t PRIME_5{0x27D4EB2F165667C5ULL};
+
+static inline uint64_t read_64(const StreamChar *p) {
+  return load_integral<uint64_t, std::endian::native == std::endian::big>(p);
+}
+static inline uint64_t read_32(const StreamChar *p) {
+  return load_integral<uint32_t, std::endian::native == std::endian::big>(p);
+}
+
+static inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+  acc += input * PRIME_2;
+  return std::rotl(acc, 31) * PRIME_1;
+}
+
+static inline uint64_t merge_round(uint64_t acc, uint64_t value) {
+  acc ^= xxh_round(0, value);
+  return acc * PRIME_1 + PRIME_4;
+}
+
+/**
+ * @brief Hash the last bytes (less than 32) and mix the result
+ */
+static uint64_t finalize(uint64_t h, const StreamChar *p, std::size_t n) {
+  for (; n >= 8; n -= 8, p += 8)
+    h = std::rotl(h ^ xxh_round(0, read_64(p)), 27) * PRIME_1 + PRIME_4;
+  if (n >= 4) {
+    h = std::rotl(h ^ (read_32(p) * PRIME_1), 23) * PRIME_2 + PRIME_3;
+    n -= 4;
+    p += 4;
+  }
+  for (; n > 0; n--, p++)
+    h = std::rotl(h ^ (*p * PRIME_5), 11) * PRIME_1;
+  h ^= h >> 33;
+  h *= PRIME_2;
+  h ^= h >> 29;
+  h *= PRIME_3;
+  return h ^ (h >> 32);
+}
+
+namespace {
+
+/**
+ * @brief Streaming XXH64, for the values hashed by parts
+ */
+class Hasher {
+public:
+  explicit Hasher(uint64_t seed)
+      : seed_(seed), acc_{seed + PRIME_1 + PRIME_2, seed + PRIME_2, seed,
+                          seed - PRIME_1} {}
+
+  void update(const StreamChar *p, std::size_t n) {
+    length_ += n;
+    if (buffered_ + n < STRIPE) {
+      std::memcpy(buffer_ + buffered_, p, n);
+      buffered_ += n;
+      return;
+    }
+    if (buffered_ > 0) {
+      const auto fill = STRIPE - buffered_;
+      std::memcpy(buffer_ + buffered_, p, fill);
+      stripe(buffer_);
+      p += fill;
+      n -= fill;
+      buffered_ = 0;
+    }
+    for (; n >= STRIPE; n -= STRIPE, p += STRIPE)
+      stripe(p);
+    std::memcpy(buffer_, p, n);
+    buffered_ = n;
+  }
+
+  template <std::integral T> void update(T value) {
+    StreamChar bytes[sizeof(T)];
+    store_integral<T, NBT_BIG_ENDIAN>(bytes, value);
+    update(bytes, sizeof(T));
+  }
+
+  uint64_t digest() const {
+    uint64_t h;
+    if (length_ >= STRIPE) {
+      h = std::rotl(acc_[0], 1) + std::rotl(acc_[1], 7) +
+          std::rotl(acc_[2], 12) + std::rotl(acc_[3], 18);
+      for (const auto acc : acc_)
+        h = merge_round(h, acc);
+    } else
+      h = seed_ + PRIME_5;
+    return finalize(h + length_, buffer_, buffered_);
+  }
+
+private:
+  static constexpr std::size_t STRIPE{32};
+
+  void stripe(const StreamChar *p) {
+    for (std::size_t i = 0; i < 4; i++)
+      acc_[i] = xxh_round(acc_[i], read_64(p + 8 * i));
+  }
+
+  uint64_t seed_;
+  uint64_t acc_[4];
+  StreamChar buffer_[STRIPE];
+  std::size_t buffered_ = 0;
+  uint64_t length_ = 0;
+};
+
+} // namespace
+
+Hash hash_bytes(std::span<const StreamChar> bytes, uint64_t seed) {
+  // Short inputs (most values) skip the accumulators
+  if (bytes.size() < 32)
+    return finalize(seed + PRIME_5 + bytes.size(), bytes.data(), bytes.size());
+  Hasher hasher{seed};
+  hasher.update(bytes.data(), bytes.size());
+  return hasher.digest();
+}
+
+// ============================================================================
+// Values
+// ============================================================================
+
+static constexpr uint64_t seed_of(Tags tag) {
+  return static_cast<uint64_t>(tag);
+}
+
+/**
+ * @brief Size of the payload of the fixed-size tags (0 for the others)
+ */
+static constexpr std::size_t fixed_size(Tags tag) {
+  switch (tag) {
+  case Tags::Byte:
+    return 1;
+  case Tags::Short:
+    return 2;
+  case Tags::Int:
+  case Tags::Float:
+    return 4;
+  case Tags::Long:
+  case Tags::Double:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief Hash of a compound from the number and sum of its entries hashes
+ */
+static Hash compound_hash(uint32_t n_entries, uint64_t sum) {
+  StreamChar bytes[12];
+  store_integral<uint32_t, NBT_BIG_ENDIAN>(bytes, n_entries);
+  store_integral<uint64_t, NBT_BIG_ENDIAN>(bytes + 4, sum);
+  return hash_bytes(bytes, seed_of(Tags::Compound));
+}
+
+namespace {
+
+/**
+ * @brief Recursive hashing of the values of a payload
+ */
+struct PayloadHasher {
+  const StreamChar *b;
+  std::size_t n;
+  std::size_t pos = 0;
+  std::vector<SubtreeHash> *subtrees;
+  // Names of the compounds being hashed, innermost last
+  std::vector<std::string_view> names{};
+
+  /**
+   * @brief Check that the next size bytes are available, and skip them
+   */
+  bool take(std::size_t size, const StreamChar *&p) {
+    if (n - pos < size)
+      return false;
+    p = b + pos;
+    pos += size;
+    return true;
+  }
+
+  /**
+   * @brief Skip the payload of a value that isn't a list or a compound
+   *
+   * @return false if the value is invalid or of another type
+   */
+  bool skip_leaf(Tags tag) {
+    if (const auto size = fixed_size(tag)) {
+      if (n - pos < size)
+        return false;
+      pos += size;
+      return true;
+    }
+    switch (tag) {
+    case Tags::String: {
+      if (n - pos < 2)
+        return false;
+      const std::size_t length =
+          load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos);
+      if (n - pos - 2 < length)
+        return false;
+      pos += 2 + length;
+      return true;
+    }
+    case Tags::ByteArray:
+    case Tags::IntArray:
+    case Tags::LongArray: {
+      const std::size_t elem = tag == Tags::ByteArray  ? 1
+                               : tag == Tags::IntArray ? 4
+                                                       : 8;
+      if (n - pos < 4)
+        return false;
+      const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(b + pos);
+      if (count < 0 || (n - pos - 4) / elem < static_cast<std::size_t>(count))
+        return false;
+      pos += 4 + static_cast<std::size_t>(count) * elem;
+      return true;
+    }
+    default:
+      return false;
+    }
+  }
+
+  std::optional<Hash> value(Tags tag, std::size_t depth) {
+    if (tag == Tags::List || tag == Tags::Compound) {
+      if (depth >= MAX_DEPTH)
+        return std::nullopt;
+      return container(tag, depth);
+    }
+    const auto start = pos;
+    if (!skip_leaf(tag))
+      return std::nullopt;
+    return hash_bytes({b + start, pos - start}, seed_of(tag));
+  }
+
+  std::optional<Hash> container(Tags tag, std::size_t depth) {
+    // Recorded before the children, completed once they are hashed
+    const auto start = pos;
+    const auto index = subtrees ? subtrees->size() : 0;
+    if (subtrees)
+      subtrees->push_back({static_cast<uint32_t>(start), 0, tag, 0});
+
+    const auto hash = tag == Tags::List ? list(depth) : compound(depth);
+    if (hash && subtrees) {
+      auto &subtree = (*subtrees)[index];
+      subtree.size = static_cast<uint32_t>(pos - start);
+      subtree.hash = *hash;
+    }
+    return hash;
+  }
+
+  std::optional<Hash> list(std::size_t depth) {
+    const StreamChar *header = nullptr;
+    if (!take(5, header))
+      return std::nullopt;
+    const auto elem_tag = static_cast<Tags>(header[0]);
+    const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(header + 1);
+    if (count < 0)
+      return std::nullopt;
+
+    // Elements of fixed size are hashed at once
+    if (const auto size = fixed_size(elem_tag)) {
+      if ((n - pos) / size < static_cast<std::size_t>(count))
+        return std::nullopt;
+      pos += static_cast<std::size_t>(count) * size;
+      return hash_bytes({header, static_cast<std::size_t>(b + pos - header)},
+                        seed_of(Tags::List));
+    }
+    Hasher hasher{seed_of(Tags::List)};
+    hasher.update(header, 5);
+    for (int32_t i = 0; i < count; i++) {
+      const auto elem = value(elem_tag, depth + 1);
+      if (!elem)
+        return std::nullopt;
+      hasher.update(*elem);
+    }
+    return hasher.digest();
+  }
+
+  /**
+   * @brief Check that the names of the compound starting at mark are unique,
+   * and drop them
+   */
+  bool unique_names(std::size_t mark) {
+    const auto first = names.begin() + static_cast<std::ptrdiff_t>(mark);
+    std::sort(first, names.end());
+    const bool unique = std::adjacent_find(first, names.end()) == names.end();
+    names.resize(mark);
+    return unique;
+  }
+
+  std::optional<Hash> compound(std::size_t depth) {
+    uint32_t n_entries = 0;
+    uint64_t sum = 0;
+    const auto mark = names.size();
+    while (true) {
+      const auto start = pos;
+      if (n - pos < 1)
+        return std::nullopt;
+      const auto tag = static_cast<Tags>(b[pos++]);
+      if (tag == Tags::END) {
+        // A tree keeps a single entry per name, which couldn't be hashed from
+        // the duplicated ones
+        if (!unique_names(mark))
+          return std::nullopt;
+        return compound_hash(n_entries, sum);
+      }
+      if (n - pos < 2)
+        return std::nullopt;
+      const std::size_t length =
+          load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos);
+      if (n - pos - 2 < length)
+        return std::nullopt;
+      names.emplace_back(reinterpret_cast<const char *>(b + pos + 2), length);
+      pos += 2 + length;
+
+      // The entries of leaf values are hashed at once, the others from the
+      // hash of their value
+      if (tag == Tags::List || tag == Tags::Compound) {
+        const auto entry = value(tag, depth + 1);
+        if (!entry)
+          return std::nullopt;
+        sum += hash_bytes({b + start, 3 + length}, *entry);
+      } else {
+        if (!skip_leaf(tag))
+          return std::nullopt;
+        sum += hash_bytes({b + start, pos - start}, seed_of(Tags::Compound));
+      }
+      n_entries++;
+    }
+  }
+};
+
+} // namespace
+
+std::optional<Hash> hash_payload(Tags tag, std::span<const StreamChar> payload,
+                                 std::vector<SubtreeHash> *subtrees) {
+  PayloadHasher hasher{
+      .b = payload.data(), .n = payload.size(), .subtrees = subtrees};
+  const auto hash = hasher.value(tag, 0);
+  if (!hash || hasher.pos != payload.size())
+    return std::nullopt;
+  return hash;
+}
+
+std::optional<Hash> hash_document(std::span<const StreamChar> document,
+                                  std::vector<SubtreeHash> *subtrees) {
+  if (document.size() < 3)
+    return std::nullopt;
+  const std::size_t length =
+      load_integral<uint16_t, NBT_BIG_ENDIAN>(&document[1]);
+  if (document.size() - 3 < length)
+    return std::nullopt;
+  const auto start = subtrees ? subtrees->size() : 0;
+  const auto hash = hash_payload(static_cast<Tags>(document[0]),
+                                 document.subspan(3 + length), subtrees);
+  // Offsets from the start of the document
+  if (subtrees)
+    for (auto it = subtrees->begin() + start; it != subtrees->end(); it++)
+      it->offset += static_cast<uint32_t>(3 + length);
+  return hash;
+}
+
+// ============================================================================
+// Trees
+// ============================================================================
+
+template <typename T>
+static void update_array(Hasher &hasher, const std::pmr::vector<T> &values) {
+  hasher.update(static_cast<int32_t>(values.size()));
+  // Converted to big-endian by blocks
+  StreamChar block[256];
+  constexpr std::size_t PER_BLOCK{sizeof(block) / sizeof(T)};
+  for (std::size_t i = 0; i < values.size(); i += PER_BLOCK) {
+    const auto n = std::min(PER_BLOCK, values.size() - i);
+    for (std::size_t j = 0; j < n; j++)
+      store_integral<T, NBT_BIG_ENDIAN>(block + j * sizeof(T), values[i + j]);
+    hasher.update(block, n * sizeof(T));
+  }
+}
+
+static void update_string(Hasher &hasher, std::string_view str) {
+  hasher.update(static_cast<uint16_t>(str.size()));
+  hasher.update(reinterpret_cast<const StreamChar *>(str.data()), str.size());
+}
+
+/**
+ * @brief Append the payload of a value that isn't a list or a compound
+ */
+static void update_leaf(Hasher &hasher, const Tag &tag) {
+  std::visit(
+      [&hasher](const auto &value) {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, float>)
+          hasher.update(std::bit_cast<int32_t>(value));
+        else if constexpr (std::is_same_v<T, double>)
+          hasher.update(std::bit_cast<int64_t>(value));
+        else if constexpr (std::integral<T>)
+          hasher.update(value);
+        else if constexpr (std::is_same_v<T, SmallString>)
+          update_string(hasher, value);
+        else if constexpr (std::is_same_v<T, std::pmr::vector<int8_t>> ||
+                           std::is_same_v<T, std::pmr::vector<int32_t>> ||
+                           std::is_same_v<T, std::pmr::vector<int64_t>>)
+          update_array(hasher, value);
+      },
+      static_cast<const TagVariant &>(tag));
+}
+
+Hash hash(const Tag &tag) {
+  if (const auto *list = tag.as_ptr<List>()) {
+    // Same element type as the one written
+    const auto elem_tag = list->empty() ? list->elem_tag : list->front().tag();
+    Hasher hasher{seed_of(Tags::List)};
+    hasher.update(static_cast<TagID_t>(elem_tag));
+    hasher.update(static_cast<int32_t>(list->size()));
+    for (const auto &elem : *list)
+      if (fixed_size(elem_tag))
+        update_leaf(hasher, elem);
+      else
+        hasher.update(hash(elem));
+    return hasher.digest();
+  }
+
+  if (const auto *compound = tag.as_ptr<Compound>()) {
+    uint64_t sum = 0;
+    for (const auto &[name, entry] : *compound) {
+      const auto entry_tag = entry.tag();
+      const bool leaf = entry_tag != Tags::List && entry_tag != Tags::Compound;
+      Hasher hasher{leaf ? seed_of(Tags::Compound) : hash(entry)};
+      hasher.update(static_cast<TagID_t>(entry_tag));
+      update_string(hasher, name);
+      if (leaf)
+        update_leaf(hasher, entry);
+      sum += hasher.digest();
+    }
+    return compound_hash(static_cast<uint32_t>(compound->size()), sum);
+  }
+
+  Hasher hasher{seed_of(tag.tag())};
+  update_leaf(hasher, tag);
+  return hasher.digest();
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,614 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// One-shot decompression of whole DEFLATE streams implementation
+//
+// The decompressor follows the design of libdeflate: the bits are read from a
+// 64-bit buffer refilled once per symbol (a literal/length code, its extra
+// bits, an offset code and its extra bits taking at most 48 bits), and the
+// Huffman codes are decoded with a single table lookup, the codes longer than
+// the main table going through a second-level table. The table entries hold
+// the base value & extra bits of the lengths and offsets, so that a symbol
+// is fully decoded from its entry.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/inflate.hpp"
+#include "minecraft/nbt/stats.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstring>
+#include <zlib.h>
+
+namespace minecraft::nbt {
+
+static constexpr unsigned MAX_CODE_BITS{15};
+static constexpr unsigned N_LITLEN{288};
+static constexpr unsigned N_OFFSET{32};
+static constexpr unsigned N_PRECODE{19};
+
+// Bits indexing the main tables, the longer codes using a second level
+static constexpr unsigned LITLEN_BITS{11};
+static constexpr unsigned OFFSET_BITS{8};
+static constexpr unsigned PRECODE_BITS{7};
+
+// Main table & a second level for each symbol at most
+template <unsigned BITS, unsigned N>
+static constexpr std::size_t TABLE_SIZE{(std::size_t{1} << BITS) +
+                                        N * (1 << (MAX_CODE_BITS - BITS))};
+
+static constexpr uint16_t LENGTH_BASE[]{3,  4,  5,  6,  7,  8,   9,   10,
+                                        11, 13, 15, 17, 19, 23,  27,  31,
+                                        35, 43, 51, 59, 67, 83,  99,  115,
+                                        131, 163, 195, 227, 258};
+static constexpr uint8_t LENGTH_EXTRA[]{0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                        1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                        4, 4, 4, 4, 5, 5, 5, 5, 0};
+static constexpr uint16_t OFFSET_BASE[]{
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static constexpr uint8_t OFFSET_EXTRA[]{0, 0, 0,  0,  1,  1,  2,  2,  3,  3,
+                                        4, 4, 5,  5,  6,  6,  7,  7,  8,  8,
+                                        9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// Order of the code lengths of the precode
+static constexpr uint8_t PRECODE_ORDER[]{16, 17, 18, 0, 8,  7, 9,  6, 10, 5,
+                                         11, 4,  12, 3, 13, 2, 14, 1, 15};
+
+// ============================================================================
+// Decode tables
+// ============================================================================
+
+/**
+ * @brief Kind of a decode table entry
+ */
+enum Kind : uint32_t {
+  INVALID, // Unused code (or symbol)
+  LITERAL, // Literal byte (or precode symbol)
+  LENGTH,  // Match length (or offset)
+  END,     // End of the block
+  SUBTABLE // Code continued in a second-level table
+};
+
+// Entry: [0:8) codeword bits, [8:12) extra bits, [12:16) kind, [16:32) value
+static constexpr uint32_t make_entry(Kind kind, uint32_t value,
+                                     uint32_t extra = 0) {
+  return value << 16 | kind << 12 | extra << 8;
+}
+static inline unsigned entry_bits(uint32_t entry) { return entry & 0xff; }
+static inline unsigned entry_extra(uint32_t entry) {
+  return (entry >> 8) & 0xf;
+}
+static inline Kind entry_kind(uint32_t entry) {
+  return static_cast<Kind>((entry >> 12) & 0xf);
+}
+static inline unsigned entry_value(uint32_t entry) { return entry >> 16; }
+
+/**
+ * @brief Entries of the symbols of an alphabet (without their codeword bits)
+ */
+static constexpr auto LITLEN_SYMBOLS = [] {
+  std::array<uint32_t, N_LITLEN> symbols{};
+  for (uint32_t i = 0; i < 256; i++)
+    symbols[i] = make_entry(LITERAL, i);
+  symbols[256] = make_entry(END, 0);
+  for (uint32_t i = 0; i < 29; i++)
+    symbols[257 + i] = make_entry(LENGTH, LENGTH_BASE[i], LENGTH_EXTRA[i]);
+  return symbols;
+}();
+static constexpr auto OFFSET_SYMBOLS = [] {
+  std::array<uint32_t, N_OFFSET> symbols{};
+  for (uint32_t i = 0; i < 30; i++)
+    symbols[i] = make_entry(LENGTH, OFFSET_BASE[i], OFFSET_EXTRA[i]);
+  return symbols;
+}();
+static constexpr auto PRECODE_SYMBOLS = [] {
+  std::array<uint32_t, N_PRECODE> symbols{};
+  for (uint32_t i = 0; i < N_PRECODE; i++)
+    symbols[i] = make_entry(LITERAL, i);
+  return symbols;
+}();
+
+/**
+ * @brief Build the decode table of a canonical Huffman code
+ *
+ * @return false if the code is over-subscribed, or incomplete while having
+ * more than one codeword
+ */
+static bool build_table(uint32_t *table, unsigned table_bits,
+                        const uint8_t *lengths, unsigned n_symbols,
+                        const uint32_t *symbols) {
+  unsigned count[MAX_CODE_BITS + 1]{};
+  for (unsigned i = 0; i < n_symbols; i++)
+    count[lengths[i]]++;
+  count[0] = 0;
+
+  int left = 1;
+  unsigned n_codes = 0;
+  for (unsigned len = 1; len <= MAX_CODE_BITS; len++) {
+    left = 2 * left - static_cast<int>(count[len]);
+    n_codes += count[len];
+    if (left < 0)
+      return false;
+  }
+  if (left > 0 && n_codes > 1)
+    return false;
+
+  const std::size_t main_size = std::size_t{1} << table_bits;
+  const std::size_t sub_size = std::size_t{1}
+                               << (MAX_CODE_BITS - table_bits);
+  std::fill_n(table, main_size, make_entry(INVALID, 0));
+
+  // First codeword of each length
+  unsigned next_code[MAX_CODE_BITS + 1]{};
+  for (unsigned len = 1, code = 0; len <= MAX_CODE_BITS; len++) {
+    code = (code + count[len - 1]) << 1;
+    next_code[len] = code;
+  }
+
+  // Symbols sorted by codeword length, then by value
+  unsigned offsets[MAX_CODE_BITS + 2]{};
+  for (unsigned len = 1; len <= MAX_CODE_BITS; len++)
+    offsets[len + 1] = offsets[len] + count[len];
+  uint16_t sorted[N_LITLEN];
+  for (unsigned symbol = 0; symbol < n_symbols; symbol++)
+    if (lengths[symbol] != 0)
+      sorted[offsets[lengths[symbol]]++] = static_cast<uint16_t>(symbol);
+
+  std::size_t n_subtables = 0;
+  for (unsigned i = 0; i < n_codes; i++) {
+    const unsigned symbol = sorted[i];
+    const unsigned len = lengths[symbol];
+    // The codewords are read from their first bit, i.e. bit-reversed
+    const unsigned code = next_code[len]++;
+    unsigned reversed = 0;
+    for (unsigned bit = 0; bit < len; bit++)
+      reversed |= ((code >> bit) & 1) << (len - 1 - bit);
+
+    if (len <= table_bits) {
+      const uint32_t entry = symbols[symbol] | len;
+      for (std::size_t j = reversed; j < main_size; j += 1u << len)
+        table[j] = entry;
+      continue;
+    }
+    const unsigned prefix = reversed & (main_size - 1);
+    if (entry_kind(table[prefix]) != SUBTABLE) {
+      const auto start = main_size + n_subtables++ * sub_size;
+      table[prefix] =
+          make_entry(SUBTABLE, static_cast<uint32_t>(start)) | table_bits;
+      std::fill_n(table + start, sub_size, make_entry(INVALID, 0));
+    }
+    uint32_t *sub = table + entry_value(table[prefix]);
+    const unsigned sub_len = len - table_bits;
+    const uint32_t entry = symbols[symbol] | sub_len;
+    for (std::size_t j = reversed >> table_bits; j < sub_size;
+         j += 1u << sub_len)
+      sub[j] = entry;
+  }
+  return true;
+}
+
+// ============================================================================
+// Decompressor
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Tables of the decompressor (reused between the calls of a thread)
+ */
+struct Tables {
+  std::array<uint32_t, TABLE_SIZE<LITLEN_BITS, N_LITLEN>> litlen;
+  std::array<uint32_t, TABLE_SIZE<OFFSET_BITS, N_OFFSET>> offset;
+  std::array<uint32_t, TABLE_SIZE<PRECODE_BITS, N_PRECODE>> precode;
+  bool fixed = false; // Whether the tables are the ones of the fixed codes
+};
+
+/**
+ * @brief Reader of the bits of the input, least significant first
+ */
+struct BitReader {
+  const StreamChar *in;
+  const StreamChar *const end;
+  uint64_t buffer = 0;
+  unsigned n_bits = 0;     // Bits available in the buffer
+  std::size_t overrun = 0; // Zero bytes read after the end of the input
+
+  /**
+   * @brief Refill the buffer to 56 bits at least
+   *
+   * @return false if some bytes after the end of the input were consumed
+   */
+  inline bool refill() {
+    if (end - in >= 8) {
+      // The bits after n_bits already hold the next bytes: reading them
+      // again doesn't change them
+      uint64_t word;
+      std::memcpy(&word, in, sizeof(word));
+      if constexpr (std::endian::native == std::endian::big)
+        word = __builtin_bswap64(word);
+      buffer |= word << n_bits;
+      in += (63 - n_bits) >> 3;
+      n_bits |= 56;
+      return true;
+    }
+    while (n_bits <= 56) {
+      if (in != end)
+        buffer |= static_cast<uint64_t>(*in++) << n_bits;
+      else
+        overrun++;
+      n_bits += 8;
+    }
+    return overrun <= sizeof(buffer);
+  }
+
+  inline uint32_t peek(unsigned n) const {
+    return static_cast<uint32_t>(buffer & ((uint64_t{1} << n) - 1));
+  }
+  inline void consume(unsigned n) {
+    buffer >>= n;
+    n_bits -= n;
+  }
+  inline uint32_t pop(unsigned n) {
+    const auto bits = peek(n);
+    consume(n);
+    return bits;
+  }
+
+  /**
+   * @brief Whether more bytes than the input were consumed
+   */
+  inline bool overread() const { return overrun > n_bits / 8; }
+
+  /**
+   * @brief Give back the unconsumed whole bytes of the buffer, to read the
+   * input from the next byte boundary
+   */
+  inline bool align() {
+    const std::size_t unused = n_bits / 8;
+    if (overrun > unused)
+      return false;
+    in -= unused - overrun;
+    overrun = 0;
+    buffer = 0;
+    n_bits = 0;
+    return true;
+  }
+};
+
+/**
+ * @brief Decode a symbol with its table
+ */
+inline uint32_t decode(BitReader &bits, const uint32_t *table,
+                       unsigned table_bits) {
+  uint32_t entry = table[bits.peek(table_bits)];
+  if (entry_kind(entry) == SUBTABLE) {
+    bits.consume(table_bits);
+    entry = table[entry_value(entry) +
+                  bits.peek(MAX_CODE_BITS - table_bits)];
+  }
+  bits.consume(entry_bits(entry));
+  return entry;
+}
+
+/**
+ * @brief Read the code lengths of a dynamic block and build its tables
+ */
+bool read_dynamic_tables(BitReader &bits, Tables &tables) {
+  if (!bits.refill())
+    return false;
+  const unsigned n_litlen = bits.pop(5) + 257;
+  const unsigned n_offset = bits.pop(5) + 1;
+  const unsigned n_precode = bits.pop(4) + 4;
+  if (n_litlen > 286 || n_offset > 30)
+    return false;
+
+  uint8_t precode_lengths[N_PRECODE]{};
+  for (unsigned i = 0; i < n_precode; i++) {
+    if (!bits.refill())
+      return false;
+    precode_lengths[PRECODE_ORDER[i]] = static_cast<uint8_t>(bits.pop(3));
+  }
+  if (!build_table(tables.precode.data(), PRECODE_BITS, precode_lengths,
+                   N_PRECODE, PRECODE_SYMBOLS.data()))
+    return false;
+
+  // Lengths of both codes, the repetitions spanning from one to the other
+  uint8_t lengths[N_LITLEN + N_OFFSET]{};
+  for (unsigned i = 0; i < n_litlen + n_offset;) {
+    if (!bits.refill())
+      return false;
+    const auto entry = decode(bits, tables.precode.data(), PRECODE_BITS);
+    if (entry_kind(entry) != LITERAL)
+      return false;
+    const unsigned symbol = entry_value(entry);
+    if (symbol < 16) {
+      lengths[i++] = static_cast<uint8_t>(symbol);
+      continue;
+    }
+    uint8_t length = 0;
+    unsigned repeat;
+    if (symbol == 16) {
+      if (i == 0)
+        return false;
+      length = lengths[i - 1];
+      repeat = 3 + bits.pop(2);
+    } else if (symbol == 17)
+      repeat = 3 + bits.pop(3);
+    else
+      repeat = 11 + bits.pop(7);
+    if (repeat > n_litlen + n_offset - i)
+      return false;
+    std::fill_n(lengths + i, repeat, length);
+    i += repeat;
+  }
+  if (bits.overread() || lengths[256] == 0)
+    return false;
+
+  tables.fixed = false;
+  return build_table(tables.litlen.data(), LITLEN_BITS, lengths, n_litlen,
+                     LITLEN_SYMBOLS.data()) &&
+         build_table(tables.offset.data(), OFFSET_BITS, lengths + n_litlen,
+                     n_offset, OFFSET_SYMBOLS.data());
+}
+
+void build_fixed_tables(Tables &tables) {
+  if (tables.fixed)
+    return;
+  uint8_t lengths[N_LITLEN + N_OFFSET];
+  std::fill_n(lengths, 144, 8);
+  std::fill_n(lengths + 144, 112, 9);
+  std::fill_n(lengths + 256, 24, 7);
+  std::fill_n(lengths + 280, 8, 8);
+  std::fill_n(lengths + N_LITLEN, N_OFFSET, 5);
+  build_table(tables.litlen.data(), LITLEN_BITS, lengths, N_LITLEN,
+              LITLEN_SYMBOLS.data());
+  build_table(tables.offset.data(), OFFSET_BITS, lengths + N_LITLEN,
+              N_OFFSET, OFFSET_SYMBOLS.data());
+  tables.fixed = true;
+}
+
+/**
+ * @brief Copy a match, its source overlapping its destination if the offset
+ * is smaller than the length
+ */
+inline void copy_match(StreamChar *out, std::size_t offset,
+                       std::size_t length, std::size_t room) {
+  const StreamChar *src = out - offset;
+  if (offset >= 8 && room >= length + 8) {
+    // By words, writing up to 7 bytes after the match (overwritten later)
+    StreamChar *const end = out + length;
+    do {
+      std::memcpy(out, src, 8);
+      out += 8;
+      src += 8;
+    } while (out < end);
+  } else if (offset == 1)
+    std::memset(out, *src, length);
+  else if (room >= length + 8) {
+    // Repetition of a short pattern: its first 8 bytes one at a time, then
+    // by words from a multiple of the pattern at least 8 bytes back
+    for (std::size_t i = 0; i < 8; i++)
+      out[i] = src[i];
+    const std::size_t step = (8 + offset - 1) / offset * offset;
+    for (std::size_t i = 8; i < length; i += 8)
+      std::memcpy(out + i, out + i - step, 8);
+  } else
+    for (std::size_t i = 0; i < length; i++)
+      out[i] = src[i];
+}
+
+} // namespace
+
+// ============================================================================
+InflateResult inflate_raw(std::span<const StreamChar> in,
+                          std::span<StreamChar> out, std::size_t &n_in,
+                          std::size_t &n_out) {
+  thread_local Tables tables;
+  BitReader bits{.in = in.data(), .end = in.data() + in.size()};
+  StreamChar *op = out.data();
+  StreamChar *const out_end = op + out.size();
+
+  bool last = false;
+  while (!last) {
+    if (!bits.refill())
+      return InflateResult::BAD_DATA;
+    last = bits.pop(1);
+    const unsigned type = bits.pop(2);
+
+    if (type == 0) {
+      // Stored block
+      if (!bits.align() || bits.end - bits.in < 4)
+        return InflateResult::BAD_DATA;
+      const std::size_t length = bits.in[0] | bits.in[1] << 8;
+      const std::size_t nlength = bits.in[2] | bits.in[3] << 8;
+      bits.in += 4;
+      if (length != (~nlength & 0xffff) ||
+          length > static_cast<std::size_t>(bits.end - bits.in))
+        return InflateResult::BAD_DATA;
+      if (length > static_cast<std::size_t>(out_end - op))
+        return InflateResult::SHORT_OUTPUT;
+      if (length != 0)
+        std::memcpy(op, bits.in, length);
+      bits.in += length;
+      op += length;
+      continue;
+    }
+    if (type == 1)
+      build_fixed_tables(tables);
+    else if (type != 2 || !read_dynamic_tables(bits, tables))
+      return InflateResult::BAD_DATA;
+
+    // Symbols of the block
+    const uint32_t *litlen = tables.litlen.data();
+    const uint32_t *offsets = tables.offset.data();
+    while (true) {
+      if (!bits.refill())
+        return InflateResult::BAD_DATA;
+      const uint32_t entry = decode(bits, litlen, LITLEN_BITS);
+      const Kind kind = entry_kind(entry);
+      if (kind == LITERAL) {
+        if (op == out_end)
+          return InflateResult::SHORT_OUTPUT;
+        *op++ = static_cast<StreamChar>(entry_value(entry));
+        // Up to 2 more literals with the bits left (3 codes of 15 bits)
+        if (out_end - op < 2)
+          continue;
+        for (int i = 0; i < 2; i++) {
+          const uint32_t next = litlen[bits.peek(LITLEN_BITS)];
+          if (entry_kind(next) != LITERAL)
+            break;
+          bits.consume(entry_bits(next));
+          *op++ = static_cast<StreamChar>(entry_value(next));
+        }
+        continue;
+      }
+      if (kind == END)
+        break;
+      if (kind != LENGTH)
+        return InflateResult::BAD_DATA;
+      const std::size_t length =
+          entry_value(entry) + bits.pop(entry_extra(entry));
+      const uint32_t offset_entry = decode(bits, offsets, OFFSET_BITS);
+      if (entry_kind(offset_entry) != LENGTH)
+        return InflateResult::BAD_DATA;
+      const std::size_t offset =
+          entry_value(offset_entry) + bits.pop(entry_extra(offset_entry));
+      if (offset > static_cast<std::size_t>(op - out.data()))
+        return InflateResult::BAD_DATA;
+      const auto room = static_cast<std::size_t>(out_end - op);
+      if (length > room)
+        return InflateResult::SHORT_OUTPUT;
+      copy_match(op, offset, length, room);
+      op += length;
+    }
+    if (bits.overread())
+      return InflateResult::BAD_DATA;
+  }
+
+  if (!bits.align())
+    return InflateResult::BAD_DATA;
+  n_in = static_cast<std::size_t>(bits.in - in.data());
+  n_out = static_cast<std::size_t>(op - out.data());
+  return InflateResult::SUCCESS;
+}
+
+static inline uint32_t read_le32(const StreamChar *p) {
+  return load_integral<uint32_t, false>(p);
+}
+
+InflateResult inflate_oneshot(std::span<const StreamChar> in,
+                              std::span<StreamChar> out, std::size_t &n_out) {
+  std::size_t n_in = 0;
+  if (in.size() >= 2 && in[0] == 0x1f && in[1] == 0x8b) {
+    // gzip: header, optional fields, stream, CRC-32 & size
+    if (in.size() < 18 || in[2] != 8)
+      return InflateResult::BAD_DATA;
+    const StreamChar flags = in[3];
+    std::size_t pos = 10;
+    if (flags & 0x04) {
+      if (in.size() - pos < 2)
+        return InflateResult::BAD_DATA;
+      pos += 2 + (in[pos] | in[pos + 1] << 8);
+    }
+    for (StreamChar field : {0x08, 0x10})
+      if (flags & field)
+        while (pos < in.size() && in[pos++] != 0)
+          ;
+    if (flags & 0x02)
+      pos += 2;
+    if (pos + 8 > in.size())
+      return InflateResult::BAD_DATA;
+    const auto ret = inflate_raw(in.subspan(pos, in.size() - pos - 8), out,
+                                 n_in, n_out);
+    if (ret != InflateResult::SUCCESS)
+      return ret;
+    const auto *trailer = in.data() + pos + n_in;
+    if (read_le32(trailer) != crc32_z(0, out.data(), n_out) ||
+        read_le32(trailer + 4) != static_cast<uint32_t>(n_out))
+      return InflateResult::BAD_DATA;
+    return InflateResult::SUCCESS;
+  }
+
+  // zlib: header, stream & Adler-32
+  if (in.size() < 6 || (in[0] & 0x0f) != 8 || (in[0] >> 4) > 7 ||
+      (in[0] << 8 | in[1]) % 31 != 0 || (in[1] & 0x20))
+    return InflateResult::BAD_DATA;
+  const auto ret = inflate_raw(in.subspan(2, in.size() - 6), out, n_in, n_out);
+  if (ret != InflateResult::SUCCESS)
+    return ret;
+  const auto checksum = load_integral<uint32_t, true>(in.data() + 2 + n_in);
+  if (checksum != adler32_z(1, out.data(), n_out))
+    return InflateResult::BAD_DATA;
+  return InflateResult::SUCCESS;
+}
+
+/**
+ * @brief Streaming zlib inflate of a whole zlib or gzip stream, growing the
+ * buffer as needed
+ */
+static bool inflate_stream(std::span<const StreamChar> in,
+                           std::vector<StreamChar> &out) {
+  if (in.size() > UINT_MAX)
+    return false;
+  z_stream zs{};
+  // 15 window bits + 32: automatic gzip / zlib header detection
+  if (inflateInit2(&zs, 15 + 32) != Z_OK)
+    return false;
+  zs.next_in = const_cast<Bytef *>(in.data());
+  zs.avail_in = static_cast<uInt>(in.size());
+  out.resize(std::max<std::size_t>({out.size(), 4 * in.size(), 1 << 12}));
+  int ret = Z_OK;
+  while (ret == Z_OK) {
+    if (zs.total_out == out.size())
+      out.resize(2 * out.size());
+    zs.next_out = out.data() + zs.total_out;
+    zs.avail_out = static_cast<uInt>(
+        std::min<std::size_t>(out.size() - zs.total_out, UINT_MAX));
+    ret = inflate(&zs, Z_NO_FLUSH);
+  }
+  out.resize(zs.total_out);
+  inflateEnd(&zs);
+  return ret == Z_STREAM_END;
+}
+
+bool inflate_all(std::span<const StreamChar> in, std::vector<StreamChar> &out,
+                 std::size_t size_hint) {
+  [[maybe_unused]] const uint64_t t_start =
+      STATS_ENABLED ? stats::now_ns() : 0;
+
+  // Exact size in the gzip trailer (modulo 2^32, and bounded by the maximum
+  // DEFLATE ratio against crafted trailers)
+  std::size_t size = std::max(size_hint, out.capacity());
+  if (in.size() >= 18 && in[0] == 0x1f && in[1] == 0x8b)
+    size = std::min<std::size_t>(read_le32(in.data() + in.size() - 4),
+                                 1032 * in.size());
+  else if (size == 0)
+    size = 8 * in.size();
+  out.resize(std::max<std::size_t>(size, 1 << 12));
+
+  std::size_t n_out = 0;
+  bool ok = inflate_oneshot(in, out, n_out) == InflateResult::SUCCESS;
+  if (ok)
+    out.resize(n_out);
+  else
+    // Guess too small (or stream refused): no retry of the one-shot
+    // decompression, which would decompress the stream again from its start
+    ok = inflate_stream(in, out);
+
+  if constexpr (STATS_ENABLED) {
+    auto &s = stats::local();
+    s.inflate_ns.add(stats::now_ns() - t_start);
+    s.compressed_bytes.add(in.size());
+  }
+  return ok;
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,421 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Batch loader of many (small) NBT files implementation
+//
+// The io_uring backend talks to the kernel through the raw system calls (no
+// liburing dependency), it is only compiled on Linux.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/loader.hpp"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <initializer_list>
+#include <system_error>
+#include <thread>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define NBT_HAS_IO_URING 1
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define NBT_HAS_IO_URING 0
+#endif
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Parse a whole document with a reused reader (and inflater)
+ */
+static std::optional<Tag> parse_document(Reader &reader,
+                                         std::span<const StreamChar> bytes) {
+  reader.reset();
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  if (reader.parse(strm, N) != ParseResult::SUCCESS) {
+    // Drop the partial tree with the resource still alive
+    reader.reset();
+    return std::nullopt;
+  }
+  return reader.take();
+}
+
+// ============================================================================
+// io_uring backend
+// ============================================================================
+#if NBT_HAS_IO_URING
+
+/**
+ * @brief Minimal io_uring instance: submission and completion rings mapped
+ * from the kernel.
+ */
+struct BatchLoader::Ring {
+  int fd = -1;
+  void *sq_ptr = MAP_FAILED, *cq_ptr = MAP_FAILED;
+  std::size_t sq_size = 0, cq_size = 0;
+  io_uring_sqe *sqes = static_cast<io_uring_sqe *>(MAP_FAILED);
+  std::size_t sqes_size = 0;
+
+  // Submission ring
+  unsigned *sq_head, *sq_tail, *sq_array;
+  unsigned sq_mask, sq_entries;
+  unsigned sqe_tail = 0; // Next entry to fill (not yet published)
+  unsigned n_pending = 0;
+
+  // Completion ring
+  unsigned *cq_head, *cq_tail;
+  unsigned cq_mask;
+  io_uring_cqe *cqes;
+
+  Reader reader;
+
+  /**
+   * @brief Set up a ring, nothing if io_uring is unavailable (old kernel,
+   * disabled by a seccomp policy...)
+   */
+  static std::unique_ptr<Ring> create(unsigned entries,
+                                      std::pmr::memory_resource *resource) {
+    auto ring = std::make_unique<Ring>(resource);
+    io_uring_params p{};
+    ring->fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &p));
+    if (ring->fd < 0)
+      return nullptr;
+    // The file operations came after io_uring itself (Linux 5.6): without
+    // them, every file would fail instead of falling back to the threads
+    if (!ring->supports({IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ,
+                         IORING_OP_CLOSE}))
+      return nullptr;
+
+    // Map the rings (a single mapping for both when supported)
+    ring->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    const bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+    if (single)
+      ring->sq_size = ring->cq_size = std::max(ring->sq_size, ring->cq_size);
+    ring->sq_ptr =
+        mmap(nullptr, ring->sq_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ptr == MAP_FAILED)
+      return nullptr;
+    ring->cq_ptr =
+        single ? ring->sq_ptr
+               : mmap(nullptr, ring->cq_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    if (ring->cq_ptr == MAP_FAILED)
+      return nullptr;
+    ring->sqes_size = p.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes = static_cast<io_uring_sqe *>(
+        mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES));
+    if (ring->sqes == MAP_FAILED)
+      return nullptr;
+
+    auto *sq = static_cast<char *>(ring->sq_ptr);
+    ring->sq_head = reinterpret_cast<unsigned *>(sq + p.sq_off.head);
+    ring->sq_tail = reinterpret_cast<unsigned *>(sq + p.sq_off.tail);
+    ring->sq_array = reinterpret_cast<unsigned *>(sq + p.sq_off.array);
+    ring->sq_mask = *reinterpret_cast<unsigned *>(sq + p.sq_off.ring_mask);
+    ring->sq_entries = p.sq_entries;
+    ring->sqe_tail = *ring->sq_tail;
+    auto *cq = static_cast<char *>(ring->cq_ptr);
+    ring->cq_head = reinterpret_cast<unsigned *>(cq + p.cq_off.head);
+    ring->cq_tail = reinterpret_cast<unsigned *>(cq + p.cq_off.tail);
+    ring->cq_mask = *reinterpret_cast<unsigned *>(cq + p.cq_off.ring_mask);
+    ring->cqes = reinterpret_cast<io_uring_cqe *>(cq + p.cq_off.cqes);
+    return ring;
+  }
+
+  explicit Ring(std::pmr::memory_resource *resource) : reader(resource) {}
+
+  /**
+   * @brief Whether the kernel supports all the given operations (none if it
+   * cannot be probed)
+   */
+  bool supports(std::initializer_list<unsigned> ops) const {
+    constexpr unsigned N_PROBED{256};
+    std::vector<std::byte> buffer(sizeof(io_uring_probe) +
+                                  N_PROBED * sizeof(io_uring_probe_op));
+    auto *probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+    if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe,
+                N_PROBED) < 0)
+      return false;
+    return std::all_of(ops.begin(), ops.end(), [probe](unsigned op) {
+      return op <= probe->last_op &&
+             (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+    });
+  }
+
+  ~Ring() {
+    if (sqes != MAP_FAILED)
+      munmap(sqes, sqes_size);
+    if (cq_ptr != MAP_FAILED && cq_ptr != sq_ptr)
+      munmap(cq_ptr, cq_size);
+    if (sq_ptr != MAP_FAILED)
+      munmap(sq_ptr, sq_size);
+    if (fd >= 0)
+      close(fd);
+  }
+
+  /**
+   * @brief Publish the filled entries and wait for at least wait_nr
+   * completions
+   */
+  void submit(unsigned wait_nr) {
+    __atomic_store_n(sq_tail, sqe_tail, __ATOMIC_RELEASE);
+    const unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (true) {
+      const long ret = syscall(__NR_io_uring_enter, fd, n_pending, wait_nr,
+                               flags, nullptr, 0);
+      if (ret >= 0) {
+        n_pending -= std::min<unsigned>(n_pending, static_cast<unsigned>(ret));
+        return;
+      }
+      if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        throw std::system_error(errno, std::system_category(),
+                                "io_uring_enter");
+    }
+  }
+
+  /**
+   * @brief Get a blank submission entry, submitting the filled ones when the
+   * ring is full
+   */
+  io_uring_sqe &get_sqe() {
+    while (sqe_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries)
+      submit(0);
+    const unsigned index = sqe_tail & sq_mask;
+    sq_array[index] = index;
+    sqe_tail++;
+    n_pending++;
+    auto &sqe = sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    return sqe;
+  }
+
+  /**
+   * @brief Call f on every available completion
+   */
+  template <typename F> void reap(F &&f) {
+    unsigned head = *cq_head;
+    const unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+      const io_uring_cqe cqe = cqes[head & cq_mask];
+      // Release the entry before handling it (which may submit)
+      __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+      f(cqe);
+    }
+  }
+};
+
+namespace {
+
+// Operations of the file loading (low bits of the submissions user data)
+enum Op : uint64_t { OPEN, STAT, READ, CLOSE, N_OPS = 4 };
+
+/**
+ * @brief A file being loaded
+ */
+struct Slot {
+  std::size_t index = 0; // Index of the file in the batch
+  int fd = -1;
+  unsigned n_waiting = 0; // Open and stat in flight
+  bool failed = false;
+  struct statx stx{};
+  std::vector<StreamChar> buffer;
+  std::size_t n_read = 0;
+};
+
+} // namespace
+
+#else
+
+struct BatchLoader::Ring {};
+
+#endif
+
+// ============================================================================
+// Loader
+// ============================================================================
+
+BatchLoader::BatchLoader(const LoadOptions &options)
+    : options_(options), backend_(LoadBackend::THREADS) {
+  options_.queue_depth = std::max(options_.queue_depth, 1u);
+  if (options.backend == LoadBackend::THREADS)
+    return;
+#if NBT_HAS_IO_URING
+  ring_ = Ring::create(2 * options_.queue_depth, options_.resource);
+  if (ring_)
+    backend_ = LoadBackend::IO_URING;
+#endif
+  if (!ring_ && options.backend == LoadBackend::IO_URING)
+    throw std::system_error(std::make_error_code(std::errc::not_supported),
+                            "io_uring is not available");
+}
+
+BatchLoader::~BatchLoader() = default;
+
+std::vector<std::optional<Tag>>
+BatchLoader::load(std::span<const std::filesystem::path> paths) {
+  std::vector<std::optional<Tag>> roots(paths.size());
+  load(paths, [&roots](std::size_t i, std::optional<Tag> root) {
+    roots[i] = std::move(root);
+  });
+  return roots;
+}
+
+void BatchLoader::load(std::span<const std::filesystem::path> paths,
+                       const LoadCallback &on_loaded) {
+  if (backend_ == LoadBackend::THREADS)
+    return load_threads(paths, on_loaded);
+
+#if NBT_HAS_IO_URING
+  auto &ring = *ring_;
+  std::vector<Slot> slots(std::min<std::size_t>(options_.queue_depth,
+                                                paths.size()));
+  std::vector<Slot *> free_slots;
+  for (auto &slot : slots)
+    free_slots.push_back(&slot);
+  std::size_t next = 0;  // Next file to open
+  std::size_t n_ops = 0; // Operations in flight
+  const auto slot_id = [&](const Slot &slot) {
+    return static_cast<uint64_t>(&slot - slots.data());
+  };
+  const auto prepare = [&](uint8_t opcode, uint64_t data) -> io_uring_sqe & {
+    auto &sqe = ring.get_sqe();
+    sqe.opcode = opcode;
+    sqe.user_data = data;
+    n_ops++;
+    return sqe;
+  };
+
+  // Submissions of the steps of a file
+  const auto open_file = [&](Slot &slot) {
+    const char *path = paths[slot.index].c_str();
+    auto &o = prepare(IORING_OP_OPENAT, slot_id(slot) * N_OPS + OPEN);
+    o.fd = AT_FDCWD;
+    o.addr = reinterpret_cast<uint64_t>(path);
+    o.open_flags = O_RDONLY | O_CLOEXEC;
+    auto &s = prepare(IORING_OP_STATX, slot_id(slot) * N_OPS + STAT);
+    s.fd = AT_FDCWD;
+    s.addr = reinterpret_cast<uint64_t>(path);
+    s.len = STATX_SIZE;
+    s.off = reinterpret_cast<uint64_t>(&slot.stx);
+    slot.n_waiting = 2;
+  };
+  const auto read_file = [&](Slot &slot) {
+    auto &r = prepare(IORING_OP_READ, slot_id(slot) * N_OPS + READ);
+    r.fd = slot.fd;
+    r.addr = reinterpret_cast<uint64_t>(slot.buffer.data() + slot.n_read);
+    r.len = static_cast<uint32_t>(std::min<std::size_t>(
+        slot.buffer.size() - slot.n_read, UINT32_MAX));
+    r.off = slot.n_read;
+  };
+  const auto finish_file = [&](Slot &slot) {
+    if (slot.fd >= 0) {
+      prepare(IORING_OP_CLOSE, slot_id(slot) * N_OPS + CLOSE).fd = slot.fd;
+      slot.fd = -1;
+    }
+    on_loaded(slot.index,
+              slot.failed ? std::nullopt
+                          : parse_document(ring.reader,
+                                           {slot.buffer.data(), slot.n_read}));
+    free_slots.push_back(&slot);
+  };
+
+  // Completions of the steps of a file
+  const auto complete = [&](const io_uring_cqe &cqe) {
+    n_ops--;
+    auto &slot = slots[cqe.user_data / N_OPS];
+    switch (cqe.user_data % N_OPS) {
+    case OPEN:
+    case STAT:
+      if (cqe.res < 0)
+        slot.failed = true;
+      else if (cqe.user_data % N_OPS == OPEN)
+        slot.fd = cqe.res;
+      if (--slot.n_waiting > 0)
+        return;
+      slot.n_read = 0;
+      slot.buffer.resize(slot.failed ? 0 : slot.stx.stx_size);
+      if (slot.failed || slot.buffer.empty())
+        return finish_file(slot);
+      return read_file(slot);
+    case READ:
+      if (cqe.res < 0)
+        slot.failed = true;
+      slot.n_read += std::max(cqe.res, 0);
+      // Short read: continue until the end of the file
+      if (cqe.res > 0 && slot.n_read < slot.buffer.size())
+        return read_file(slot);
+      return finish_file(slot);
+    default: // Closing
+      return;
+    }
+  };
+
+  while (next < paths.size() || n_ops > 0) {
+    // Start loading the next files
+    while (next < paths.size() && !free_slots.empty()) {
+      auto &slot = *free_slots.back();
+      free_slots.pop_back();
+      slot.index = next++;
+      slot.fd = -1;
+      slot.failed = false;
+      open_file(slot);
+    }
+    ring.submit(1);
+    ring.reap(complete);
+  }
+#endif
+}
+
+// ============================================================================
+// Threads backend
+// ============================================================================
+
+void BatchLoader::load_threads(std::span<const std::filesystem::path> paths,
+                               const LoadCallback &on_loaded) {
+  std::atomic<std::size_t> next{0};
+  const auto work = [&]() {
+    Reader reader{options_.resource};
+    std::vector<StreamChar> buffer;
+    for (auto i = next++; i < paths.size(); i = next++) {
+      std::ifstream file{paths[i], std::ios::binary | std::ios::ate};
+      std::optional<Tag> root;
+      if (file) {
+        buffer.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        if (file.read(reinterpret_cast<char *>(buffer.data()),
+                      static_cast<std::streamsize>(buffer.size())))
+          root = parse_document(reader, buffer);
+      }
+      on_loaded(i, std::move(root));
+    }
+  };
+
+  // The calling thread is one of the workers
+  unsigned n_threads = options_.n_threads > 0
+                           ? options_.n_threads
+                           : std::max(std::thread::hardware_concurrency(), 1u);
+  n_threads = static_cast<unsigned>(
+      std::clamp<std::size_t>(paths.size(), 1, n_threads));
+  std::vector<std::jthread> workers;
+  for (unsigned i = 1; i < n_threads; i++)
+    workers.emplace_back(work);
+  work();
+}
+
+} // namespace minecraft::nbt
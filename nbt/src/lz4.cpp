@@ -0,0 +1,330 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// LZ4 block compression implementation
+//
+// The blocks follow the LZ4 block format: sequences of a token (literals &
+// match lengths), the literals, and a match as a 16-bit little-endian offset.
+// The compressor is the greedy single-probe one of the reference "fast" mode.
+//
+// The block streams follow the LZ4BlockOutputStream of lz4-java: a sequence
+// of blocks, each prefixed by the "LZ4Block" magic, a token (method | level),
+// the little-endian compressed size, original size & checksum (XXH32 of the
+// original bytes with the 0x9747b28c seed, masked to 28 bits).
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/lz4.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace minecraft::nbt {
+
+static constexpr std::size_t MIN_MATCH{4};
+// The last match starts at least MF_LIMIT bytes before the end of the input
+static constexpr std::size_t MF_LIMIT{12};
+// The last LAST_LITERALS bytes are always literals
+static constexpr std::size_t LAST_LITERALS{5};
+static constexpr std::size_t MAX_OFFSET{65535};
+static constexpr unsigned HASH_LOG{12};
+
+static inline uint32_t read_32(const StreamChar *p) {
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+static inline uint32_t hash_32(uint32_t sequence) {
+  return (sequence * 2654435761U) >> (32 - HASH_LOG);
+}
+
+/**
+ * @brief Append a length continued in extra bytes (after the 15 of its token)
+ */
+static void put_length(std::vector<StreamChar> &out, std::size_t length) {
+  for (; length >= 255; length -= 255)
+    out.push_back(255);
+  out.push_back(static_cast<StreamChar>(length));
+}
+
+/**
+ * @brief Append a sequence: literals, then a match if match_length isn't 0
+ */
+static void put_sequence(std::vector<StreamChar> &out,
+                         const StreamChar *literals, std::size_t n_literals,
+                         std::size_t offset, std::size_t match_length) {
+  const std::size_t match_code = match_length ? match_length - MIN_MATCH : 0;
+  out.push_back(static_cast<StreamChar>(
+      (n_literals < 15 ? n_literals : 15) << 4 |
+      (match_code < 15 ? match_code : 15)));
+  if (n_literals >= 15)
+    put_length(out, n_literals - 15);
+  out.insert(out.end(), literals, literals + n_literals);
+  if (match_length == 0)
+    return;
+  out.push_back(static_cast<StreamChar>(offset & 0xff));
+  out.push_back(static_cast<StreamChar>(offset >> 8));
+  if (match_code >= 15)
+    put_length(out, match_code - 15);
+}
+
+// ============================================================================
+void lz4_compress(std::span<const StreamChar> input,
+                  std::vector<StreamChar> &out) {
+  out.clear();
+  out.reserve(lz4_bound(input.size()));
+  const StreamChar *in = input.data();
+  const std::size_t n = input.size();
+  std::size_t anchor = 0; // Start of the pending literals
+
+  if (n > MF_LIMIT) {
+    // Last position seen for each hash of 4 bytes
+    const auto table = std::make_unique<uint32_t[]>(1 << HASH_LOG);
+    const std::size_t match_limit = n - MF_LIMIT;
+    const std::size_t end_limit = n - LAST_LITERALS;
+    std::size_t ip = 0;
+    while (ip < match_limit) {
+      const auto sequence = read_32(in + ip);
+      auto &entry = table[hash_32(sequence)];
+      std::size_t ref = entry;
+      entry = static_cast<uint32_t>(ip);
+      if (ref >= ip || ip - ref > MAX_OFFSET || read_32(in + ref) != sequence) {
+        // Skip faster in the incompressible areas
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+
+      // Extend the match backward, then forward
+      while (ip > anchor && ref > 0 && in[ip - 1] == in[ref - 1]) {
+        ip--;
+        ref--;
+      }
+      std::size_t length = MIN_MATCH;
+      while (ip + length < end_limit && in[ip + length] == in[ref + length])
+        length++;
+      put_sequence(out, in + anchor, ip - anchor, ip - ref, length);
+      ip += length;
+      anchor = ip;
+      if (ip - 2 < match_limit)
+        table[hash_32(read_32(in + ip - 2))] = static_cast<uint32_t>(ip - 2);
+    }
+  }
+  put_sequence(out, in + anchor, n - anchor, 0, 0);
+}
+
+bool lz4_decompress(std::span<const StreamChar> block,
+                    std::span<StreamChar> out) {
+  const StreamChar *ip = block.data();
+  const StreamChar *const in_end = ip + block.size();
+  StreamChar *op = out.data();
+  StreamChar *const out_end = op + out.size();
+
+  // Read a length continued in extra bytes
+  const auto get_length = [&](std::size_t &length) {
+    if (length != 15)
+      return true;
+    StreamChar byte;
+    do {
+      if (ip == in_end)
+        return false;
+      byte = *ip++;
+      length += byte;
+    } while (byte == 255);
+    return true;
+  };
+
+  while (ip < in_end) {
+    const StreamChar token = *ip++;
+
+    // Literals
+    std::size_t n_literals = token >> 4;
+    if (!get_length(n_literals) ||
+        n_literals > static_cast<std::size_t>(in_end - ip) ||
+        n_literals > static_cast<std::size_t>(out_end - op))
+      return false;
+    if (n_literals != 0)
+      std::memcpy(op, ip, n_literals);
+    ip += n_literals;
+    op += n_literals;
+    // The last sequence has no match
+    if (ip == in_end)
+      return op == out_end;
+
+    // Match
+    if (in_end - ip < 2)
+      return false;
+    const std::size_t offset = ip[0] | static_cast<std::size_t>(ip[1]) << 8;
+    ip += 2;
+    std::size_t length = token & 15;
+    if (!get_length(length))
+      return false;
+    length += MIN_MATCH;
+    if (offset == 0 || offset > static_cast<std::size_t>(op - out.data()) ||
+        length > static_cast<std::size_t>(out_end - op))
+      return false;
+    const StreamChar *match = op - offset;
+    if (offset >= length)
+      std::memcpy(op, match, length);
+    else
+      // Overlapping match: repetition of the last offset bytes
+      for (std::size_t i = 0; i < length; i++)
+        op[i] = match[i];
+    op += length;
+  }
+  return false;
+}
+
+// ============================================================================
+// Block streams
+// ============================================================================
+
+static constexpr StreamChar STREAM_MAGIC[]{'L', 'Z', '4', 'B',
+                                           'l', 'o', 'c', 'k'};
+static constexpr std::size_t STREAM_HEADER_SIZE{sizeof(STREAM_MAGIC) + 13};
+static constexpr uint8_t METHOD_RAW{0x10};
+static constexpr uint8_t METHOD_LZ4{0x20};
+// Blocks of 1 << (LEVEL_BASE + level) bytes at most, for levels up to 15
+static constexpr unsigned LEVEL_BASE{10};
+static constexpr unsigned MAX_LEVEL{15};
+static constexpr uint32_t CHECKSUM_SEED{0x9747b28c};
+static constexpr uint32_t CHECKSUM_MASK{0x0fffffff};
+
+static constexpr uint32_t PRIME_1{0x9E3779B1U};
+static constexpr uint32_t PRIME_2{0x85EBCA77U};
+static constexpr uint32_t PRIME_3{0xC2B2AE3DU};
+static constexpr uint32_t PRIME_4{0x27D4EB2FU};
+static constexpr uint32_t PRIME_5{0x165667B1U};
+
+static inline uint32_t read_le32(const StreamChar *p) {
+  return load_integral<uint32_t, false>(p);
+}
+
+static inline uint32_t xxh_round(uint32_t acc, uint32_t input) {
+  return std::rotl(acc + input * PRIME_2, 13) * PRIME_1;
+}
+
+/**
+ * @brief XXH32 of the given bytes
+ */
+static uint32_t xxh32(const StreamChar *p, std::size_t n, uint32_t seed) {
+  const StreamChar *const end = p + n;
+  uint32_t h;
+  if (n >= 16) {
+    uint32_t v1 = seed + PRIME_1 + PRIME_2, v2 = seed + PRIME_2, v3 = seed,
+             v4 = seed - PRIME_1;
+    for (; end - p >= 16; p += 16) {
+      v1 = xxh_round(v1, read_le32(p));
+      v2 = xxh_round(v2, read_le32(p + 4));
+      v3 = xxh_round(v3, read_le32(p + 8));
+      v4 = xxh_round(v4, read_le32(p + 12));
+    }
+    h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) +
+        std::rotl(v4, 18);
+  } else
+    h = seed + PRIME_5;
+  h += static_cast<uint32_t>(n);
+  for (; end - p >= 4; p += 4)
+    h = std::rotl(h + read_le32(p) * PRIME_3, 17) * PRIME_4;
+  for (; p < end; p++)
+    h = std::rotl(h + *p * PRIME_5, 11) * PRIME_1;
+  h ^= h >> 15;
+  h *= PRIME_2;
+  h ^= h >> 13;
+  h *= PRIME_3;
+  return h ^ (h >> 16);
+}
+
+/**
+ * @brief Append the header of a block
+ */
+static void put_block_header(std::vector<StreamChar> &out, uint8_t token,
+                             std::size_t compressed, std::size_t original,
+                             uint32_t checksum) {
+  const auto at = out.size();
+  out.resize(at + STREAM_HEADER_SIZE);
+  std::memcpy(out.data() + at, STREAM_MAGIC, sizeof(STREAM_MAGIC));
+  out[at + 8] = token;
+  store_integral<uint32_t, false>(out.data() + at + 9,
+                                  static_cast<uint32_t>(compressed));
+  store_integral<uint32_t, false>(out.data() + at + 13,
+                                  static_cast<uint32_t>(original));
+  store_integral<uint32_t, false>(out.data() + at + 17, checksum);
+}
+
+// ============================================================================
+void lz4_stream_compress(std::span<const StreamChar> input,
+                         std::vector<StreamChar> &out,
+                         std::size_t block_size) {
+  out.clear();
+  // Smallest level whose blocks hold block_size bytes
+  const auto bits = static_cast<unsigned>(std::bit_width(block_size - 1));
+  const auto level =
+      static_cast<uint8_t>(bits > LEVEL_BASE ? bits - LEVEL_BASE : 0);
+  std::vector<StreamChar> block;
+  for (std::size_t pos = 0; pos < input.size(); pos += block_size) {
+    const auto original =
+        input.subspan(pos, std::min(block_size, input.size() - pos));
+    const auto checksum =
+        xxh32(original.data(), original.size(), CHECKSUM_SEED) & CHECKSUM_MASK;
+    lz4_compress(original, block);
+    if (block.size() >= original.size()) {
+      // Incompressible: stored raw
+      put_block_header(out, METHOD_RAW | level, original.size(),
+                       original.size(), checksum);
+      out.insert(out.end(), original.begin(), original.end());
+    } else {
+      put_block_header(out, METHOD_LZ4 | level, block.size(), original.size(),
+                       checksum);
+      out.insert(out.end(), block.begin(), block.end());
+    }
+  }
+  put_block_header(out, METHOD_RAW | level, 0, 0, 0);
+}
+
+bool lz4_stream_decompress(std::span<const StreamChar> stream,
+                           std::vector<StreamChar> &out) {
+  out.clear();
+  const StreamChar *ip = stream.data();
+  const StreamChar *const end = ip + stream.size();
+  while (true) {
+    if (static_cast<std::size_t>(end - ip) < STREAM_HEADER_SIZE ||
+        std::memcmp(ip, STREAM_MAGIC, sizeof(STREAM_MAGIC)) != 0)
+      return false;
+    const uint8_t method = ip[8] & 0xf0;
+    const unsigned level = ip[8] & 0x0f;
+    const std::size_t compressed = read_le32(ip + 9);
+    const std::size_t original = read_le32(ip + 13);
+    const uint32_t checksum = read_le32(ip + 17);
+    ip += STREAM_HEADER_SIZE;
+    if ((method != METHOD_RAW && method != METHOD_LZ4) || level > MAX_LEVEL ||
+        original > std::size_t{1} << (LEVEL_BASE + level) ||
+        compressed > static_cast<std::size_t>(end - ip) ||
+        (method == METHOD_RAW && compressed != original))
+      return false;
+    // End of the stream
+    if (original == 0)
+      return compressed == 0 && checksum == 0;
+
+    const auto at = out.size();
+    out.resize(at + original);
+    const std::span<StreamChar> block{out.data() + at, original};
+    if (method == METHOD_RAW)
+      std::memcpy(block.data(), ip, original);
+    else if (!lz4_decompress({ip, compressed}, block))
+      return false;
+    ip += compressed;
+    if ((xxh32(block.data(), block.size(), CHECKSUM_SEED) & CHECKSUM_MASK) !=
+        checksum)
+      return false;
+  }
+}
+
+} // namespace minecraft::nbt
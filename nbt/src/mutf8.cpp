@@ -0,0 +1,390 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Conversions between Modified UTF-8 and UTF-8 implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/mutf8.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#if defined(__SSE2__) && __has_include(<emmintrin.h>)
+#define NBT_HAS_SSE2 1
+#include <emmintrin.h>
+#else
+#define NBT_HAS_SSE2 0
+#endif
+
+#if !NBT_HAS_SSE2 && defined(__aarch64__) && __has_include(<arm_neon.h>)
+#define NBT_HAS_NEON 1
+#include <arm_neon.h>
+#else
+#define NBT_HAS_NEON 0
+#endif
+
+namespace minecraft::nbt {
+
+// ============================================================================
+// ASCII runs
+// ============================================================================
+
+/**
+ * @brief High bits of the bytes of a word that are NUL or over 0x7F, exact up
+ * to the first of them in memory order on little-endian machines
+ */
+static inline uint64_t non_ascii_bytes(uint64_t w) {
+  constexpr uint64_t ONES = 0x0101010101010101ULL;
+  constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+  return (w | ((w - ONES) & ~w)) & HIGHS;
+}
+
+/**
+ * @brief Position of the first byte flagged by non_ascii_bytes in a word
+ * read at p
+ *
+ * @return the position, nothing if it must be found byte per byte
+ */
+static inline std::optional<std::size_t> first_flagged(uint64_t mask) {
+  if constexpr (std::endian::native == std::endian::little)
+    return std::countr_zero(mask) / 8;
+  else
+    return std::nullopt;
+}
+
+/**
+ * @brief Length of the run of bytes 0x01 to 0x7F starting at p
+ */
+static std::size_t ascii_run(const unsigned char *p, std::size_t n) {
+  std::size_t i = 0;
+#if NBT_HAS_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+    // High bit set, or NUL
+    const auto mask = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, zero))));
+    if (mask != 0)
+      return i + std::countr_zero(mask);
+  }
+#elif NBT_HAS_NEON
+  for (; i + 16 <= n; i += 16) {
+    const uint8x16_t v = vld1q_u8(p + i);
+    if (vmaxvq_u8(v) >= 0x80 || vminvq_u8(v) == 0)
+      break;
+  }
+#endif
+  // 8 bytes at a time, the last word overlapping the bytes already checked
+  // (most keys are short)
+  for (; i + 8 <= n; i += 8) {
+    uint64_t w;
+    std::memcpy(&w, p + i, sizeof(w));
+    if (const auto mask = non_ascii_bytes(w); mask != 0) {
+      if (const auto at = first_flagged(mask))
+        return i + *at;
+      break;
+    }
+  }
+  if constexpr (std::endian::native == std::endian::little)
+    if (i < n && n >= 8) {
+      uint64_t w;
+      std::memcpy(&w, p + n - 8, sizeof(w));
+      const auto skipped = 8 - (n - i);
+      const auto mask = non_ascii_bytes(w) & (~uint64_t{0} << (8 * skipped));
+      return mask != 0 ? n - 8 + std::countr_zero(mask) / 8 : n;
+    }
+  while (i < n && p[i] - 1u < 0x7Fu)
+    i++;
+  return i;
+}
+
+std::size_t ascii_prefix(std::string_view str) {
+  return ascii_run(reinterpret_cast<const unsigned char *>(str.data()),
+                   str.size());
+}
+
+// ============================================================================
+// Sequences
+// ============================================================================
+
+static inline bool is_continuation(unsigned char c) {
+  return (c & 0xC0) == 0x80;
+}
+
+/**
+ * @brief Decode a MUTF-8 sequence (a surrogate pair being one sequence)
+ *
+ * @return its length, 0 if invalid
+ */
+static std::size_t decode_mutf8(const unsigned char *p, std::size_t n,
+                                uint32_t &cp) {
+  const unsigned char c = p[0];
+  if (c < 0x80) {
+    // Raw NUL accepted, as Java does
+    cp = c;
+    return 1;
+  }
+  if ((c & 0xE0) == 0xC0) {
+    if (n < 2 || !is_continuation(p[1]))
+      return 0;
+    cp = (c & 0x1Fu) << 6 | (p[1] & 0x3Fu);
+    return 2;
+  }
+  if ((c & 0xF0) != 0xE0)
+    return 0;
+
+  // UTF-16 code unit, maybe the first of a surrogate pair
+  const auto unit = [p, n](std::size_t at) -> uint32_t {
+    if (n < at + 3 || (p[at] & 0xF0) != 0xE0 || !is_continuation(p[at + 1]) ||
+        !is_continuation(p[at + 2]))
+      return UINT32_MAX;
+    return (p[at] & 0x0Fu) << 12 | (p[at + 1] & 0x3Fu) << 6 |
+           (p[at + 2] & 0x3Fu);
+  };
+  const auto high = unit(0);
+  if (high == UINT32_MAX || (high >= 0xDC00 && high <= 0xDFFF))
+    return 0;
+  if (high < 0xD800 || high > 0xDBFF) {
+    cp = high;
+    return 3;
+  }
+  const auto low = unit(3);
+  if (low < 0xDC00 || low > 0xDFFF)
+    return 0;
+  cp = 0x10000 + ((high - 0xD800) << 10) + (low - 0xDC00);
+  return 6;
+}
+
+/**
+ * @brief Decode a UTF-8 sequence
+ *
+ * @return its length, 0 if invalid
+ */
+static std::size_t decode_utf8(const unsigned char *p, std::size_t n,
+                               uint32_t &cp) {
+  const unsigned char c = p[0];
+  if (c < 0x80) {
+    cp = c;
+    return 1;
+  }
+  if (c >= 0xC2 && c <= 0xDF) {
+    if (n < 2 || !is_continuation(p[1]))
+      return 0;
+    cp = (c & 0x1Fu) << 6 | (p[1] & 0x3Fu);
+    return 2;
+  }
+  if (c >= 0xE0 && c <= 0xEF) {
+    // No overlong forms nor surrogates
+    const unsigned char lo = c == 0xE0 ? 0xA0 : 0x80;
+    const unsigned char hi = c == 0xED ? 0x9F : 0xBF;
+    if (n < 3 || p[1] < lo || p[1] > hi || !is_continuation(p[2]))
+      return 0;
+    cp = (c & 0x0Fu) << 12 | (p[1] & 0x3Fu) << 6 | (p[2] & 0x3Fu);
+    return 3;
+  }
+  if (c >= 0xF0 && c <= 0xF4) {
+    // No overlong forms nor code points over U+10FFFF
+    const unsigned char lo = c == 0xF0 ? 0x90 : 0x80;
+    const unsigned char hi = c == 0xF4 ? 0x8F : 0xBF;
+    if (n < 4 || p[1] < lo || p[1] > hi || !is_continuation(p[2]) ||
+        !is_continuation(p[3]))
+      return 0;
+    cp = (c & 0x07u) << 18 | (p[1] & 0x3Fu) << 12 | (p[2] & 0x3Fu) << 6 |
+         (p[3] & 0x3Fu);
+    return 4;
+  }
+  return 0;
+}
+
+/**
+ * @brief Encode a code point in UTF-8
+ */
+static char *encode_utf8(uint32_t cp, char *o) {
+  if (cp < 0x80) {
+    *o++ = static_cast<char>(cp);
+  } else if (cp < 0x800) {
+    *o++ = static_cast<char>(0xC0 | cp >> 6);
+    *o++ = static_cast<char>(0x80 | (cp & 0x3F));
+  } else if (cp < 0x10000) {
+    *o++ = static_cast<char>(0xE0 | cp >> 12);
+    *o++ = static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+    *o++ = static_cast<char>(0x80 | (cp & 0x3F));
+  } else {
+    *o++ = static_cast<char>(0xF0 | cp >> 18);
+    *o++ = static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+    *o++ = static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+    *o++ = static_cast<char>(0x80 | (cp & 0x3F));
+  }
+  return o;
+}
+
+/**
+ * @brief Encode a code point in MUTF-8
+ */
+static char *encode_mutf8(uint32_t cp, char *o) {
+  if (cp == 0) {
+    *o++ = static_cast<char>(0xC0);
+    *o++ = static_cast<char>(0x80);
+    return o;
+  }
+  if (cp < 0x10000)
+    return encode_utf8(cp, o);
+  // Surrogate pair, each on 3 bytes
+  cp -= 0x10000;
+  o = encode_utf8(0xD800 + (cp >> 10), o);
+  return encode_utf8(0xDC00 + (cp & 0x3FF), o);
+}
+
+// ============================================================================
+// Strings
+// ============================================================================
+
+/**
+ * @brief Walk a string, copying its ASCII runs and handing the other
+ * sequences to the encoder
+ *
+ * @param o output, large enough for the whole result (unused if !WRITE),
+ * moved to its end
+ * @return false if the string is invalid
+ */
+template <auto DECODE, auto ENCODE, bool WRITE>
+static bool transcode(std::string_view in, char *&o) {
+  const auto *p = reinterpret_cast<const unsigned char *>(in.data());
+  const std::size_t n = in.size();
+  std::size_t i = 0;
+  while (i < n) {
+    const auto run = ascii_run(p + i, n - i);
+    if constexpr (WRITE) {
+      std::memcpy(o, p + i, run);
+      o += run;
+    }
+    i += run;
+    if (i == n)
+      break;
+    uint32_t cp;
+    const auto length = DECODE(p + i, n - i, cp);
+    if (length == 0)
+      return false;
+    if constexpr (WRITE)
+      o = ENCODE(cp, o);
+    i += length;
+  }
+  return true;
+}
+
+bool is_valid_mutf8(std::string_view str) {
+  char *o = nullptr;
+  return transcode<decode_mutf8, encode_utf8, false>(str, o);
+}
+
+bool is_valid_utf8(std::string_view str) {
+  char *o = nullptr;
+  return transcode<decode_utf8, encode_mutf8, false>(str, o);
+}
+
+/**
+ * @brief Convert a string into out, copied at once if it is ASCII
+ *
+ * @tparam GROWTH bound of the output bytes for each input byte
+ */
+template <auto DECODE, auto ENCODE, std::size_t GROWTH, typename S>
+static bool convert(std::string_view in, S &out) {
+  const auto prefix = ascii_prefix(in);
+  if (prefix == in.size()) {
+    out.assign(in.data(), in.size());
+    return true;
+  }
+  out.resize(GROWTH * in.size());
+  std::memcpy(out.data(), in.data(), prefix);
+  char *end = out.data() + prefix;
+  if (!transcode<DECODE, ENCODE, true>(in.substr(prefix), end))
+    return false;
+  out.resize(static_cast<std::size_t>(end - out.data()));
+  return true;
+}
+
+template <typename A>
+bool mutf8_to_utf8(std::string_view in,
+                   std::basic_string<char, std::char_traits<char>, A> &out) {
+  // UTF-8 is never longer
+  return convert<decode_mutf8, encode_utf8, 1>(in, out);
+}
+
+template <typename A>
+bool utf8_to_mutf8(std::string_view in,
+                   std::basic_string<char, std::char_traits<char>, A> &out) {
+  // At most 2 bytes for each (NUL)
+  return convert<decode_utf8, encode_mutf8, 2>(in, out);
+}
+
+template bool mutf8_to_utf8(std::string_view, std::string &);
+template bool mutf8_to_utf8(std::string_view, std::pmr::string &);
+template bool utf8_to_mutf8(std::string_view, std::string &);
+template bool utf8_to_mutf8(std::string_view, std::pmr::string &);
+
+// ============================================================================
+// Trees
+// ============================================================================
+
+/**
+ * @brief Convert a string in place, unless it is ASCII
+ */
+template <auto CONVERT> static bool convert_string(SmallString &str) {
+  if (ascii_prefix(str) == str.size())
+    return true;
+  std::string converted;
+  if (!CONVERT(str, converted))
+    return false;
+  str.assign(converted);
+  return true;
+}
+
+template <auto CONVERT> static bool convert_tree(Tag &tag) {
+  if (auto *str = tag.as_ptr<SmallString>())
+    return convert_string<CONVERT>(*str);
+
+  if (auto *list = tag.as_ptr<List>()) {
+    // Type of the elements as written (elem_tag may be stale once filled)
+    const auto elem_tag = list->empty() ? list->elem_tag : list->front().tag();
+    if (elem_tag != Tags::String && elem_tag != Tags::List &&
+        elem_tag != Tags::Compound)
+      return true;
+    for (auto &elem : *list)
+      if (!convert_tree<CONVERT>(elem))
+        return false;
+    return true;
+  }
+
+  if (auto *compound = tag.as_ptr<Compound>()) {
+    for (auto it = compound->begin(); it != compound->end(); ++it) {
+      if (!convert_tree<CONVERT>(it->second))
+        return false;
+      // The names are keys: they are renamed through the compound
+      if (ascii_prefix(it->first) == it->first.size())
+        continue;
+      std::string name;
+      if (!CONVERT(it->first, name) || !compound->rename(it, name))
+        return false;
+    }
+  }
+  return true;
+}
+
+bool tree_to_utf8(Tag &root) {
+  return convert_tree<mutf8_to_utf8<std::allocator<char>>>(root);
+}
+
+bool tree_to_mutf8(Tag &root) {
+  return convert_tree<utf8_to_mutf8<std::allocator<char>>>(root);
+}
+
+} // namespace minecraft::nbt
@@ -11,29 +11,29 @@
 // ============================================================================
 
 #include "minecraft/nbt/parsers/integral.hpp"
+#include <algorithm>
 
 namespace minecraft::nbt {
 
 template <std::integral T>
 ParseResult BytesParser<T>::parse(const StreamChar *&strm, unsigned long &N) {
-  // Reset parser before parsing a new value (to prevent the calling of
-  // reset() by other programs)
-  if (is_parsed())
-    reset();
+  // Whole value in the buffer: decode it in place
+  if (n_carry_ == 0 && N >= sizeof(T)) {
+    value_ = load_integral<T, NBT_BIG_ENDIAN>(strm);
+    inc_stream(strm, N, sizeof(T));
+    return ParseResult::SUCCESS;
+  }
 
-  NBT_PARSE_N_BYTE_BEGIN()
-#if NBT_BIG_ENDIAN == 0
-  // BEDROCK byte parsing (values are little-endian)
-  value_ += static_cast<T>(strm[0]) << (n_bytes * BIT_PER_BYTES);
-#else
-  // JAVA byte parsing (values are big-endian)
-  value_ += static_cast<T>(strm[0])
-            << ((TYPE_LENGTH - n_bytes - 1) * BIT_PER_BYTES);
-#endif
-  NBT_PARSE_N_BYTE_END(n_bytes, TYPE_LENGTH);
+  // Value split between buffers: gather its bytes in the carry buffer
+  const auto n = std::min<unsigned long>(N, sizeof(T) - n_carry_);
+  std::copy_n(strm, n, carry_ + n_carry_);
+  n_carry_ += static_cast<uint8_t>(n);
+  inc_stream(strm, N, n);
+  if (n_carry_ < sizeof(T))
+    return ParseResult::UNFINISHED;
 
-  // Prepare parser reset for next iteration
-  n_bytes = 0;
+  value_ = load_integral<T, NBT_BIG_ENDIAN>(carry_);
+  n_carry_ = 0;
   return ParseResult::SUCCESS;
 }
 
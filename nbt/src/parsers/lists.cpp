@@ -12,15 +12,15 @@
 
 #include "minecraft/nbt/parsers/base.hpp"
 #include "minecraft/nbt/parsers/list.hpp"
-#include <memory>
+#include <algorithm>
 
 namespace minecraft::nbt {
 
-template <typename T>
-ParseResult BytesParser<std::vector<T>>::parse(const StreamChar *&strm,
+template <typename T, typename A>
+ParseResult BytesParser<std::vector<T, A>>::parse(const StreamChar *&strm,
                                                unsigned long &N) {
   // Reset before starting a new parsing
-  if (parsed_[0] && parsed_[1])
+  if (is_parsed())
     reset();
 
   // Parse vector length
@@ -28,19 +28,33 @@ ParseResult BytesParser<std::vector<T>>::parse(const StreamChar *&strm,
     if (auto ret = size_parser_.parse(strm, N); ret != ParseResult::SUCCESS)
       return ret;
 
-    // Create a vector of expected size
+    if (size_parser_.get() < 0)
+      return ParseResult::FAILED;
+
+    // Make room for the elements (without initializing them), the untrusted
+    // length being only reserved up to the elements in this buffer
     n_elements_expected_ = static_cast<uint32_t>(size_parser_.get());
-    p_value_ = std::make_shared<std::vector<T>>(n_elements_expected_);
+    value_.reserve(
+        std::min<unsigned long>(n_elements_expected_, N / sizeof(T)));
     parsed_[0] = true;
   }
 
   // Parse vector elements
-  while (n_elements_parsed_ < n_elements_expected_) {
-    if (auto ret = elem_parser_.parse(strm, N); ret != ParseResult::SUCCESS)
-      return ret;
+  while (value_.size() < n_elements_expected_) {
+    // Element split between buffers: complete it with the element parser
+    if (!elem_parser_.is_parsed() || N < sizeof(T)) {
+      if (auto ret = elem_parser_.parse(strm, N); ret != ParseResult::SUCCESS)
+        return ret;
+      value_.push_back(elem_parser_.get());
+      continue;
+    }
 
-    (*p_value_)[n_elements_parsed_] = elem_parser_.get();
-    n_elements_parsed_++;
+    // Decode all the whole elements available in this buffer at once
+    const auto n = std::min<unsigned long>(
+        n_elements_expected_ - value_.size(), N / sizeof(T));
+    using It = DecodeIterator<T, NBT_BIG_ENDIAN>;
+    value_.insert(value_.end(), It{strm}, It{strm + n * sizeof(T)});
+    inc_stream(strm, N, n * sizeof(T));
   }
 
   // Turn completion flag on
@@ -52,5 +66,8 @@ ParseResult BytesParser<std::vector<T>>::parse(const StreamChar *&strm,
 template struct BytesParser<std::vector<int8_t>>;  // nbt::ByteArray
 template struct BytesParser<std::vector<int32_t>>; // nbt::IntArray
 template struct BytesParser<std::vector<int64_t>>; // nbt::LongArray
+template struct BytesParser<std::pmr::vector<int8_t>>;
+template struct BytesParser<std::pmr::vector<int32_t>>;
+template struct BytesParser<std::pmr::vector<int64_t>>;
 
 } // namespace minecraft::nbt
\ No newline at end of file
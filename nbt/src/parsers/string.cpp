@@ -12,11 +12,14 @@
 
 #include "minecraft/nbt/parsers/string.hpp"
 #include "minecraft/nbt/parsers/base.hpp"
+#include <algorithm>
 
 namespace minecraft::nbt {
 
-ParseResult BytesParser<std::string>::parse(const StreamChar *&strm,
-                                            unsigned long &N) {
+template <typename A>
+ParseResult
+BytesParser<std::basic_string<char, std::char_traits<char>, A>>::parse(
+    const StreamChar *&strm, unsigned long &N) {
   // Reset parser if new parse
   if (is_parsed())
     reset();
@@ -25,19 +28,24 @@ ParseResult BytesParser<std::string>::parse(const StreamChar *&strm,
   if (!size_parsed_) {
     if (auto ret = size_parser_.parse(strm, N); ret != ParseResult::SUCCESS)
       return ret;
-    value_.resize(size_parser_.get());
+    value_.reserve(size_parser_.get());
     size_parsed_ = true;
   }
 
-  // Read string characters one by one
-  NBT_PARSE_N_BYTE_BEGIN()
-  value_[n_bytes] = strm[0];
-  NBT_PARSE_N_BYTE_END(n_bytes, static_cast<std::size_t>(size_parser_.get()))
+  // Copy the characters available in this buffer at once
+  const auto length = static_cast<std::size_t>(size_parser_.get());
+  const auto n = std::min<unsigned long>(N, length - value_.size());
+  value_.append(reinterpret_cast<const char *>(strm), n);
+  inc_stream(strm, N, n);
+  if (value_.size() < length)
+    return ParseResult::UNFINISHED;
+
   parsed_ = true;
   return ParseResult::SUCCESS;
 }
 
 // Export for in-library compilation
 template struct BytesParser<std::string>;
+template struct BytesParser<std::pmr::string>;
 
 } // namespace minecraft::nbt
\ No newline at end of file
@@ -0,0 +1,305 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Tag tree byte-parsing implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/parsers/base.hpp"
+#include "minecraft/nbt/stats.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <utility>
+
+namespace minecraft::nbt {
+
+// ============================================================================
+// Leaf readers
+// ============================================================================
+
+template <typename T>
+ParseResult BytesParser<Tag>::read_value(const StreamChar *&strm,
+                                         unsigned long &N, T &dest) {
+  // Contiguous value: decode it in place
+  if (!leaf_pending_ && N >= sizeof(T)) {
+    if constexpr (std::floating_point<T>)
+      dest = std::bit_cast<T>(
+          load_integral<typename FloatToInt<T>::INT_TYPE, NBT_BIG_ENDIAN>(
+              strm));
+    else
+      dest = load_integral<T, NBT_BIG_ENDIAN>(strm);
+    inc_stream(strm, N, sizeof(T));
+    return ParseResult::SUCCESS;
+  }
+
+  // Value split between two buffers: use the resumable parser
+  auto &parser = std::get<BytesParser<T>>(value_parsers_);
+  auto ret = parser.parse(strm, N);
+  leaf_pending_ = ret == ParseResult::UNFINISHED;
+  if (ret == ParseResult::SUCCESS)
+    dest = parser.get();
+  return ret;
+}
+
+ParseResult BytesParser<Tag>::read_string(const StreamChar *&strm,
+                                          unsigned long &N,
+                                          SmallString &dest) {
+  // Contiguous string: copy it in place
+  if (!leaf_pending_ && N >= sizeof(uint16_t)) {
+    auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(strm);
+    if (N >= sizeof(uint16_t) + length) {
+      if (length > dest.capacity())
+        stats::allocation(length + 1);
+      stats::string_size(length);
+      dest.assign(reinterpret_cast<const char *>(strm) + sizeof(uint16_t),
+                  length);
+      inc_stream(strm, N, sizeof(uint16_t) + length);
+      return ParseResult::SUCCESS;
+    }
+  }
+
+  // String split between two buffers: use the resumable parser
+  auto ret = str_parser_.parse(strm, N);
+  leaf_pending_ = ret == ParseResult::UNFINISHED;
+  if (ret == ParseResult::SUCCESS) {
+    const auto length = str_parser_.get().size();
+    if (length > dest.capacity())
+      stats::allocation(length + 1);
+    stats::string_size(length);
+    dest.assign(str_parser_.get());
+    str_parser_.reset();
+  }
+  return ret;
+}
+
+// ============================================================================
+// Payload parsers
+// ============================================================================
+
+template <Tags TAG>
+ParseResult BytesParser<Tag>::parse_payload(const StreamChar *&strm,
+                                            unsigned long &N, Tag &dest) {
+  using T = tag_type_t<TAG>;
+
+  if constexpr (TAG == Tags::END) {
+    // END is not a value
+    return fail();
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    // Primitives
+    T value;
+    auto ret = read_value(strm, N, value);
+    if (ret == ParseResult::SUCCESS)
+      dest.template emplace<T>(value);
+    return ret;
+  } else if constexpr (TAG == Tags::String) {
+    if (!dest.is<SmallString>())
+      dest.template emplace<SmallString>(resource_);
+    return read_string(strm, N, dest.template as<SmallString>());
+  } else if constexpr (TAG == Tags::Compound) {
+    // Open the compound, its entries are read by the main loop
+    if (stack_.size() >= MAX_DEPTH)
+      return fail();
+    dest.template emplace<Compound>(resource_);
+    stack_.push_back({&dest, 0});
+    return ParseResult::SUCCESS;
+  } else if constexpr (TAG == Tags::List) {
+    // Read the list header (elements type & count)
+    if (!list_tag_parsed_) {
+      if (stack_.size() >= MAX_DEPTH)
+        return fail();
+      if (N <= 0)
+        return ParseResult::UNFINISHED;
+      dest.template emplace<List>(resource_).elem_tag =
+          static_cast<Tags>(strm[0]);
+      inc_stream(strm, N);
+      list_tag_parsed_ = true;
+    }
+    int32_t size;
+    if (auto ret = read_value(strm, N, size); ret != ParseResult::SUCCESS)
+      return ret;
+    list_tag_parsed_ = false;
+    if (size < 0)
+      return fail();
+
+    // Open the list, its elements are read by the main loop. The untrusted
+    // size is only reserved up to the bytes at hand (each element takes at
+    // least one), the list growing as the next buffers come.
+    const auto reserved = std::min<std::size_t>(size, N);
+    if (reserved > 0)
+      stats::allocation(reserved * sizeof(Tag));
+    stats::array_size(size);
+    dest.template as<List>().reserve(reserved);
+    stack_.push_back({&dest, static_cast<uint32_t>(size)});
+    return ParseResult::SUCCESS;
+  } else {
+    // Arrays
+    auto &parser = std::get<BytesParser<T>>(array_parsers_);
+    auto ret = parser.parse(strm, N);
+    if (ret == ParseResult::SUCCESS) {
+      auto &array = dest.template emplace<T>(parser.take());
+      if (!array.empty())
+        stats::allocation(array.size() * sizeof(typename T::value_type));
+      stats::array_size(array.size());
+    }
+    return ret;
+  }
+}
+
+ParseResult BytesParser<Tag>::parse_invalid(const StreamChar *&,
+                                            unsigned long &, Tag &) {
+  return fail();
+}
+
+// ============================================================================
+// Tree traversal
+// ============================================================================
+
+void BytesParser<Tag>::next_value() {
+  while (!stack_.empty()) {
+    auto &top = stack_.back();
+
+    // Compound entries are read until the END tag
+    if (top.node->tag() == Tags::Compound) {
+      state_ = State::ENTRY_ID;
+      return;
+    }
+
+    // List elements are read until the announced count is reached
+    if (top.remaining == 0) {
+      stack_.pop_back();
+      continue;
+    }
+    top.remaining--;
+    auto &list = top.node->as<List>();
+    target_ = &list.emplace_back();
+    tag_id_ = static_cast<TagID_t>(list.elem_tag);
+    state_ = State::PAYLOAD;
+    return;
+  }
+  state_ = State::DONE;
+}
+
+ParseResult BytesParser<Tag>::parse(const StreamChar *&strm,
+                                    unsigned long &N) {
+  if constexpr (!STATS_ENABLED)
+    return parse_tree(strm, N);
+
+  // Instrumented parsing
+  const unsigned long n_start = N;
+  const uint64_t t_start = stats::now_ns();
+  const auto ret = parse_tree(strm, N);
+  auto &s = stats::local();
+  s.parse_ns.add(stats::now_ns() - t_start);
+  s.bytes.add(n_start - N);
+  switch (ret) {
+  case ParseResult::SUCCESS:
+    s.documents.add(1);
+    break;
+  case ParseResult::UNFINISHED:
+    s.resumptions.add(1);
+    break;
+  case ParseResult::FAILED:
+    s.failures.add(1);
+    break;
+  }
+  return ret;
+}
+
+ParseResult BytesParser<Tag>::parse_tree(const StreamChar *&strm,
+                                         unsigned long &N) {
+  // Table of the payload parsers indexed by tag ID
+  static constexpr auto PAYLOAD_PARSERS{
+      []<std::size_t... I>(std::index_sequence<I...>) {
+        std::array<PayloadParser, 1 << BIT_PER_BYTES> table{};
+        table.fill(&BytesParser<Tag>::parse_invalid);
+        ((table[I] = &BytesParser<Tag>::parse_payload<static_cast<Tags>(I)>),
+         ...);
+        return table;
+      }(std::make_index_sequence<N_TAGS>{})};
+
+  // Reset before starting a new parsing
+  if (state_ == State::DONE)
+    reset();
+
+  while (true) {
+    switch (state_) {
+    // ------------------------------------------------------------------------
+    case State::ROOT_ID:
+      if (N <= 0)
+        return ParseResult::UNFINISHED;
+      tag_id_ = strm[0];
+      inc_stream(strm, N);
+      root_ = Tag{};
+      target_ = &root_;
+
+      // A lone END tag is a valid (empty) document
+      state_ = tag_id_ == static_cast<TagID_t>(Tags::END) ? State::DONE
+                                                          : State::ROOT_NAME;
+      break;
+
+    // ------------------------------------------------------------------------
+    case State::ROOT_NAME:
+      if (auto ret = read_string(strm, N, name_); ret != ParseResult::SUCCESS)
+        return ret;
+      state_ = State::PAYLOAD;
+      break;
+
+    // ------------------------------------------------------------------------
+    case State::ENTRY_ID:
+      if (N <= 0)
+        return ParseResult::UNFINISHED;
+      tag_id_ = strm[0];
+      inc_stream(strm, N);
+
+      // End of the current compound
+      if (tag_id_ == static_cast<TagID_t>(Tags::END)) {
+        stack_.pop_back();
+        next_value();
+      } else
+        state_ = State::ENTRY_NAME;
+      break;
+
+    // ------------------------------------------------------------------------
+    case State::ENTRY_NAME: {
+      if (auto ret = read_string(strm, N, key_); ret != ParseResult::SUCCESS)
+        return ret;
+      auto &compound = stack_.back().node->as<Compound>();
+      const auto capacity = compound.capacity();
+      const auto it = compound.try_emplace(std::move(key_)).first;
+      if (compound.capacity() != capacity)
+        stats::allocation(compound.capacity() * sizeof(Compound::value_type));
+      it->second = Tag{};
+      target_ = &it->second;
+      state_ = State::PAYLOAD;
+      break;
+    }
+
+    // ------------------------------------------------------------------------
+    case State::PAYLOAD:
+      if (auto ret = (this->*PAYLOAD_PARSERS[tag_id_])(strm, N, *target_);
+          ret != ParseResult::SUCCESS)
+        return ret;
+      stats::value(tag_id_);
+      next_value();
+      break;
+
+    // ------------------------------------------------------------------------
+    case State::DONE:
+      return ParseResult::SUCCESS;
+    case State::ERROR:
+      return ParseResult::FAILED;
+    }
+  }
+}
+
+// Export for in-library compilation
+template struct BytesParser<Tag>;
+
+} // namespace minecraft::nbt
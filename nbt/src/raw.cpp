@@ -0,0 +1,200 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Walking of NBT documents directly from their bytes implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/raw.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Size of the payload of the fixed-size tags (0 for the others)
+ */
+static constexpr std::size_t fixed_size(Tags tag) {
+  switch (tag) {
+  case Tags::Byte:
+    return 1;
+  case Tags::Short:
+    return 2;
+  case Tags::Int:
+  case Tags::Float:
+    return 4;
+  case Tags::Long:
+  case Tags::Double:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief Size of the elements of the array tags (0 for the others)
+ */
+static constexpr std::size_t array_elem_size(Tags tag) {
+  switch (tag) {
+  case Tags::ByteArray:
+    return 1;
+  case Tags::IntArray:
+    return 4;
+  case Tags::LongArray:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+// ============================================================================
+std::optional<std::size_t> payload_size(Tags tag,
+                                        std::span<const StreamChar> bytes) {
+  // Opened containers: lists with their remaining elements, or compounds
+  struct Frame {
+    Tags elem_tag; // END for compounds
+    uint32_t remaining;
+  };
+  std::vector<Frame> stack;
+  const std::size_t n = bytes.size();
+  const StreamChar *b = bytes.data();
+  std::size_t pos = 0;
+
+  while (true) {
+    // Skip the payload of the current value
+    if (const auto size = fixed_size(tag)) {
+      if (n - pos < size)
+        return std::nullopt;
+      pos += size;
+    } else if (const auto elem = array_elem_size(tag)) {
+      if (n - pos < 4)
+        return std::nullopt;
+      const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(b + pos);
+      if (count < 0 || (n - pos - 4) / elem < static_cast<std::size_t>(count))
+        return std::nullopt;
+      pos += 4 + static_cast<std::size_t>(count) * elem;
+    } else if (tag == Tags::String) {
+      if (n - pos < 2)
+        return std::nullopt;
+      const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos);
+      if (n - pos - 2 < length)
+        return std::nullopt;
+      pos += 2 + length;
+    } else if (tag == Tags::List) {
+      if (n - pos < 5)
+        return std::nullopt;
+      const auto elem_tag = static_cast<Tags>(b[pos]);
+      const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(b + pos + 1);
+      pos += 5;
+      if (count < 0)
+        return std::nullopt;
+      // Lists of fixed-size values are skipped at once
+      if (const auto size = fixed_size(elem_tag)) {
+        if ((n - pos) / size < static_cast<std::size_t>(count))
+          return std::nullopt;
+        pos += static_cast<std::size_t>(count) * size;
+      } else if (count > 0) {
+        if (elem_tag == Tags::END || elem_tag > Tags::LongArray)
+          return std::nullopt;
+        stack.push_back({elem_tag, static_cast<uint32_t>(count)});
+      }
+    } else if (tag == Tags::Compound) {
+      stack.push_back({Tags::END, 0});
+    } else {
+      return std::nullopt;
+    }
+
+    // Find the next value to skip
+    while (true) {
+      if (stack.empty())
+        return pos;
+      auto &frame = stack.back();
+      if (frame.elem_tag != Tags::END) {
+        if (frame.remaining == 0) {
+          stack.pop_back();
+          continue;
+        }
+        frame.remaining--;
+        tag = frame.elem_tag;
+        break;
+      }
+      // Compound entry: ID & name
+      if (n - pos < 1)
+        return std::nullopt;
+      tag = static_cast<Tags>(b[pos++]);
+      if (tag == Tags::END) {
+        stack.pop_back();
+        continue;
+      }
+      if (n - pos < 2)
+        return std::nullopt;
+      const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(b + pos);
+      if (n - pos - 2 < length)
+        return std::nullopt;
+      pos += 2 + length;
+      break;
+    }
+  }
+}
+
+std::optional<RawTag> read_named(std::span<const StreamChar> bytes) {
+  if (bytes.size() < 3)
+    return std::nullopt;
+  const auto tag = static_cast<Tags>(bytes[0]);
+  const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(&bytes[1]);
+  if (bytes.size() - 3 < length)
+    return std::nullopt;
+  const auto rest = bytes.subspan(3 + length);
+  const auto size = payload_size(tag, rest);
+  if (!size)
+    return std::nullopt;
+  return RawTag{
+      .tag = tag,
+      .name = {reinterpret_cast<const char *>(&bytes[3]), length},
+      .payload = rest.first(*size)};
+}
+
+bool read_entries(std::span<const StreamChar> payload,
+                  std::vector<RawTag> &entries) {
+  entries.clear();
+  while (!payload.empty()) {
+    if (static_cast<Tags>(payload[0]) == Tags::END)
+      return true;
+    const auto entry = read_named(payload);
+    if (!entry)
+      return false;
+    entries.push_back(*entry);
+    payload = payload.subspan(
+        static_cast<std::size_t>(entry->payload.data() - payload.data()) +
+        entry->payload.size());
+  }
+  return false;
+}
+
+bool read_elements(std::span<const StreamChar> payload, RawList &list) {
+  list.elements.clear();
+  if (payload.size() < 5)
+    return false;
+  list.elem_tag = static_cast<Tags>(payload[0]);
+  const auto count = load_integral<int32_t, NBT_BIG_ENDIAN>(&payload[1]);
+  if (count < 0)
+    return false;
+  payload = payload.subspan(5);
+  list.elements.reserve(
+      std::min<std::size_t>(static_cast<std::size_t>(count), payload.size()));
+  for (int32_t i = 0; i < count; i++) {
+    const auto size = payload_size(list.elem_tag, payload);
+    if (!size)
+      return false;
+    list.elements.push_back(payload.first(*size));
+    payload = payload.subspan(*size);
+  }
+  return true;
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,153 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Reader of (possibly compressed) NBT documents implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/reader.hpp"
+#include "minecraft/nbt/stats.hpp"
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <zlib.h>
+
+namespace minecraft::nbt {
+
+// Size of the inflated bytes buffer
+static constexpr std::size_t INFLATE_BUFFER_SIZE{1 << 16};
+
+/**
+ * @brief zlib inflate stream, kept out of the public header
+ */
+struct Reader::Inflater {
+  z_stream zs{};
+
+  Inflater() {
+    // 15 window bits + 32: automatic gzip / zlib header detection
+    if (inflateInit2(&zs, 15 + 32) != Z_OK)
+      throw std::bad_alloc();
+  }
+  ~Inflater() { inflateEnd(&zs); }
+};
+
+Reader::Reader(std::pmr::memory_resource *resource) : parser_(resource) {}
+Reader::~Reader() = default;
+
+void Reader::reset() {
+  parser_.reset();
+  compression_.reset();
+  if (inflater_)
+    inflateReset(&inflater_->zs);
+  done_ = false;
+  failed_ = false;
+}
+
+// ============================================================================
+ParseResult Reader::parse(const StreamChar *&strm, unsigned long &N) {
+  if (done_)
+    reset();
+  if (failed_)
+    return ParseResult::FAILED;
+
+  // Detect the compression from the first byte
+  if (!compression_) {
+    if (N <= 0)
+      return ParseResult::UNFINISHED;
+    compression_ = detect_compression(strm[0]);
+    if (*compression_ != Compression::NONE && !inflater_) {
+      inflater_ = std::make_unique<Inflater>();
+      buffer_.resize(INFLATE_BUFFER_SIZE);
+    }
+  }
+
+  // Uncompressed documents are directly parsed
+  if (*compression_ == Compression::NONE) {
+    auto ret = parser_.parse(strm, N);
+    done_ = ret == ParseResult::SUCCESS;
+    failed_ = ret == ParseResult::FAILED;
+    return ret;
+  }
+  return inflate(strm, N);
+}
+
+ParseResult Reader::inflate(const StreamChar *&strm, unsigned long &N) {
+  auto &zs = inflater_->zs;
+  while (true) {
+    // Inflate as much as possible in the buffer
+    zs.next_in = const_cast<Bytef *>(strm);
+    zs.avail_in = static_cast<uInt>(std::min<unsigned long>(N, UINT_MAX));
+    zs.next_out = buffer_.data();
+    zs.avail_out = static_cast<uInt>(buffer_.size());
+    [[maybe_unused]] const uint64_t t_start =
+        STATS_ENABLED ? stats::now_ns() : 0;
+    const int z = ::inflate(&zs, Z_NO_FLUSH);
+    const auto consumed = static_cast<unsigned long>(zs.next_in - strm);
+    if constexpr (STATS_ENABLED) {
+      auto &s = stats::local();
+      s.inflate_ns.add(stats::now_ns() - t_start);
+      s.compressed_bytes.add(consumed);
+    }
+    strm += consumed;
+    N -= consumed;
+    if (z != Z_OK && z != Z_STREAM_END && z != Z_BUF_ERROR)
+      return fail();
+
+    // Feed the inflated bytes to the tree parser (bytes after the end of the
+    // document are ignored)
+    const StreamChar *out = buffer_.data();
+    auto n_out = static_cast<unsigned long>(zs.next_out - buffer_.data());
+    if (n_out > 0 && !parser_.is_parsed() &&
+        parser_.parse(out, n_out) == ParseResult::FAILED)
+      return fail();
+
+    // End of the compressed stream: the document must be complete
+    if (z == Z_STREAM_END) {
+      if (!parser_.is_parsed())
+        return fail();
+      done_ = true;
+      return ParseResult::SUCCESS;
+    }
+
+    // No more progress possible without new bytes
+    if (zs.next_out == buffer_.data())
+      return ParseResult::UNFINISHED;
+  }
+}
+
+// ============================================================================
+std::optional<Tag> parse_bytes(const StreamChar *data, std::size_t size,
+                               std::pmr::memory_resource *resource) {
+  Reader reader{resource};
+  unsigned long N = size;
+  if (reader.parse(data, N) != ParseResult::SUCCESS)
+    return std::nullopt;
+  return reader.take();
+}
+
+std::optional<Tag> parse_bytes(std::span<const Segment> segments,
+                               std::pmr::memory_resource *resource) {
+  Reader reader{resource};
+  if (parse_segments(reader, segments) != ParseResult::SUCCESS)
+    return std::nullopt;
+  return reader.take();
+}
+
+std::optional<Tag> parse_file(const std::filesystem::path &path,
+                              std::pmr::memory_resource *resource) {
+  std::ifstream file{path, std::ios::binary};
+  if (!file)
+    return std::nullopt;
+  const std::vector<StreamChar> bytes{std::istreambuf_iterator<char>{file},
+                                      std::istreambuf_iterator<char>{}};
+  return parse_bytes(bytes.data(), bytes.size(), resource);
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,476 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Reader and writer of region files (.mca) implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/region.hpp"
+#include "minecraft/nbt/inflate.hpp"
+#include "minecraft/nbt/lz4.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <climits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <zlib.h>
+
+namespace minecraft::nbt {
+
+// Flag of the compression type of chunks stored in a separate file
+static constexpr uint8_t EXTERNAL_CHUNK{0x80};
+// Largest sector count of a chunk in the header of its region
+static constexpr std::size_t MAX_CHUNK_SECTORS{255};
+
+/**
+ * @brief Read a big-endian unsigned integer (region files are big-endian on
+ * every edition)
+ */
+static uint32_t read_u32(const StreamChar *bytes) {
+  return static_cast<uint32_t>(bytes[0]) << 24 |
+         static_cast<uint32_t>(bytes[1]) << 16 |
+         static_cast<uint32_t>(bytes[2]) << 8 | static_cast<uint32_t>(bytes[3]);
+}
+
+// ============================================================================
+// Codecs
+// ============================================================================
+
+/**
+ * @brief Inflate a gzip or zlib payload, in one shot if the document fits in
+ * the size of the last one
+ */
+static bool inflate_payload(std::span<const StreamChar> payload,
+                            std::vector<StreamChar> &document) {
+  return inflate_all(payload, document);
+}
+
+/**
+ * @brief Deflate a document with the given zlib window bits (+ 16 for a gzip
+ * header)
+ */
+static bool deflate_payload(std::span<const StreamChar> document, int level,
+                            int window_bits,
+                            std::vector<StreamChar> &payload) {
+  if (document.size() > UINT_MAX)
+    return false;
+  z_stream zs{};
+  if (deflateInit2(&zs, level, Z_DEFLATED, window_bits, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    return false;
+  payload.resize(deflateBound(&zs, static_cast<uLong>(document.size())));
+  zs.next_in = const_cast<Bytef *>(document.data());
+  zs.avail_in = static_cast<uInt>(document.size());
+  zs.next_out = payload.data();
+  zs.avail_out = static_cast<uInt>(payload.size());
+  const int ret = deflate(&zs, Z_FINISH);
+  payload.resize(zs.total_out);
+  deflateEnd(&zs);
+  return ret == Z_STREAM_END;
+}
+
+static bool copy_payload(std::span<const StreamChar> from,
+                         std::vector<StreamChar> &to) {
+  to.assign(from.begin(), from.end());
+  return true;
+}
+
+// Backends of the compression types (indexed by type)
+using CodecTable = std::array<ChunkCodec, EXTERNAL_CHUNK>;
+static const CodecTable default_codecs{{
+    {},
+    {.decompress = inflate_payload,
+     .compress = [](std::span<const StreamChar> document, int level,
+                    std::vector<StreamChar> &payload) {
+       return deflate_payload(document, level, 15 + 16, payload);
+     }},
+    {.decompress = inflate_payload,
+     .compress = [](std::span<const StreamChar> document, int level,
+                    std::vector<StreamChar> &payload) {
+       return deflate_payload(document, level, 15, payload);
+     }},
+    {.decompress = copy_payload,
+     .compress = [](std::span<const StreamChar> document, int,
+                    std::vector<StreamChar> &payload) {
+       return copy_payload(document, payload);
+     }},
+    {.decompress = lz4_stream_decompress,
+     .compress = [](std::span<const StreamChar> document, int,
+                    std::vector<StreamChar> &payload) {
+       lz4_stream_compress(document, payload);
+       return true;
+     }},
+}};
+
+// Current table, never modified once published: setting a backend publishes
+// a copy, the previous tables being kept alive for the readers still using
+// them
+static std::atomic<const CodecTable *> codecs{&default_codecs};
+
+void set_chunk_codec(ChunkCompression compression, ChunkCodec codec) {
+  const auto type = static_cast<uint8_t>(compression);
+  if (type >= EXTERNAL_CHUNK)
+    return;
+  static std::mutex mutex;
+  static std::vector<std::unique_ptr<const CodecTable>> tables;
+  std::lock_guard lock{mutex};
+  auto table = std::make_unique<CodecTable>(*codecs.load());
+  (*table)[type] = codec;
+  codecs.store(table.get(), std::memory_order_release);
+  tables.push_back(std::move(table));
+}
+
+const ChunkCodec &get_chunk_codec(ChunkCompression compression) {
+  static const ChunkCodec unknown{};
+  const auto type = static_cast<uint8_t>(compression);
+  return type < EXTERNAL_CHUNK
+             ? (*codecs.load(std::memory_order_acquire))[type]
+             : unknown;
+}
+
+bool decompress_chunk(const ChunkData &chunk,
+                      std::vector<StreamChar> &document) {
+  const auto &codec = get_chunk_codec(chunk.compression);
+  return !chunk.external && codec.decompress != nullptr &&
+         codec.decompress(chunk.bytes, document);
+}
+
+bool compress_chunk(std::span<const StreamChar> document,
+                    ChunkCompression compression, int level,
+                    std::vector<StreamChar> &payload) {
+  const auto &codec = get_chunk_codec(compression);
+  return codec.compress != nullptr && codec.compress(document, level, payload);
+}
+
+// ============================================================================
+std::optional<RegionFile> RegionFile::open(const std::filesystem::path &path) {
+  RegionFile region;
+  region.file_.open(path, std::ios::binary | std::ios::ate);
+  if (!region.file_)
+    return std::nullopt;
+  region.file_size_ = static_cast<std::size_t>(region.file_.tellg());
+  if (region.file_size_ < 2 * REGION_SECTOR_SIZE)
+    return std::nullopt;
+
+  std::array<StreamChar, 2 * REGION_SECTOR_SIZE> header;
+  region.file_.seekg(0);
+  if (!region.file_.read(reinterpret_cast<char *>(header.data()),
+                         header.size()))
+    return std::nullopt;
+  for (std::size_t i = 0; i < REGION_CHUNKS; i++) {
+    region.locations_[i] = read_u32(&header[4 * i]);
+    region.timestamps_[i] = read_u32(&header[REGION_SECTOR_SIZE + 4 * i]);
+  }
+  return region;
+}
+
+std::size_t RegionFile::size() const {
+  return static_cast<std::size_t>(
+      std::count_if(locations_.begin(), locations_.end(),
+                    [](uint32_t location) { return location != 0; }));
+}
+
+std::optional<ChunkData>
+RegionFile::read_chunk(std::size_t index, std::vector<StreamChar> &buffer) {
+  if (!contains(index))
+    return std::nullopt;
+  const std::size_t offset = (locations_[index] >> 8) * REGION_SECTOR_SIZE;
+  const std::size_t n_sectors = locations_[index] & 0xff;
+  if (offset < 2 * REGION_SECTOR_SIZE || offset + 5 > file_size_)
+    return std::nullopt;
+
+  // Read the whole sectors at once (clamped to the end of the file), the
+  // payload length is in the first bytes
+  const std::size_t size =
+      std::min(std::max<std::size_t>(n_sectors, 1) * REGION_SECTOR_SIZE,
+               file_size_ - offset);
+  buffer.resize(size);
+  file_.clear();
+  file_.seekg(static_cast<std::streamoff>(offset));
+  if (!file_.read(reinterpret_cast<char *>(buffer.data()),
+                  static_cast<std::streamsize>(size)))
+    return std::nullopt;
+
+  // Length of the payload, compression type included
+  const std::size_t length = read_u32(buffer.data());
+  if (length < 1)
+    return std::nullopt;
+  if (length + 4 > buffer.size()) {
+    // Chunk larger than its sectors count (oversized chunks of old versions)
+    if (offset + 4 + length > file_size_)
+      return std::nullopt;
+    buffer.resize(length + 4);
+    if (!file_.read(reinterpret_cast<char *>(buffer.data() + size),
+                    static_cast<std::streamsize>(length + 4 - size)))
+      return std::nullopt;
+  }
+
+  const uint8_t type = buffer[4];
+  const auto compression =
+      static_cast<ChunkCompression>(type & ~EXTERNAL_CHUNK);
+  if (get_chunk_codec(compression).decompress == nullptr)
+    return std::nullopt;
+  return ChunkData{.compression = compression,
+                   .external = (type & EXTERNAL_CHUNK) != 0,
+                   .bytes = {buffer.data() + 5, length - 1}};
+}
+
+std::optional<Tag> RegionFile::parse_chunk(std::size_t index, Reader &reader,
+                                           std::vector<StreamChar> &buffer) {
+  const auto chunk = read_chunk(index, buffer);
+  if (!chunk || chunk->external)
+    return std::nullopt;
+
+  // The payloads are decompressed in one shot into a buffer kept by the
+  // thread, sized by the previous chunks (the uncompressed ones being parsed
+  // in place)
+  std::span<const StreamChar> bytes = chunk->bytes;
+  thread_local std::vector<StreamChar> document;
+  if (get_chunk_codec(chunk->compression).decompress != copy_payload) {
+    if (!decompress_chunk(*chunk, document))
+      return std::nullopt;
+    bytes = document;
+  }
+  reader.reset();
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  if (reader.parse(strm, N) != ParseResult::SUCCESS) {
+    // Drop the partial tree now: its resource may be released before the
+    // next chunk
+    reader.reset();
+    return std::nullopt;
+  }
+  return reader.take();
+}
+
+// ============================================================================
+// Saving
+// ============================================================================
+
+static void write_u32(StreamChar *bytes, uint32_t value) {
+  bytes[0] = static_cast<StreamChar>(value >> 24);
+  bytes[1] = static_cast<StreamChar>(value >> 16);
+  bytes[2] = static_cast<StreamChar>(value >> 8);
+  bytes[3] = static_cast<StreamChar>(value);
+}
+
+// ============================================================================
+void DirtyChunks::mark(std::size_t index, std::shared_ptr<const Tag> root,
+                       Path path) {
+  auto &chunk = chunks_[index];
+  chunk.root = std::move(root);
+  chunk.timestamp = static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::seconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count());
+  // Already covered by a modified ancestor
+  for (const auto &modified : chunk.modified)
+    if (modified.size() <= path.size() &&
+        std::equal(modified.begin(), modified.end(), path.begin()))
+      return;
+  chunk.modified.push_back(std::move(path));
+}
+
+void DirtyChunks::remove(std::size_t index) { chunks_[index] = {}; }
+
+const DirtyChunk *DirtyChunks::find(std::size_t index) const {
+  const auto it = chunks_.find(index);
+  return it == chunks_.end() ? nullptr : &it->second;
+}
+
+/**
+ * @brief Coordinates of a region from the name of its file (r.<x>.<z>.mca)
+ */
+static std::optional<std::pair<int32_t, int32_t>>
+region_coordinates(const std::filesystem::path &path) {
+  const auto name = path.filename().string();
+  if (!name.starts_with("r.") || !name.ends_with(".mca"))
+    return std::nullopt;
+  const char *p = name.data() + 2;
+  const char *end = name.data() + name.size() - 4;
+  int32_t x, z;
+  auto result = std::from_chars(p, end, x);
+  if (result.ec != std::errc{} || result.ptr == end || *result.ptr != '.')
+    return std::nullopt;
+  result = std::from_chars(result.ptr + 1, end, z);
+  if (result.ec != std::errc{} || result.ptr != end)
+    return std::nullopt;
+  return std::pair{x, z};
+}
+
+std::optional<SaveStats> save_region(const std::filesystem::path &source,
+                                     const std::filesystem::path &target,
+                                     const DirtyChunks &dirty,
+                                     SaveOptions options) {
+  std::optional<RegionFile> region;
+  if (std::filesystem::exists(source)) {
+    region = RegionFile::open(source);
+    if (!region)
+      return std::nullopt;
+  }
+
+  auto temporary = target;
+  temporary += ".tmp";
+  std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+  if (!file)
+    return std::nullopt;
+  std::vector<StreamChar> header(2 * REGION_SECTOR_SIZE, 0);
+  file.write(reinterpret_cast<const char *>(header.data()),
+             static_cast<std::streamsize>(header.size()));
+
+  SaveStats stats;
+  std::size_t sector = 2;
+  std::vector<StreamChar> buffer, document, payload;
+  // External chunks (temporary & final paths), renamed after the region
+  const auto coordinates = region_coordinates(target);
+  std::vector<std::pair<std::filesystem::path, std::filesystem::path>>
+      externals;
+  const auto fail = [&]() -> std::optional<SaveStats> {
+    file.close();
+    std::filesystem::remove(temporary);
+    std::error_code error;
+    for (const auto &external : externals)
+      std::filesystem::remove(external.first, error);
+    return std::nullopt;
+  };
+  for (std::size_t i = 0; i < REGION_CHUNKS; i++) {
+    const auto *chunk = dirty.find(i);
+    const bool original = region && region->contains(i);
+    std::span<const StreamChar> bytes;
+    uint8_t type;
+    uint32_t timestamp;
+
+    if (chunk == nullptr) {
+      // Unmodified: compressed bytes copied verbatim
+      if (!original)
+        continue;
+      const auto data = region->read_chunk(i, buffer);
+      if (!data)
+        return fail();
+      timestamp = region->get_timestamp(i);
+      if (options.recompress && !data->external &&
+          data->compression != options.compression) {
+        if (!decompress_chunk(*data, document) ||
+            !compress_chunk(document, options.compression, options.level,
+                            payload))
+          return fail();
+        bytes = payload;
+        type = static_cast<uint8_t>(options.compression);
+        stats.recompressed++;
+      } else {
+        bytes = data->bytes;
+        type = static_cast<uint8_t>(data->compression) |
+               (data->external ? EXTERNAL_CHUNK : 0);
+        stats.copied++;
+      }
+    } else if (chunk->root == nullptr) {
+      stats.removed += original;
+      continue;
+    } else {
+      // Dirty: serialized, reusing the original document if it can be read
+      std::optional<std::vector<StreamChar>> serialized;
+      if (original) {
+        const auto data = region->read_chunk(i, buffer);
+        if (data && decompress_chunk(*data, document))
+          serialized = serialize_modified(*chunk->root, document,
+                                          chunk->modified);
+      }
+      if (serialized)
+        stats.patched++;
+      else {
+        serialized = serialize(*chunk->root);
+        stats.encoded++;
+      }
+      if (!compress_chunk(*serialized, options.compression, options.level,
+                          payload))
+        return fail();
+      bytes = payload;
+      type = static_cast<uint8_t>(options.compression);
+      timestamp = chunk->timestamp;
+    }
+
+    // Chunks too large for their header entry are stored in a c.<x>.<z>.mcc
+    // file next to the region, the region keeping an empty payload flagged
+    // as external
+    StreamChar prefix[5];
+    if ((sizeof(prefix) + bytes.size() + REGION_SECTOR_SIZE - 1) /
+            REGION_SECTOR_SIZE >
+        MAX_CHUNK_SECTORS) {
+      if (!coordinates)
+        return fail();
+      const int x = coordinates->first * 32 + static_cast<int>(i % 32);
+      const int z = coordinates->second * 32 + static_cast<int>(i / 32);
+      auto path = target.parent_path() / ("c." + std::to_string(x) + "." +
+                                          std::to_string(z) + ".mcc");
+      auto external_temporary = path;
+      external_temporary += ".tmp";
+      externals.emplace_back(std::move(external_temporary), std::move(path));
+      std::ofstream external{externals.back().first,
+                             std::ios::binary | std::ios::trunc};
+      external.write(reinterpret_cast<const char *>(bytes.data()),
+                     static_cast<std::streamsize>(bytes.size()));
+      external.close();
+      if (!external)
+        return fail();
+      bytes = {};
+      type |= EXTERNAL_CHUNK;
+    }
+
+    // Length (compression type included), type & payload, padded to sectors
+    write_u32(prefix, static_cast<uint32_t>(bytes.size() + 1));
+    prefix[4] = type;
+    const std::size_t size = sizeof(prefix) + bytes.size();
+    const std::size_t n_sectors =
+        (size + REGION_SECTOR_SIZE - 1) / REGION_SECTOR_SIZE;
+    file.write(reinterpret_cast<const char *>(prefix), sizeof(prefix));
+    file.write(reinterpret_cast<const char *>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    const std::vector<char> padding(n_sectors * REGION_SECTOR_SIZE - size, 0);
+    file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    write_u32(&header[4 * i], static_cast<uint32_t>(sector << 8 | n_sectors));
+    write_u32(&header[REGION_SECTOR_SIZE + 4 * i], timestamp);
+    sector += n_sectors;
+    if (sector >= 1 << 24)
+      return fail();
+  }
+
+  file.seekp(0);
+  file.write(reinterpret_cast<const char *>(header.data()),
+             static_cast<std::streamsize>(header.size()));
+  file.close();
+  if (!file)
+    return fail();
+  region.reset();
+  std::error_code error;
+  std::filesystem::rename(temporary, target, error);
+  if (error)
+    return fail();
+  for (const auto &[external_temporary, path] : externals) {
+    std::filesystem::rename(external_temporary, path, error);
+    if (error)
+      return std::nullopt;
+  }
+  return stats;
+}
+
+std::optional<SaveStats> transcode_region(const std::filesystem::path &source,
+                                          const std::filesystem::path &target,
+                                          ChunkCompression compression,
+                                          int level) {
+  return save_region(source, target, {},
+                     {.compression = compression,
+                      .level = level,
+                      .recompress = true});
+}
+
+} // namespace minecraft::nbt
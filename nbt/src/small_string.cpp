@@ -0,0 +1,102 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// String of the NBT tree implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/small_string.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace minecraft::nbt {
+
+SmallString::SmallString(SmallString &&other) noexcept
+    : resource_(other.resource_) {
+  std::memcpy(bytes_, other.bytes_, sizeof(bytes_));
+  other.set_inline_size(0);
+}
+
+SmallString::SmallString(SmallString &&other, const allocator_type &alloc)
+    : resource_(alloc.resource()) {
+  // The heap buffer is only taken if it comes from the same resource
+  if (other.is_inline() || resource_->is_equal(*other.resource_)) {
+    std::memcpy(bytes_, other.bytes_, sizeof(bytes_));
+    other.set_inline_size(0);
+  } else {
+    set_inline_size(0);
+    assign(other.view());
+  }
+}
+
+SmallString &SmallString::operator=(SmallString &&other) {
+  if (this == &other)
+    return *this;
+  if (!other.is_inline() && resource_->is_equal(*other.resource_)) {
+    release();
+    std::memcpy(bytes_, other.bytes_, sizeof(bytes_));
+    other.set_inline_size(0);
+  } else
+    assign(other.view());
+  return *this;
+}
+
+void SmallString::assign(std::string_view str) {
+  // A view on this string fits in its storage, so it is never freed here
+  if (str.size() > capacity()) {
+    clear();
+    grow(str.size());
+  }
+  std::memmove(data(), str.data(), str.size());
+  set_size(str.size());
+}
+
+void SmallString::reserve(std::size_t size) {
+  if (size > capacity())
+    grow(size);
+}
+
+void SmallString::resize(std::size_t size) {
+  const auto old_size = this->size();
+  if (size > old_size) {
+    // Geometric growth for the strings built piece by piece
+    if (size > capacity())
+      grow(std::max(size, 2 * capacity()));
+    std::memset(data() + old_size, 0, size - old_size);
+  }
+  set_size(size);
+}
+
+void SmallString::swap(SmallString &other) noexcept {
+  std::swap(bytes_, other.bytes_);
+  std::swap(resource_, other.resource_);
+}
+
+void SmallString::grow(std::size_t capacity) {
+  if (capacity > UINT32_MAX)
+    throw std::length_error("SmallString: string over 4 GB");
+  auto *buffer = static_cast<char *>(resource_->allocate(capacity + 1, 1));
+  const auto size = this->size();
+  std::memcpy(buffer, data(), size);
+  buffer[size] = 0;
+  release();
+  store<char *>(0, buffer);
+  store<std::size_t>(8, size);
+  store<uint32_t>(16, static_cast<uint32_t>(capacity));
+  bytes_[FLAG] = HEAP;
+}
+
+void SmallString::release() {
+  if (!is_inline()) {
+    resource_->deallocate(load<char *>(0), capacity() + 1, 1);
+    set_inline_size(0);
+  }
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,410 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Snapshots of parsed documents implementation
+//
+// A snapshot is the header, followed by the content of the nodes: the
+// records of the elements of each list and the entries of each compound are
+// contiguous (so that they can be indexed or binary searched), the arrays are
+// 8-bytes aligned and every distinct string is stored once, NUL-terminated.
+// The offsets are from the start of the snapshot, so it can be mapped
+// anywhere.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/snapshot.hpp"
+#include "minecraft/nbt/reader.hpp"
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+#if __has_include(<sys/mman.h>)
+#define NBT_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define NBT_HAS_MMAP 0
+#endif
+
+namespace minecraft::nbt {
+
+static constexpr char SNAPSHOT_MAGIC[8]{'N', 'B', 'T', 'S', 'N', 'A', 'P', 0};
+static constexpr uint32_t SNAPSHOT_BYTE_ORDER{0x01020304};
+
+// ============================================================================
+// Building
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Writer of a snapshot into a growing buffer
+ */
+class SnapshotWriter {
+public:
+  explicit SnapshotWriter(std::vector<StreamChar> &out) : out_(out) {}
+
+  /**
+   * @brief Reserve bytes aligned on the given boundary
+   *
+   * @return their offset
+   */
+  std::size_t allocate(std::size_t size, std::size_t align = 8) {
+    const std::size_t offset = (out_.size() + align - 1) / align * align;
+    out_.resize(offset + size);
+    return offset;
+  }
+
+  template <typename T> void store(std::size_t offset, const T &value) {
+    std::memcpy(out_.data() + offset, &value, sizeof(T));
+  }
+
+  /**
+   * @brief Offset of a string, stored at its first occurrence
+   */
+  uint32_t intern(std::string_view str) {
+    const auto [it, inserted] = strings_.try_emplace(str, 0);
+    if (inserted) {
+      const auto offset = allocate(str.size() + 1, 1);
+      std::memcpy(out_.data() + offset, str.data(), str.size());
+      it->second = static_cast<uint32_t>(offset);
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief Record of a value, its content being written after the current
+   * end of the snapshot
+   */
+  SnapshotRecord write(const Tag &tag) {
+    SnapshotRecord record{.tag = static_cast<uint8_t>(tag.tag()),
+                          .elem_tag = 0,
+                          .reserved = 0,
+                          .size = 0,
+                          .value = 0};
+    std::visit(
+        [&](const auto &value) {
+          using T = std::decay_t<decltype(value)>;
+          if constexpr (std::is_same_v<T, std::monostate>)
+            return;
+          else if constexpr (std::is_same_v<T, float>)
+            record.value = std::bit_cast<uint32_t>(value);
+          else if constexpr (std::is_same_v<T, double>)
+            record.value = std::bit_cast<uint64_t>(value);
+          else if constexpr (std::is_integral_v<T>)
+            record.value = static_cast<uint64_t>(value);
+          else if constexpr (std::is_same_v<T, SmallString>) {
+            record.size = static_cast<uint32_t>(value.size());
+            record.value = intern(value);
+          } else if constexpr (std::is_same_v<T, List>) {
+            record.elem_tag = static_cast<uint8_t>(value.elem_tag);
+            record.size = static_cast<uint32_t>(value.size());
+            const auto offset =
+                allocate(value.size() * sizeof(SnapshotRecord));
+            record.value = offset;
+            for (std::size_t i = 0; i < value.size(); i++)
+              store(offset + i * sizeof(SnapshotRecord), write(value[i]));
+          } else if constexpr (std::is_same_v<T, Compound>) {
+            // Entries sorted by name, for the binary search
+            std::vector<std::pair<std::string_view, const Tag *>> sorted;
+            sorted.reserve(value.size());
+            for (const auto &[name, child] : value)
+              sorted.emplace_back(name, &child);
+            std::sort(sorted.begin(), sorted.end(),
+                      [](const auto &a, const auto &b) {
+                        return a.first < b.first;
+                      });
+            record.size = static_cast<uint32_t>(sorted.size());
+            const auto offset = allocate(sorted.size() * sizeof(SnapshotEntry));
+            record.value = offset;
+            for (std::size_t i = 0; i < sorted.size(); i++) {
+              const auto name = intern(sorted[i].first);
+              const SnapshotEntry entry{
+                  .name = name,
+                  .name_size = static_cast<uint32_t>(sorted[i].first.size()),
+                  .record = write(*sorted[i].second)};
+              store(offset + i * sizeof(SnapshotEntry), entry);
+            }
+          } else {
+            // Arrays, decoded
+            using E = typename T::value_type;
+            record.size = static_cast<uint32_t>(value.size());
+            const auto offset = allocate(value.size() * sizeof(E));
+            record.value = offset;
+            if (!value.empty())
+              std::memcpy(out_.data() + offset, value.data(),
+                          value.size() * sizeof(E));
+          }
+        },
+        static_cast<const TagVariant &>(tag));
+    return record;
+  }
+
+private:
+  std::vector<StreamChar> &out_;
+  std::unordered_map<std::string_view, uint32_t> strings_;
+};
+
+} // namespace
+
+std::optional<std::vector<StreamChar>>
+build_snapshot(const Tag &root, std::string_view name, Hash source_hash) {
+  std::vector<StreamChar> out;
+  SnapshotWriter writer{out};
+  writer.allocate(sizeof(SnapshotHeader));
+  SnapshotHeader header{};
+  std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+  header.version = SNAPSHOT_VERSION;
+  header.byte_order = SNAPSHOT_BYTE_ORDER;
+  header.source_hash = source_hash;
+  header.name = writer.intern(name);
+  header.name_size = static_cast<uint32_t>(name.size());
+  header.root = writer.write(root);
+  // Offsets are 32 bits (the scalars hold their bits, not offsets)
+  if (out.size() > UINT32_MAX)
+    return std::nullopt;
+  header.size = out.size();
+  writer.store(0, header);
+  return out;
+}
+
+// ============================================================================
+// Values
+// ============================================================================
+
+Tag SnapshotValue::to_tag(std::pmr::memory_resource *resource) const {
+  switch (tag()) {
+  case Tags::Byte:
+    return Tag{get<int8_t>()};
+  case Tags::Short:
+    return Tag{get<int16_t>()};
+  case Tags::Int:
+    return Tag{get<int32_t>()};
+  case Tags::Long:
+    return Tag{get<int64_t>()};
+  case Tags::Float:
+    return Tag{get<float>()};
+  case Tags::Double:
+    return Tag{get<double>()};
+  case Tags::String:
+    return Tag{SmallString{string(), resource}};
+  case Tags::ByteArray: {
+    const auto elems = array<int8_t>();
+    return Tag{std::pmr::vector<int8_t>{elems.begin(), elems.end(), resource}};
+  }
+  case Tags::IntArray: {
+    const auto elems = array<int32_t>();
+    return Tag{
+        std::pmr::vector<int32_t>{elems.begin(), elems.end(), resource}};
+  }
+  case Tags::LongArray: {
+    const auto elems = array<int64_t>();
+    return Tag{
+        std::pmr::vector<int64_t>{elems.begin(), elems.end(), resource}};
+  }
+  case Tags::List: {
+    List list{resource};
+    list.elem_tag = elem_tag();
+    list.reserve(size());
+    for (std::size_t i = 0; i < size(); i++)
+      list.push_back((*this)[i].to_tag(resource));
+    return Tag{std::move(list)};
+  }
+  case Tags::Compound: {
+    Compound compound{resource};
+    for (std::size_t i = 0; i < size(); i++)
+      compound.insert_or_assign(SmallString{name_at(i), resource},
+                                value_at(i).to_tag(resource));
+    return Tag{std::move(compound)};
+  }
+  default:
+    return Tag{};
+  }
+}
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+bool Snapshot::check_header() const {
+  if (size_ < sizeof(SnapshotHeader) ||
+      reinterpret_cast<uintptr_t>(data_) % alignof(SnapshotHeader) != 0)
+    return false;
+  const auto &h = header();
+  return std::memcmp(h.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0 &&
+         h.version == SNAPSHOT_VERSION &&
+         h.byte_order == SNAPSHOT_BYTE_ORDER && h.size == size_ &&
+         h.name <= size_ && h.name_size <= size_ - h.name;
+}
+
+std::optional<Snapshot> Snapshot::open(const std::filesystem::path &path) {
+  Snapshot snapshot;
+#if NBT_HAS_MMAP
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return std::nullopt;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return std::nullopt;
+  }
+  void *data = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    return std::nullopt;
+  snapshot.data_ = static_cast<const StreamChar *>(data);
+  snapshot.size_ = static_cast<std::size_t>(st.st_size);
+  snapshot.mapped_ = true;
+  if (!snapshot.check_header())
+    return std::nullopt;
+  return snapshot;
+#else
+  std::ifstream file{path, std::ios::binary};
+  if (!file)
+    return std::nullopt;
+  return from_bytes({std::istreambuf_iterator<char>{file},
+                     std::istreambuf_iterator<char>{}});
+#endif
+}
+
+std::optional<Snapshot> Snapshot::from_bytes(std::vector<StreamChar> bytes) {
+  Snapshot snapshot;
+  snapshot.owned_ = std::move(bytes);
+  snapshot.data_ = snapshot.owned_.data();
+  snapshot.size_ = snapshot.owned_.size();
+  if (!snapshot.check_header())
+    return std::nullopt;
+  return snapshot;
+}
+
+Snapshot::Snapshot(Snapshot &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapped_(std::exchange(other.mapped_, false)),
+      owned_(std::move(other.owned_)) {}
+
+Snapshot &Snapshot::operator=(Snapshot &&other) noexcept {
+  if (this != &other) {
+    this->~Snapshot();
+    new (this) Snapshot(std::move(other));
+  }
+  return *this;
+}
+
+Snapshot::~Snapshot() {
+#if NBT_HAS_MMAP
+  if (mapped_)
+    munmap(const_cast<StreamChar *>(data_), size_);
+#endif
+}
+
+bool Snapshot::verify() const {
+  // Whether [offset, offset + n * size) lies in the snapshot, aligned
+  const auto in_bounds = [this](uint64_t offset, uint64_t n, uint64_t size,
+                                uint64_t align) {
+    return offset % align == 0 && offset <= size_ &&
+           n <= (size_ - offset) / size;
+  };
+  const auto check = [&](const auto &self, const SnapshotRecord &record,
+                         std::size_t depth) -> bool {
+    if (depth > 512)
+      return false;
+    switch (static_cast<Tags>(record.tag)) {
+    case Tags::Byte:
+    case Tags::Short:
+    case Tags::Int:
+    case Tags::Long:
+    case Tags::Float:
+    case Tags::Double:
+      return true;
+    case Tags::String:
+      return in_bounds(record.value, record.size, 1, 1);
+    case Tags::ByteArray:
+      return in_bounds(record.value, record.size, 1, 1);
+    case Tags::IntArray:
+      return in_bounds(record.value, record.size, 4, 4);
+    case Tags::LongArray:
+      return in_bounds(record.value, record.size, 8, 8);
+    case Tags::List: {
+      if (!in_bounds(record.value, record.size, sizeof(SnapshotRecord), 8))
+        return false;
+      const auto *records =
+          reinterpret_cast<const SnapshotRecord *>(data_ + record.value);
+      for (uint32_t i = 0; i < record.size; i++)
+        if (records[i].tag != record.elem_tag ||
+            !self(self, records[i], depth + 1))
+          return false;
+      return true;
+    }
+    case Tags::Compound: {
+      if (!in_bounds(record.value, record.size, sizeof(SnapshotEntry), 8))
+        return false;
+      const auto *entries =
+          reinterpret_cast<const SnapshotEntry *>(data_ + record.value);
+      for (uint32_t i = 0; i < record.size; i++)
+        if (!in_bounds(entries[i].name, entries[i].name_size, 1, 1) ||
+            !self(self, entries[i].record, depth + 1))
+          return false;
+      return true;
+    }
+    default:
+      return false;
+    }
+  };
+  return check(check, header().root, 0);
+}
+
+// ============================================================================
+std::optional<Snapshot> load_snapshot(const std::filesystem::path &source,
+                                      const std::filesystem::path &snapshot) {
+  std::ifstream file{source, std::ios::binary};
+  if (!file)
+    return std::nullopt;
+  const std::vector<StreamChar> bytes{std::istreambuf_iterator<char>{file},
+                                      std::istreambuf_iterator<char>{}};
+  const auto hash = hash_bytes(bytes);
+  if (auto existing = Snapshot::open(snapshot);
+      existing && existing->source_hash() == hash)
+    return existing;
+
+  // Missing or stale: rebuilt from the parsed source
+  Reader reader;
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  if (reader.parse(strm, N) != ParseResult::SUCCESS)
+    return std::nullopt;
+  auto built = build_snapshot(*reader.get(), reader.get_name(), hash);
+  if (!built)
+    return std::nullopt;
+
+  auto temporary = snapshot;
+  temporary += ".tmp";
+  {
+    std::ofstream out{temporary, std::ios::binary | std::ios::trunc};
+    out.write(reinterpret_cast<const char *>(built->data()),
+              static_cast<std::streamsize>(built->size()));
+    if (!out)
+      return Snapshot::from_bytes(std::move(*built));
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary, snapshot, error);
+  if (error) {
+    std::filesystem::remove(temporary, error);
+    return Snapshot::from_bytes(std::move(*built));
+  }
+  if (auto mapped = Snapshot::open(snapshot))
+    return mapped;
+  return Snapshot::from_bytes(std::move(*built));
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,210 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Parsing statistics and counters implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/stats.hpp"
+#include "minecraft/nbt/tag.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace minecraft::nbt {
+
+static_assert(N_STATS_TAGS == N_TAGS, "Statistics must track every tag type");
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+/**
+ * @brief Apply the given operation on every (sum or max) field of the two
+ * statistics
+ */
+template <typename A, typename B, typename Sum, typename Max>
+static void for_each_field(A &a, B &b, Sum sum, Max max) {
+  sum(a.bytes, b.bytes);
+  sum(a.compressed_bytes, b.compressed_bytes);
+  sum(a.documents, b.documents);
+  sum(a.failures, b.failures);
+  sum(a.resumptions, b.resumptions);
+  sum(a.allocations, b.allocations);
+  sum(a.allocated_bytes, b.allocated_bytes);
+  sum(a.inflate_ns, b.inflate_ns);
+  sum(a.parse_ns, b.parse_ns);
+  max(a.largest_array, b.largest_array);
+  max(a.largest_string, b.largest_string);
+  for (std::size_t i = 0; i < N_STATS_TAGS; i++)
+    sum(a.values[i], b.values[i]);
+}
+
+ParseStats &ParseStats::operator+=(const ParseStats &other) {
+  for_each_field(
+      *this, other, [](uint64_t &a, uint64_t b) { a += b; },
+      [](uint64_t &a, uint64_t b) { a = std::max(a, b); });
+  return *this;
+}
+
+/**
+ * @brief Snapshot of live counters
+ */
+static ParseStats snapshot(const stats::LiveStats &live) {
+  ParseStats out;
+  const auto copy = [](uint64_t &a, const stats::Counter &b) { a = b.get(); };
+  for_each_field(out, live, copy, copy);
+  return out;
+}
+
+// ============================================================================
+// Threads registry
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Registry of the counters of the alive threads, and accumulator of
+ * the counters of the exited ones.
+ */
+struct Registry {
+  std::mutex mutex;
+  std::vector<const stats::LiveStats *> alive;
+  ParseStats exited;
+
+  static Registry &instance() {
+    // Never destroyed: threads may exit after the static destructors
+    static auto *registry = new Registry();
+    return *registry;
+  }
+};
+
+/**
+ * @brief Counters of a thread, registered for its whole lifetime
+ */
+struct ThreadStats {
+  stats::LiveStats live;
+
+  ThreadStats() {
+    auto &registry = Registry::instance();
+    std::lock_guard lock{registry.mutex};
+    registry.alive.push_back(&live);
+  }
+
+  ~ThreadStats() {
+    auto &registry = Registry::instance();
+    std::lock_guard lock{registry.mutex};
+    registry.exited += snapshot(live);
+    std::erase(registry.alive, &live);
+  }
+};
+
+} // namespace
+
+stats::LiveStats &stats::local() {
+  thread_local ThreadStats stats;
+  return stats.live;
+}
+
+ParseStats thread_stats() {
+  if constexpr (!STATS_ENABLED)
+    return {};
+  return snapshot(stats::local());
+}
+
+ParseStats collect_stats() {
+  if constexpr (!STATS_ENABLED)
+    return {};
+  auto &registry = Registry::instance();
+  std::lock_guard lock{registry.mutex};
+  ParseStats out = registry.exited;
+  for (const auto *live : registry.alive)
+    out += snapshot(*live);
+  return out;
+}
+
+void reset_thread_stats() {
+  if constexpr (!STATS_ENABLED)
+    return;
+  auto &live = stats::local();
+  const auto zero = [](stats::Counter &a, const stats::Counter &) {
+    a.value.store(0, std::memory_order_relaxed);
+  };
+  for_each_field(live, live, zero, zero);
+}
+
+// ============================================================================
+// Export
+// ============================================================================
+
+std::string to_prometheus(const ParseStats &stats, std::string_view prefix) {
+  const int n_prefix = static_cast<int>(prefix.size());
+  std::string out;
+  char line[256];
+  const auto metric = [&](const char *name, const char *type,
+                          const char *help, const std::string &value) {
+    std::snprintf(line, sizeof(line),
+                  "# HELP %.*s_%s %s\n# TYPE %.*s_%s %s\n%.*s_%s %s\n",
+                  n_prefix, prefix.data(), name, help, n_prefix,
+                  prefix.data(), name, type, n_prefix, prefix.data(), name,
+                  value.c_str());
+    out += line;
+  };
+  const auto seconds = [](uint64_t ns) {
+    char value[32];
+    std::snprintf(value, sizeof(value), "%.9f", ns * 1e-9);
+    return std::string{value};
+  };
+  using std::to_string;
+
+  metric("bytes_total", "counter", "Bytes consumed by the tree parsers.",
+         to_string(stats.bytes));
+  metric("compressed_bytes_total", "counter",
+         "Bytes consumed by the readers before inflating.",
+         to_string(stats.compressed_bytes));
+  metric("documents_total", "counter", "Documents completely parsed.",
+         to_string(stats.documents));
+  metric("failures_total", "counter", "Parsing that failed.",
+         to_string(stats.failures));
+  metric("resumptions_total", "counter",
+         "Parsing interrupted because of missing bytes.",
+         to_string(stats.resumptions));
+  metric("allocations_total", "counter",
+         "Heap allocations requested for the parsed trees.",
+         to_string(stats.allocations));
+  metric("allocated_bytes_total", "counter",
+         "Bytes requested for the parsed trees.",
+         to_string(stats.allocated_bytes));
+  metric("inflate_seconds_total", "counter", "Time spent decompressing.",
+         seconds(stats.inflate_ns));
+  metric("parse_seconds_total", "counter", "Time spent parsing.",
+         seconds(stats.parse_ns));
+  metric("largest_array_elements", "gauge",
+         "Largest array or list parsed (number of elements).",
+         to_string(stats.largest_array));
+  metric("largest_string_bytes", "gauge", "Largest string parsed (bytes).",
+         to_string(stats.largest_string));
+
+  // Values per tag type, as one labelled metric
+  std::snprintf(line, sizeof(line),
+                "# HELP %.*s_values_total Values parsed per tag type.\n"
+                "# TYPE %.*s_values_total counter\n",
+                n_prefix, prefix.data(), n_prefix, prefix.data());
+  out += line;
+  for (std::size_t i = 0; i < N_STATS_TAGS; i++) {
+    std::snprintf(line, sizeof(line), "%.*s_values_total{tag=\"%s\"} %llu\n",
+                  n_prefix, prefix.data(),
+                  getName(static_cast<Tags>(i)),
+                  static_cast<unsigned long long>(stats.values[i]));
+    out += line;
+  }
+  return out;
+}
+
+} // namespace minecraft::nbt
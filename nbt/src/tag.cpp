@@ -0,0 +1,140 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// NBT tree implementation (compound entries and their index)
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/tag.hpp"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace minecraft::nbt {
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+Tag &Compound::at(std::string_view name) {
+  const auto it = find(name);
+  if (it == end())
+    throw std::out_of_range("Compound::at: no such entry");
+  return it->second;
+}
+
+const Tag &Compound::at(std::string_view name) const {
+  const auto it = find(name);
+  if (it == end())
+    throw std::out_of_range("Compound::at: no such entry");
+  return it->second;
+}
+
+// ============================================================================
+// Modifiers
+// ============================================================================
+
+Tag &Compound::operator[](std::string_view name) {
+  return try_emplace(name).first->second;
+}
+
+std::pair<Compound::iterator, bool> Compound::insert(const_iterator pos,
+                                                     value_type &&entry) {
+  if (auto it = find(entry.first); it != end())
+    return {it, false};
+  if (pos == entries_.cend()) {
+    entries_.push_back(std::move(entry));
+    index_back();
+    return {std::prev(end()), true};
+  }
+  const auto it = entries_.insert(pos, std::move(entry));
+  // The following entries moved up: their positions are all outdated
+  rebuild_index();
+  return {it, true};
+}
+
+Compound::iterator Compound::erase(const_iterator pos) {
+  const auto index = pos - entries_.cbegin();
+  entries_.erase(pos);
+  // The following entries moved down: their positions are all outdated
+  rebuild_index();
+  return entries_.begin() + index;
+}
+
+std::size_t Compound::erase(std::string_view name) {
+  const auto it = find(name);
+  if (it == end())
+    return 0;
+  erase(it);
+  return 1;
+}
+
+bool Compound::rename(const_iterator pos, std::string_view name) {
+  const auto it = entries_.begin() + (pos - entries_.cbegin());
+  if (const auto other = find(name); other != end())
+    return other == it;
+  it->first.assign(name);
+  rebuild_index();
+  return true;
+}
+
+void Compound::clear() {
+  entries_.clear();
+  index_.clear();
+}
+
+bool Compound::operator==(const Compound &other) const {
+  if (size() != other.size())
+    return false;
+  // Same order: no lookup needed
+  if (std::equal(begin(), end(), other.begin()))
+    return true;
+  return std::all_of(begin(), end(), [&other](const value_type &entry) {
+    const auto it = other.find(entry.first);
+    return it != other.end() && it->second == entry.second;
+  });
+}
+
+// ============================================================================
+// Index
+// ============================================================================
+
+void Compound::index_back() {
+  if (entries_.size() <= INDEX_THRESHOLD)
+    return;
+
+  // Kept at most half full, so that the probe sequences stay short
+  if (2 * entries_.size() > index_.size()) {
+    rebuild_index();
+    return;
+  }
+  const uint32_t h = hash(entries_.back().first);
+  const std::size_t mask = index_.size() - 1;
+  std::size_t i = h & mask;
+  while (index_[i].position != 0)
+    i = (i + 1) & mask;
+  index_[i] = {h, static_cast<uint32_t>(entries_.size())};
+}
+
+void Compound::rebuild_index() {
+  index_.clear();
+  if (entries_.size() <= INDEX_THRESHOLD)
+    return;
+
+  index_.resize(std::bit_ceil(4 * entries_.size()), Slot{0, 0});
+  const std::size_t mask = index_.size() - 1;
+  for (std::size_t n = 0; n < entries_.size(); n++) {
+    const uint32_t h = hash(entries_[n].first);
+    std::size_t i = h & mask;
+    while (index_[i].position != 0)
+      i = (i + 1) & mask;
+    index_[i] = {h, static_cast<uint32_t>(n + 1)};
+  }
+}
+
+} // namespace minecraft::nbt
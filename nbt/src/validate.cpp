@@ -0,0 +1,244 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Validation of untrusted NBT documents implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/validate.hpp"
+#include "minecraft/nbt/types.hpp"
+#include <algorithm>
+#include <array>
+
+namespace minecraft::nbt {
+
+/**
+ * @brief Size of the payload of the fixed-size tags (0 for the others)
+ */
+static constexpr std::size_t fixed_size(Tags tag) {
+  switch (tag) {
+  case Tags::Byte:
+    return 1;
+  case Tags::Short:
+    return 2;
+  case Tags::Int:
+  case Tags::Float:
+    return 4;
+  case Tags::Long:
+  case Tags::Double:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief Size of the elements of the array tags (0 for the others)
+ */
+static constexpr std::size_t array_elem_size(Tags tag) {
+  switch (tag) {
+  case Tags::ByteArray:
+    return 1;
+  case Tags::IntArray:
+    return 4;
+  case Tags::LongArray:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief Smallest payload of a value of the given tag
+ */
+static constexpr std::size_t min_size(Tags tag) {
+  switch (tag) {
+  case Tags::String:
+    return 2;
+  case Tags::ByteArray:
+  case Tags::IntArray:
+  case Tags::LongArray:
+    return 4;
+  case Tags::List:
+    return 5;
+  case Tags::Compound:
+    return 1;
+  default:
+    return fixed_size(tag);
+  }
+}
+
+namespace {
+
+/**
+ * @brief Walk of a document, checking each value as it goes
+ */
+class Validator {
+public:
+  Validator(std::span<const StreamChar> document,
+            const ValidationLimits &limits)
+      : b_(document.data()), n_(document.size()), limits_(limits),
+        max_depth_(
+            std::min(limits.max_depth, ValidationLimits::MAX_DEPTH)) {}
+
+  Validation run() {
+    // Root
+    if (n_ < 1)
+      return error(ValidationError::TRUNCATED);
+    const auto root = static_cast<Tags>(b_[pos_++]);
+    if (auto e = name(); e != ValidationError::NONE)
+      return error(e);
+    if (auto e = value(root); e != ValidationError::NONE)
+      return error(e);
+
+    // Content of the open compounds and lists
+    while (depth_ > 0) {
+      auto &frame = stack_[depth_ - 1];
+      Tags tag;
+      if (frame.tag == Tags::Compound) {
+        if (n_ - pos_ < 1)
+          return error(ValidationError::TRUNCATED);
+        tag = static_cast<Tags>(b_[pos_++]);
+        if (tag == Tags::END) {
+          depth_--;
+          continue;
+        }
+        if (++elements_ > limits_.max_elements)
+          return error(ValidationError::TOO_MANY_ELEMENTS);
+        if (auto e = name(); e != ValidationError::NONE)
+          return error(e);
+      } else if (const auto size = fixed_size(frame.elem_tag)) {
+        // Elements of fixed size skipped at once (the list header checked
+        // that they fit in the document)
+        pos_ += frame.remaining * size;
+        depth_--;
+        continue;
+      } else {
+        if (frame.remaining == 0) {
+          depth_--;
+          continue;
+        }
+        frame.remaining--;
+        tag = frame.elem_tag;
+      }
+      if (auto e = value(tag); e != ValidationError::NONE)
+        return error(e);
+    }
+    return {ValidationError::NONE, pos_};
+  }
+
+private:
+  /**
+   * @brief Open compound or list
+   */
+  struct Frame {
+    Tags tag;           // Compound or List
+    Tags elem_tag;      // Of a list
+    uint32_t remaining; // Elements of a list
+  };
+
+  inline Validation error(ValidationError e) const { return {e, pos_}; }
+
+  /**
+   * @brief Check a length-prefixed string (a name or a String payload)
+   */
+  ValidationError name() {
+    if (n_ - pos_ < 2)
+      return ValidationError::TRUNCATED;
+    const auto length = load_integral<uint16_t, NBT_BIG_ENDIAN>(b_ + pos_);
+    if (length > limits_.max_string_size)
+      return ValidationError::STRING_TOO_LONG;
+    if (n_ - pos_ - 2 < length)
+      return ValidationError::TRUNCATED;
+    pos_ += 2 + length;
+    return ValidationError::NONE;
+  }
+
+  /**
+   * @brief Check the length of a list or an array of the given elements
+   */
+  ValidationError count(int32_t count, std::size_t elem_size) {
+    if (count < 0)
+      return ValidationError::NEGATIVE_SIZE;
+    if (static_cast<uint32_t>(count) > limits_.max_array_size)
+      return ValidationError::ARRAY_TOO_LARGE;
+    elements_ += static_cast<uint32_t>(count);
+    if (elements_ > limits_.max_elements)
+      return ValidationError::TOO_MANY_ELEMENTS;
+    if (elem_size > 0 &&
+        (n_ - pos_) / elem_size < static_cast<std::size_t>(count))
+      return ValidationError::TRUNCATED;
+    return ValidationError::NONE;
+  }
+
+  /**
+   * @brief Check the payload of a value, opening the compounds and lists
+   */
+  ValidationError value(Tags tag) {
+    if (const auto size = fixed_size(tag)) {
+      if (n_ - pos_ < size)
+        return ValidationError::TRUNCATED;
+      pos_ += size;
+      return ValidationError::NONE;
+    }
+    if (const auto elem = array_elem_size(tag)) {
+      if (n_ - pos_ < 4)
+        return ValidationError::TRUNCATED;
+      const auto n = load_integral<int32_t, NBT_BIG_ENDIAN>(b_ + pos_);
+      pos_ += 4;
+      if (auto e = count(n, elem); e != ValidationError::NONE)
+        return e;
+      pos_ += static_cast<std::size_t>(n) * elem;
+      return ValidationError::NONE;
+    }
+    switch (tag) {
+    case Tags::String:
+      return name();
+    case Tags::Compound:
+      if (depth_ >= max_depth_)
+        return ValidationError::TOO_DEEP;
+      stack_[depth_++] = {Tags::Compound, Tags::END, 0};
+      return ValidationError::NONE;
+    case Tags::List: {
+      if (depth_ >= max_depth_)
+        return ValidationError::TOO_DEEP;
+      if (n_ - pos_ < 5)
+        return ValidationError::TRUNCATED;
+      const auto elem_tag = static_cast<Tags>(b_[pos_]);
+      const auto n = load_integral<int32_t, NBT_BIG_ENDIAN>(b_ + pos_ + 1);
+      if (elem_tag > Tags::LongArray || (n > 0 && elem_tag == Tags::END))
+        return ValidationError::INVALID_TAG;
+      pos_ += 5;
+      if (auto e = count(n, min_size(elem_tag)); e != ValidationError::NONE)
+        return e;
+      stack_[depth_++] = {Tags::List, elem_tag, static_cast<uint32_t>(n)};
+      return ValidationError::NONE;
+    }
+    default:
+      return ValidationError::INVALID_TAG;
+    }
+  }
+
+  const StreamChar *b_;
+  std::size_t n_;
+  const ValidationLimits &limits_;
+  std::size_t max_depth_;
+  std::size_t pos_ = 0;
+  uint64_t elements_ = 0;
+  std::size_t depth_ = 0;
+  std::array<Frame, ValidationLimits::MAX_DEPTH> stack_;
+};
+
+} // namespace
+
+Validation validate(std::span<const StreamChar> document,
+                    const ValidationLimits &limits) {
+  return Validator{document, limits}.run();
+}
+
+} // namespace minecraft::nbt
@@ -0,0 +1,220 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Serialization of NBT trees implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/writer.hpp"
+#include "minecraft/nbt/raw.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+
+namespace minecraft::nbt {
+
+template <std::integral T>
+static void put(std::vector<StreamChar> &out, T value) {
+  const auto size = out.size();
+  out.resize(size + sizeof(T));
+  store_integral<T, NBT_BIG_ENDIAN>(out.data() + size, value);
+}
+
+static void put_string(std::vector<StreamChar> &out, std::string_view str) {
+  put(out, static_cast<uint16_t>(str.size()));
+  out.insert(out.end(), str.begin(), str.end());
+}
+
+template <typename T>
+static void put_array(std::vector<StreamChar> &out,
+                      const std::pmr::vector<T> &values) {
+  put(out, static_cast<int32_t>(values.size()));
+  const auto size = out.size();
+  out.resize(size + values.size() * sizeof(T));
+  for (std::size_t i = 0; i < values.size(); i++)
+    store_integral<T, NBT_BIG_ENDIAN>(out.data() + size + i * sizeof(T),
+                                      values[i]);
+}
+
+// ============================================================================
+void write_payload(std::vector<StreamChar> &out, const Tag &tag) {
+  std::visit(
+      [&out](const auto &value) {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, std::monostate>)
+          return;
+        else if constexpr (std::is_same_v<T, float>)
+          put(out, std::bit_cast<int32_t>(value));
+        else if constexpr (std::is_same_v<T, double>)
+          put(out, std::bit_cast<int64_t>(value));
+        else if constexpr (std::integral<T>)
+          put(out, value);
+        else if constexpr (std::is_same_v<T, SmallString>)
+          put_string(out, value);
+        else if constexpr (std::is_same_v<T, List>) {
+          // Empty lists of unknown type are written as lists of END
+          put(out, static_cast<TagID_t>(value.empty() ? value.elem_tag
+                                                      : value.front().tag()));
+          put(out, static_cast<int32_t>(value.size()));
+          for (const auto &elem : value)
+            write_payload(out, elem);
+        } else if constexpr (std::is_same_v<T, Compound>) {
+          for (const auto &[name, entry] : value)
+            write_named(out, entry, name);
+          put(out, static_cast<TagID_t>(Tags::END));
+        } else
+          put_array(out, value);
+      },
+      static_cast<const TagVariant &>(tag));
+}
+
+void write_named(std::vector<StreamChar> &out, const Tag &tag,
+                 std::string_view name) {
+  put(out, static_cast<TagID_t>(tag.tag()));
+  put_string(out, name);
+  write_payload(out, tag);
+}
+
+std::vector<StreamChar> serialize(const Tag &root, std::string_view name) {
+  std::vector<StreamChar> out;
+  write_named(out, root, name);
+  return out;
+}
+
+// ============================================================================
+// Serialization reusing the original bytes
+// ============================================================================
+
+namespace {
+
+using RawPayload = std::optional<std::span<const StreamChar>>;
+
+/**
+ * @brief Writer of a modified tree along the bytes of its original document
+ */
+class ModifiedWriter {
+public:
+  explicit ModifiedWriter(std::vector<StreamChar> &out) : out_(out) {}
+
+  /**
+   * @brief Write the payload of a value
+   *
+   * @param raw its payload in the original document, if it has one
+   * @param paths the modified paths going through the value
+   * @param depth number of steps of the paths leading to the value
+   */
+  bool write(const Tag &tag, RawPayload raw,
+             const std::vector<const Path *> &paths, std::size_t depth) {
+    if (raw && paths.empty()) {
+      out_.insert(out_.end(), raw->begin(), raw->end());
+      return true;
+    }
+    // Modified as a whole (or new)
+    const bool whole = !raw || std::any_of(paths.begin(), paths.end(),
+                                           [depth](const Path *path) {
+                                             return path->size() == depth;
+                                           });
+    if (whole || (!tag.as_ptr<Compound>() && !tag.as_ptr<List>())) {
+      write_payload(out_, tag);
+      return true;
+    }
+    if (const auto *compound = tag.as_ptr<Compound>())
+      return write_compound(*compound, *raw, paths, depth);
+    return write_list(tag.as<List>(), *raw, paths, depth);
+  }
+
+private:
+  /**
+   * @brief Select the paths going through the given step
+   */
+  template <typename Step, typename Value>
+  static std::vector<const Path *>
+  select(const std::vector<const Path *> &paths, std::size_t depth,
+         const Value &step) {
+    std::vector<const Path *> selected;
+    for (const auto *path : paths) {
+      const auto *value = std::get_if<Step>(&(*path)[depth]);
+      if (value != nullptr && *value == step)
+        selected.push_back(path);
+    }
+    return selected;
+  }
+
+  bool write_compound(const Compound &compound, std::span<const StreamChar> raw,
+                      const std::vector<const Path *> &paths,
+                      std::size_t depth) {
+    std::vector<RawTag> entries;
+    if (!read_entries(raw, entries))
+      return false;
+    for (const auto &[name, entry] : compound) {
+      RawPayload entry_raw;
+      for (const auto &raw_entry : entries)
+        if (raw_entry.name == name) {
+          if (raw_entry.tag == entry.tag())
+            entry_raw = raw_entry.payload;
+          break;
+        }
+      put(out_, static_cast<TagID_t>(entry.tag()));
+      put_string(out_, name);
+      const std::string_view key{name};
+      if (!write(entry, entry_raw, select<std::string>(paths, depth, key),
+                 depth + 1))
+        return false;
+    }
+    put(out_, static_cast<TagID_t>(Tags::END));
+    return true;
+  }
+
+  bool write_list(const List &list, std::span<const StreamChar> raw,
+                  const std::vector<const Path *> &paths, std::size_t depth) {
+    RawList elements;
+    if (!read_elements(raw, elements))
+      return false;
+    const auto elem_tag = list.empty() ? list.elem_tag : list.front().tag();
+    put(out_, static_cast<TagID_t>(elem_tag));
+    put(out_, static_cast<int32_t>(list.size()));
+    for (std::size_t i = 0; i < list.size(); i++) {
+      RawPayload elem_raw;
+      if (elements.elem_tag == list[i].tag() && i < elements.elements.size())
+        elem_raw = elements.elements[i];
+      if (!write(list[i], elem_raw,
+                 select<uint32_t>(paths, depth, static_cast<uint32_t>(i)),
+                 depth + 1))
+        return false;
+    }
+    return true;
+  }
+
+  std::vector<StreamChar> &out_;
+};
+
+} // namespace
+
+std::optional<std::vector<StreamChar>>
+serialize_modified(const Tag &root, std::span<const StreamChar> original,
+                   std::span<const Path> modified) {
+  const auto raw_root = read_named(original);
+  if (!raw_root)
+    return std::nullopt;
+  std::vector<const Path *> paths;
+  for (const auto &path : modified)
+    paths.push_back(&path);
+
+  std::vector<StreamChar> out;
+  out.reserve(original.size());
+  put(out, static_cast<TagID_t>(root.tag()));
+  put_string(out, raw_root->name);
+  RawPayload raw;
+  if (raw_root->tag == root.tag())
+    raw = raw_root->payload;
+  if (!ModifiedWriter{out}.write(root, raw, paths, 0))
+    return std::nullopt;
+  return out;
+}
+
+} // namespace minecraft::nbt
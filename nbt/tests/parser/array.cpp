@@ -0,0 +1,97 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Unittests for NBT arrays byte parsing.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/list.hpp"
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <vector>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// clang-format off
+// Int array of 3 elements, followed by an empty one
+static constexpr UC INT_ARRAYS[]{
+    0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01,
+    0xff, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00};
+// clang-format on
+static const std::vector<int32_t> FIRST{1, -2, 0x7fffffff};
+
+// ============================================================================
+TEST_CASE("BytesParser<NBT::IntArray>") {
+  BytesParser<std::vector<int32_t>> parser;
+  auto *p = static_cast<const StreamChar *>(INT_ARRAYS);
+  unsigned long n = sizeof(INT_ARRAYS);
+
+  SUBCASE("[INT_ARRAYS] Normal case") {
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    REQUIRE(parser.get() != nullptr);
+    CHECK_EQ(*parser.get(), FIRST);
+    CHECK_EQ(n, 4);
+
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    REQUIRE(parser.get() != nullptr);
+    CHECK(parser.get()->empty());
+    CHECK_EQ(n, 0);
+  }
+  SUBCASE("[INT_ARRAYS] Byte-per-byte feeding") {
+    for (std::size_t i = 0; i < 15; i++) {
+      unsigned long one = 1;
+      CHECK_EQ(parser.parse(p, one), ParseResult::UNFINISHED);
+      CHECK_EQ(parser.get(), nullptr);
+    }
+    unsigned long one = 1;
+    CHECK_EQ(parser.parse(p, one), ParseResult::SUCCESS);
+    REQUIRE(parser.get() != nullptr);
+    CHECK_EQ(*parser.get(), FIRST);
+  }
+  SUBCASE("[INT_ARRAYS] Capacity kept between parsings") {
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    const auto *buffer = parser.get()->data();
+
+    p = static_cast<const StreamChar *>(INT_ARRAYS);
+    n = sizeof(INT_ARRAYS);
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    CHECK_EQ(parser.get()->data(), buffer);
+  }
+  SUBCASE("[INT_ARRAYS] Move out") {
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    const auto *buffer = parser.get()->data();
+
+    const auto value = parser.take();
+    CHECK_EQ(value, FIRST);
+    CHECK_EQ(value.data(), buffer);
+    CHECK_EQ(parser.get(), nullptr);
+
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    REQUIRE(parser.get() != nullptr);
+    CHECK(parser.get()->empty());
+  }
+  SUBCASE("[INT_ARRAYS] Buffers swap") {
+    std::vector<int32_t> dest;
+    dest.reserve(16);
+    const auto *dest_buffer = dest.data();
+
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    parser.take(dest);
+    CHECK_EQ(dest, FIRST);
+
+    // The parser now fills the former buffer of dest
+    p = static_cast<const StreamChar *>(INT_ARRAYS);
+    n = sizeof(INT_ARRAYS);
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    CHECK_EQ(parser.get()->data(), dest_buffer);
+  }
+}
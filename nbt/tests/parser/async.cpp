@@ -0,0 +1,142 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Unittests for the coroutine-based asynchronous parsing.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/async.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <span>
+#include <vector>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// clang-format off
+// "hello world" document of the NBT specification, uncompressed
+static constexpr UC HELLO_WORLD[]{
+    0x0a, 0x00, 0x0b, 'h',  'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l',
+    'd',  0x08, 0x00, 0x04, 'n', 'a', 'm', 'e', 0x00, 0x09, 'B', 'a', 'n',
+    'a',  'n',  'r',  'a',  'm', 'a', 0x00};
+
+// Same document, zlib-compressed
+static constexpr UC HELLO_WORLD_ZLIB[]{
+    0x78, 0xda, 0xe3, 0x62, 0xe0, 0xce, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28,
+    0xcf, 0x2f, 0xca, 0x49, 0xe1, 0x60, 0x60, 0xc9, 0x4b, 0xcc, 0x4d, 0x65,
+    0xe0, 0x74, 0x4a, 0xcc, 0x4b, 0xcc, 0x2b, 0x4a, 0xcc, 0x4d, 0x64, 0x00,
+    0x00, 0x9c, 0xe8, 0x09, 0xa9};
+// clang-format on
+
+static void check_hello_world(const std::optional<Tag> &root) {
+  REQUIRE(root.has_value());
+  const auto &compound = root->as<Compound>();
+  REQUIRE(compound.contains("name"));
+  CHECK(compound.at("name").as<SmallString>() == "Bananrama");
+}
+
+/**
+ * @brief Parse every document of a source, one after the other
+ */
+template <ByteSource S> static Task<int> parse_all(S &source) {
+  Reader reader;
+  int n = 0;
+  while (auto root = co_await async_parse(source, reader)) {
+    check_hello_world(root);
+    n++;
+  }
+  co_return n;
+}
+
+// ============================================================================
+TEST_CASE("Async parsing") {
+  SUBCASE("[HELLO_WORLD] Memory source") {
+    MemorySource source{HELLO_WORLD};
+    auto task = async_parse(source);
+    task.start();
+    REQUIRE(task.done());
+    check_hello_world(task.result());
+  }
+
+  SUBCASE("[HELLO_WORLD_ZLIB] Memory source by chunks") {
+    for (std::size_t chunk : {1, 2, 7, 64}) {
+      MemorySource source{HELLO_WORLD_ZLIB, chunk};
+      auto task = async_parse(source);
+      task.start();
+      REQUIRE(task.done());
+      check_hello_world(task.result());
+    }
+  }
+
+  SUBCASE("[HELLO_WORLD] Push source") {
+    PushSource source;
+    auto task = async_parse(source);
+    task.start();
+    const std::span<const UC> bytes{HELLO_WORLD};
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+      CHECK_FALSE(task.done());
+      source.push(bytes.subspan(i, 1));
+    }
+    REQUIRE(task.done());
+    check_hello_world(task.result());
+    CHECK(source.available() == 0);
+  }
+
+  SUBCASE("[MULTIPLE_DOCS] Consecutive documents") {
+    std::vector<UC> stream;
+    for (int i = 0; i < 3; i++) {
+      stream.insert(stream.end(), std::begin(HELLO_WORLD),
+                    std::end(HELLO_WORLD));
+      stream.insert(stream.end(), std::begin(HELLO_WORLD_ZLIB),
+                    std::end(HELLO_WORLD_ZLIB));
+    }
+    PushSource source;
+    auto task = parse_all(source);
+    task.start();
+    source.push({stream.data(), 50});
+    source.push(std::span{stream}.subspan(50));
+    CHECK_FALSE(task.done());
+    source.close();
+    REQUIRE(task.done());
+    CHECK(task.result() == 6);
+  }
+
+  SUBCASE("[HELLO_WORLD] Stream ending in a document") {
+    PushSource source;
+    auto task = async_parse(source);
+    task.start();
+    source.push({HELLO_WORLD, 10});
+    source.close();
+    REQUIRE(task.done());
+    CHECK_FALSE(task.result().has_value());
+  }
+
+  SUBCASE("[HELLO_WORLD] Concurrent streams") {
+    constexpr std::size_t N_STREAMS{256};
+    std::vector<PushSource> sources(N_STREAMS);
+    std::vector<Task<std::optional<Tag>>> tasks;
+    tasks.reserve(N_STREAMS);
+    for (auto &source : sources) {
+      tasks.push_back(async_parse(source));
+      tasks.back().start();
+    }
+    // Interleave the bytes of every stream
+    const std::span<const UC> bytes{HELLO_WORLD};
+    for (std::size_t i = 0; i < bytes.size(); i += 3) {
+      const auto n = std::min<std::size_t>(3, bytes.size() - i);
+      for (auto &source : sources)
+        source.push(bytes.subspan(i, n));
+    }
+    for (auto &task : tasks) {
+      REQUIRE(task.done());
+      check_hello_world(task.result());
+    }
+  }
+}
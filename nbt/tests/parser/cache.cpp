@@ -0,0 +1,336 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Unittests for the caches of decoded and compressed chunks.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/cache.hpp"
+#include "minecraft/nbt/lz4.hpp"
+#include "minecraft/nbt/reader.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <atomic>
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace minecraft::nbt;
+namespace fs = std::filesystem;
+
+/**
+ * @brief Loader of generated chunks (a long array of ~8 KB), counting its
+ * calls
+ */
+struct FakeLoader {
+  std::atomic<int> *calls;
+
+  std::optional<Tag> operator()(const ChunkKey &key,
+                                std::pmr::memory_resource *resource) const {
+    (*calls)++;
+    if (key.dimension != 0)
+      return std::nullopt;
+    Tag root{Compound{resource}};
+    auto &compound = root.as<Compound>();
+    compound.emplace("xPos", Tag{key.x});
+    compound.emplace("zPos", Tag{key.z});
+    compound.emplace("data", Tag{std::pmr::vector<int64_t>(1024, resource)});
+    return root;
+  }
+};
+
+// ============================================================================
+TEST_CASE("ChunkCache hits and misses") {
+  std::atomic<int> calls{0};
+  ChunkCache cache{FakeLoader{&calls}, {.budget = 1 << 20, .n_shards = 4}};
+
+  const auto a = cache.get({0, 1, 2});
+  REQUIRE(a != nullptr);
+  CHECK(a->as<Compound>().at("xPos").as<int32_t>() == 1);
+  CHECK(cache.get({0, 1, 2}) == a);
+  CHECK(cache.find({0, 1, 2}) == a);
+  CHECK(cache.find({0, 2, 2}) == nullptr);
+  CHECK(calls == 1);
+
+  // Missing chunks are not cached
+  CHECK(cache.get({1, 0, 0}) == nullptr);
+  CHECK(cache.get({1, 0, 0}) == nullptr);
+  CHECK(calls == 3);
+
+  auto stats = cache.get_stats();
+  CHECK(stats.hits == 2);
+  CHECK(stats.misses == 3);
+  CHECK(stats.entries == 1);
+  // The arena of the chunk holds at least its long array
+  CHECK(stats.bytes > 1024 * sizeof(int64_t));
+  CHECK(stats.bytes < 4 * 1024 * sizeof(int64_t));
+
+  CHECK(cache.erase({0, 1, 2}));
+  CHECK_FALSE(cache.erase({0, 1, 2}));
+  CHECK(cache.get_stats().bytes == 0);
+  // Still usable after its eviction
+  CHECK(a->as<Compound>().at("zPos").as<int32_t>() == 2);
+  CHECK(cache.get({0, 1, 2}) != a);
+}
+
+TEST_CASE("ChunkCache eviction") {
+  std::atomic<int> calls{0};
+  ChunkCache cache{FakeLoader{&calls}, {.budget = 256 << 10, .n_shards = 1}};
+
+  // The spawn chunk is used between each load
+  const ChunkKey spawn{0, 0, 0};
+  for (int i = 1; i <= 200; i++) {
+    CHECK(cache.get(spawn) != nullptr);
+    CHECK(cache.get({0, i, 0}) != nullptr);
+    CHECK(cache.get_stats().bytes <= 256 << 10);
+  }
+  const auto stats = cache.get_stats();
+  CHECK(stats.evictions > 0);
+  CHECK(stats.entries == stats.misses - stats.evictions);
+  // Never evicted
+  CHECK(stats.misses == 201);
+  CHECK(cache.find(spawn) != nullptr);
+  CHECK(cache.find({0, 1, 0}) == nullptr);
+  CHECK(cache.find({0, 200, 0}) != nullptr);
+
+  cache.clear();
+  CHECK(cache.get_stats().entries == 0);
+  CHECK(cache.get_stats().bytes == 0);
+}
+
+TEST_CASE("ChunkCache concurrent lookups") {
+  std::atomic<int> calls{0};
+  ChunkCache cache{FakeLoader{&calls}, {.budget = 512 << 10}};
+  std::atomic<int> failures{0};
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < 8; t++)
+      threads.emplace_back([&cache, &failures, t]() {
+        for (int i = 0; i < 2000; i++) {
+          const ChunkKey key{0, (i * 7 + t) % 64, i % 3};
+          const auto chunk = cache.get(key);
+          if (chunk == nullptr ||
+              chunk->as<Compound>().at("xPos").as<int32_t>() != key.x)
+            failures++;
+        }
+      });
+  }
+  CHECK(failures == 0);
+  const auto stats = cache.get_stats();
+  CHECK(stats.hits + stats.misses == 8 * 2000);
+  CHECK(stats.bytes <= 512 << 10);
+}
+
+TEST_CASE("ChunkCache over region files") {
+  std::string_view path;
+  for (const auto &corpus : CORPUS)
+    if (corpus.kind == "region")
+      path = corpus.path;
+  REQUIRE_FALSE(path.empty());
+
+  // Region file named after the coordinates of its chunks
+  auto region = RegionFile::open(std::string{path});
+  REQUIRE(region.has_value());
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < REGION_CHUNKS; i++)
+    if (region->contains(i))
+      indices.push_back(i);
+  REQUIRE(indices.size() > 1);
+  Reader reader;
+  std::vector<StreamChar> buffer;
+  const auto root = region->parse_chunk(indices[0], reader, buffer);
+  const auto other = region->parse_chunk(indices[1], reader, buffer);
+  REQUIRE(root.has_value());
+  REQUIRE(other.has_value());
+  const auto x = root->as<Compound>().at("xPos").as<int32_t>();
+  const auto z = root->as<Compound>().at("zPos").as<int32_t>();
+  const ChunkKey other_key{0, other->as<Compound>().at("xPos").as<int32_t>(),
+                           other->as<Compound>().at("zPos").as<int32_t>()};
+
+  const auto dir = fs::temp_directory_path() / "solismc_nbt_cache_test";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  fs::copy_file(path, dir / ("r." + std::to_string(x >> 5) + "." +
+                             std::to_string(z >> 5) + ".mca"));
+  {
+    RegionLoader loader{{dir}, 1};
+    ChunkCache cache{std::ref(loader)};
+    const auto chunk = cache.get({0, x, z});
+    REQUIRE(chunk != nullptr);
+    CHECK(*chunk == *root);
+    CHECK(cache.get({0, x, z}) == chunk);
+    CHECK(cache.get({1, x, z}) == nullptr);
+    // Missing region, closing the other one (reopened on the next miss)
+    CHECK(cache.get({0, x + 32, z}) == nullptr);
+    const auto next = cache.get(other_key);
+    REQUIRE(next != nullptr);
+    CHECK(*next == *other);
+  }
+
+  // Chunks of the other compressions are decoded by their backend
+  const auto file = dir / ("r." + std::to_string(x >> 5) + "." +
+                           std::to_string(z >> 5) + ".mca");
+  REQUIRE(transcode_region(file, file, ChunkCompression::LZ4).has_value());
+  {
+    RegionLoader loader{{dir}, 1};
+    ChunkCache cache{std::ref(loader)};
+    const auto chunk = cache.get({0, x, z});
+    REQUIRE(chunk != nullptr);
+    CHECK(*chunk == *root);
+  }
+  fs::remove_all(dir);
+}
+
+// ============================================================================
+TEST_CASE("LZ4 block round trip") {
+  const auto round_trip = [](const std::vector<StreamChar> &input) {
+    std::vector<StreamChar> block;
+    lz4_compress(input, block);
+    CHECK(block.size() <= lz4_bound(input.size()));
+    std::vector<StreamChar> output(input.size());
+    CHECK(lz4_decompress(block, output));
+    CHECK(output == input);
+    return block.size();
+  };
+
+  CHECK(round_trip({}) == 1);
+  round_trip({42});
+  round_trip(std::vector<StreamChar>(13, 7));
+  CHECK(round_trip(std::vector<StreamChar>(1 << 20, 0)) < 8 << 10);
+  std::mt19937 random{39};
+  std::vector<StreamChar> noise(100000);
+  for (auto &byte : noise)
+    byte = static_cast<StreamChar>(random());
+  round_trip(noise);
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    const auto root = parse_file(std::string{corpus.path});
+    REQUIRE(root.has_value());
+    const auto document = serialize(*root);
+    CHECK(round_trip(document) < document.size());
+  }
+
+  // Invalid blocks
+  std::vector<StreamChar> block;
+  lz4_compress(std::vector<StreamChar>(1000, 1), block);
+  std::vector<StreamChar> output(1000);
+  CHECK_FALSE(lz4_decompress({block.data(), block.size() - 1}, output));
+  output.resize(999);
+  CHECK_FALSE(lz4_decompress(block, output));
+  output.resize(1001);
+  CHECK_FALSE(lz4_decompress(block, output));
+  // Match before the start of the output
+  const std::vector<StreamChar> bad{0x10, 'a', 0x02, 0x00, 0x00};
+  output.resize(10);
+  CHECK_FALSE(lz4_decompress(bad, output));
+}
+
+TEST_CASE("CompressedTier put and get") {
+  std::string_view path;
+  for (const auto &corpus : CORPUS)
+    if (corpus.kind == "chunk")
+      path = corpus.path;
+  REQUIRE_FALSE(path.empty());
+  const auto root = parse_file(std::string{path});
+  REQUIRE(root.has_value());
+
+  CompressedTier tier{{.budget = 16 << 20, .n_shards = 2}};
+  CHECK_FALSE(tier.get({0, 0, 0}).has_value());
+  tier.put({0, 0, 0}, *root);
+  tier.put({0, 1, 0}, serialize(*root));
+  const auto a = tier.get({0, 0, 0});
+  const auto b = tier.get({0, 1, 0});
+  REQUIRE(a.has_value());
+  REQUIRE(b.has_value());
+  CHECK(*a == *root);
+  CHECK(*b == *root);
+
+  // Replaced
+  tier.put({0, 0, 0}, Tag{Compound{}});
+  CHECK(tier.get({0, 0, 0})->as<Compound>().empty());
+
+  auto stats = tier.get_stats();
+  CHECK(stats.hits == 3);
+  CHECK(stats.misses == 1);
+  CHECK(stats.hit_rate() == 0.75);
+  CHECK(stats.entries == 2);
+  CHECK(stats.raw_bytes == serialize(*root).size() + 4);
+  CHECK(stats.ratio() > 1.0);
+
+  CHECK(tier.erase({0, 1, 0}));
+  CHECK_FALSE(tier.erase({0, 1, 0}));
+  CHECK_FALSE(tier.get({0, 1, 0}).has_value());
+  tier.clear();
+  stats = tier.get_stats();
+  CHECK(stats.entries == 0);
+  CHECK(stats.bytes == 0);
+  CHECK(stats.raw_bytes == 0);
+}
+
+TEST_CASE("CompressedTier eviction") {
+  CompressedTier tier{{.budget = 64 << 10, .n_shards = 1}};
+  std::mt19937 random{38};
+  const auto make_chunk = [&random](int x) {
+    Tag root{Compound{}};
+    std::vector<int64_t> data(256);
+    for (auto &value : data)
+      value = static_cast<int64_t>(random());
+    root.as<Compound>().emplace("xPos", Tag{x});
+    root.as<Compound>().emplace(
+        "data", Tag{std::pmr::vector<int64_t>(data.begin(), data.end())});
+    return root;
+  };
+
+  const ChunkKey spawn{0, 0, 0};
+  tier.put(spawn, make_chunk(0));
+  for (int i = 1; i <= 100; i++) {
+    CHECK(tier.get(spawn).has_value());
+    tier.put({0, i, 0}, make_chunk(i));
+    CHECK(tier.get_stats().bytes <= 64 << 10);
+  }
+  const auto stats = tier.get_stats();
+  CHECK(stats.evictions > 0);
+  CHECK(stats.entries == 101 - stats.evictions);
+  CHECK(tier.get(spawn).has_value());
+  CHECK_FALSE(tier.get({0, 1, 0}).has_value());
+  CHECK(tier.get({0, 100, 0})->as<Compound>().at("xPos").as<int32_t>() ==
+        100);
+}
+
+TEST_CASE("ChunkCache over a CompressedTier") {
+  std::atomic<int> calls{0};
+  CompressedTier tier;
+  ChunkCache cache{tier.over(FakeLoader{&calls}),
+                   {.budget = 64 << 10,
+                    .n_shards = 1,
+                    .on_evict = [&tier](const ChunkKey &key,
+                                        const Tag &chunk) {
+                      tier.put(key, chunk);
+                    }}};
+
+  // Walking back and forth across the same chunks
+  for (int pass = 0; pass < 3; pass++)
+    for (int i = 0; i < 32; i++) {
+      const auto chunk = cache.get({0, i, 0});
+      REQUIRE(chunk != nullptr);
+      CHECK(chunk->as<Compound>().at("xPos").as<int32_t>() == i);
+    }
+  // Only loaded once, then reloaded from the tier
+  CHECK(calls == 32);
+  const auto cache_stats = cache.get_stats();
+  const auto tier_stats = tier.get_stats();
+  CHECK(cache_stats.evictions > 0);
+  CHECK(tier_stats.entries + cache_stats.entries >= 32);
+  CHECK(tier_stats.hits == cache_stats.misses - 32);
+  // Zero-filled long arrays
+  CHECK(tier_stats.ratio() > 10.0);
+}
@@ -0,0 +1,100 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Compounds stored in insertion order, with their name index.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Check that every entry is found at its position
+ */
+static void check_lookups(const Compound &compound) {
+  for (auto it = compound.begin(); it != compound.end(); ++it)
+    CHECK(compound.find(it->first) == it);
+  CHECK(compound.find("missing") == compound.end());
+}
+
+// ============================================================================
+TEST_CASE("Compound entries") {
+  // Both sides of the index threshold
+  constexpr auto THRESHOLD = Compound::INDEX_THRESHOLD;
+  for (const std::size_t n : {std::size_t{3}, THRESHOLD, THRESHOLD + 1,
+                              std::size_t{200}}) {
+    CAPTURE(n);
+    Compound compound;
+    for (std::size_t i = 0; i < n; i++) {
+      const auto name = "entry_" + std::to_string(n - i);
+      CHECK(compound.try_emplace(name, Tag{int32_t(i)}).second);
+      CHECK_FALSE(compound.try_emplace(name, Tag{int32_t(-1)}).second);
+    }
+    REQUIRE(compound.size() == n);
+
+    // Insertion order, not name order
+    for (std::size_t i = 0; i < n; i++)
+      CHECK((compound.begin() + i)->second == Tag{int32_t(i)});
+    check_lookups(compound);
+    CHECK(compound.at("entry_1") == Tag{int32_t(n - 1)});
+    CHECK_THROWS(compound.at("missing"));
+
+    CHECK_FALSE(compound.insert_or_assign("entry_1", Tag{int8_t{7}}).second);
+    CHECK(compound.at("entry_1") == Tag{int8_t{7}});
+    compound["added"] = Tag{int16_t{1}};
+    CHECK((compound.end() - 1)->first == "added");
+
+    // The order is kept by erasures and renames
+    CHECK(compound.erase("entry_" + std::to_string(n)) == 1);
+    CHECK(compound.erase("missing") == 0);
+    CHECK(compound.begin()->second == Tag{int32_t{1}});
+    CHECK(compound.rename(compound.find("added"), "renamed"));
+    CHECK_FALSE(compound.rename(compound.find("renamed"), "entry_1"));
+    CHECK((compound.end() - 1)->first == "renamed");
+    CHECK_FALSE(compound.contains("added"));
+    check_lookups(compound);
+
+    // Same entries in another order
+    Compound reversed;
+    for (auto it = compound.end(); it != compound.begin();) {
+      --it;
+      reversed.insert_or_assign(it->first, it->second);
+    }
+    CHECK(reversed == compound);
+    reversed.begin()->second = Tag{};
+    CHECK_FALSE(reversed == compound);
+  }
+}
+
+TEST_CASE("Compounds written back byte for byte") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const auto bytes = read_file(corpus.path);
+    BytesParser<Tag> parser;
+    const StreamChar *strm = bytes.data();
+    unsigned long N = bytes.size();
+    REQUIRE(parser.parse(strm, N) == ParseResult::SUCCESS);
+    CHECK(serialize(*parser.get(), parser.get_name()) == bytes);
+  }
+}
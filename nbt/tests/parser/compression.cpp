@@ -0,0 +1,187 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Compressions of the chunks: LZ4 block streams, backends and transcoding of
+// regions.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/lz4.hpp"
+#include "minecraft/nbt/region.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+namespace fs = std::filesystem;
+
+static std::string_view find_corpus(std::string_view kind) {
+  for (const auto &corpus : CORPUS)
+    if (corpus.kind == kind)
+      return corpus.path;
+  return {};
+}
+
+/**
+ * @brief Bytes alternating compressible runs and random noise
+ */
+static std::vector<StreamChar> make_bytes(std::size_t size) {
+  std::mt19937 rng{42};
+  std::vector<StreamChar> bytes(size);
+  for (std::size_t i = 0; i < size; i++)
+    bytes[i] = (i / 1000) % 2 ? static_cast<StreamChar>(rng())
+                              : static_cast<StreamChar>(i % 7);
+  return bytes;
+}
+
+/**
+ * @brief Trees of the chunks of a region
+ */
+static std::vector<std::optional<Tag>> read_chunks(const fs::path &path) {
+  std::vector<std::optional<Tag>> chunks(REGION_CHUNKS);
+  auto region = RegionFile::open(path);
+  REQUIRE(region.has_value());
+  Reader reader;
+  std::vector<StreamChar> buffer;
+  for (std::size_t i = 0; i < REGION_CHUNKS; i++)
+    chunks[i] = region->parse_chunk(i, reader, buffer);
+  return chunks;
+}
+
+// ============================================================================
+TEST_CASE("LZ4 block streams") {
+  std::vector<StreamChar> stream, out;
+
+  SUBCASE("Empty") {
+    lz4_stream_compress({}, stream);
+    CHECK(stream.size() == 21);
+    CHECK(lz4_stream_decompress(stream, out));
+    CHECK(out.empty());
+  }
+
+  SUBCASE("Round trip") {
+    for (std::size_t size : {1, 100, 65536, 200000}) {
+      CAPTURE(size);
+      const auto bytes = make_bytes(size);
+      lz4_stream_compress(bytes, stream);
+      REQUIRE(lz4_stream_decompress(stream, out));
+      CHECK(out == bytes);
+      // Smaller blocks
+      lz4_stream_compress(bytes, stream, 1024);
+      REQUIRE(lz4_stream_decompress(stream, out));
+      CHECK(out == bytes);
+    }
+  }
+
+  SUBCASE("Invalid streams") {
+    const auto bytes = make_bytes(10000);
+    lz4_stream_compress(bytes, stream);
+    // Truncated, without its end block
+    CHECK_FALSE(lz4_stream_decompress(
+        std::span<const StreamChar>{stream}.first(stream.size() - 21), out));
+    // Corrupted checksum
+    auto corrupted = stream;
+    corrupted[17] ^= 1;
+    CHECK_FALSE(lz4_stream_decompress(corrupted, out));
+    // Bad magic
+    corrupted = stream;
+    corrupted[0] = 'X';
+    CHECK_FALSE(lz4_stream_decompress(corrupted, out));
+  }
+}
+
+TEST_CASE("Chunk codecs") {
+  const auto bytes = make_bytes(5000);
+  std::vector<StreamChar> payload, document;
+  for (auto compression : {ChunkCompression::GZIP, ChunkCompression::ZLIB,
+                           ChunkCompression::NONE, ChunkCompression::LZ4}) {
+    CAPTURE(static_cast<int>(compression));
+    REQUIRE(compress_chunk(bytes, compression, 6, payload));
+    const ChunkData chunk{
+        .compression = compression, .external = false, .bytes = payload};
+    REQUIRE(decompress_chunk(chunk, document));
+    CHECK(document == bytes);
+  }
+
+  // Unknown compression
+  const auto custom = static_cast<ChunkCompression>(42);
+  CHECK(get_chunk_codec(custom).decompress == nullptr);
+  CHECK_FALSE(compress_chunk(bytes, custom, 6, payload));
+}
+
+TEST_CASE("transcode_region") {
+  const auto path = find_corpus("region");
+  REQUIRE_FALSE(path.empty());
+  const auto dir = fs::temp_directory_path() / "solismc_nbt_transcode_test";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  const auto file = dir / "r.0.0.mca";
+  const auto original = read_chunks(path);
+  const auto n_chunks = RegionFile::open(path)->size();
+
+  for (auto compression : {ChunkCompression::LZ4, ChunkCompression::NONE,
+                           ChunkCompression::GZIP, ChunkCompression::ZLIB}) {
+    CAPTURE(static_cast<int>(compression));
+    const auto stats = transcode_region(path, file, compression);
+    REQUIRE(stats.has_value());
+    CHECK(stats->recompressed + stats->copied == n_chunks);
+    CHECK(stats->encoded == 0);
+
+    auto region = RegionFile::open(file);
+    REQUIRE(region.has_value());
+    CHECK(region->size() == n_chunks);
+    std::vector<StreamChar> buffer;
+    for (std::size_t i = 0; i < REGION_CHUNKS; i++)
+      if (region->contains(i))
+        CHECK(region->read_chunk(i, buffer)->compression == compression);
+    CHECK(read_chunks(file) == original);
+  }
+
+  // Already in the compression: copied verbatim
+  const auto stats = transcode_region(file, file, ChunkCompression::ZLIB);
+  REQUIRE(stats.has_value());
+  CHECK(stats->copied == n_chunks);
+  CHECK(stats->recompressed == 0);
+
+  SUBCASE("Custom codec") {
+    // Uncompressed payload with every byte inverted
+    const auto custom = static_cast<ChunkCompression>(42);
+    const auto invert = [](std::span<const StreamChar> from,
+                           std::vector<StreamChar> &to) {
+      to.resize(from.size());
+      for (std::size_t i = 0; i < from.size(); i++)
+        to[i] = static_cast<StreamChar>(~from[i]);
+      return true;
+    };
+    set_chunk_codec(custom,
+                    {.decompress = invert,
+                     .compress = [](std::span<const StreamChar> from, int,
+                                    std::vector<StreamChar> &to) {
+                       to.resize(from.size());
+                       for (std::size_t i = 0; i < from.size(); i++)
+                         to[i] = static_cast<StreamChar>(~from[i]);
+                       return true;
+                     }});
+    const auto transcoded = transcode_region(file, file, custom);
+    CHECK(transcoded.has_value());
+    CHECK(read_chunks(file) == original);
+    // Backends in use are kept when replaced
+    const auto &previous = get_chunk_codec(custom);
+    set_chunk_codec(custom, {});
+    CHECK(previous.decompress != nullptr);
+    CHECK(get_chunk_codec(custom).decompress == nullptr);
+    // Unreadable once its backend is removed
+    CHECK(RegionFile::open(file)->size() == n_chunks);
+    CHECK_FALSE(transcode_region(file, file, ChunkCompression::ZLIB));
+  }
+
+  fs::remove_all(dir);
+}
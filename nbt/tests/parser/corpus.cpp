@@ -0,0 +1,163 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Parsing of the generated NBT corpora.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/region.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <array>
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+namespace fs = std::filesystem;
+
+/**
+ * @brief Count the tags of the tree, the given one included
+ */
+static std::size_t count_tags(const Tag &tag) {
+  std::size_t n = 1;
+  if (const auto *list = tag.as_ptr<List>())
+    for (const auto &elem : *list)
+      n += count_tags(elem);
+  else if (const auto *compound = tag.as_ptr<Compound>())
+    for (const auto &[_, value] : *compound)
+      n += count_tags(value);
+  return n;
+}
+
+/**
+ * @brief Write a region of the given documents (chunks 0, 1...)
+ */
+static void write_region(const fs::path &path,
+                         const std::vector<std::vector<StreamChar>> &docs) {
+  std::vector<StreamChar> file(2 * REGION_SECTOR_SIZE);
+  std::vector<StreamChar> payload;
+  for (std::size_t i = 0; i < docs.size(); i++) {
+    REQUIRE(compress_chunk(docs[i], ChunkCompression::ZLIB, 1, payload));
+    const auto sector = file.size() / REGION_SECTOR_SIZE;
+    const auto length = static_cast<uint32_t>(payload.size() + 1);
+    const auto n_sectors =
+        (length + 4 + REGION_SECTOR_SIZE - 1) / REGION_SECTOR_SIZE;
+    REQUIRE(n_sectors < 256);
+    file[4 * i] = static_cast<StreamChar>(sector >> 16);
+    file[4 * i + 1] = static_cast<StreamChar>(sector >> 8);
+    file[4 * i + 2] = static_cast<StreamChar>(sector);
+    file[4 * i + 3] = static_cast<StreamChar>(n_sectors);
+    file.insert(file.end(), {static_cast<StreamChar>(length >> 24),
+                             static_cast<StreamChar>(length >> 16),
+                             static_cast<StreamChar>(length >> 8),
+                             static_cast<StreamChar>(length),
+                             static_cast<StreamChar>(ChunkCompression::ZLIB)});
+    file.insert(file.end(), payload.begin(), payload.end());
+    file.resize((sector + n_sectors) * REGION_SECTOR_SIZE);
+  }
+  std::ofstream out{path, std::ios::binary | std::ios::trunc};
+  out.write(reinterpret_cast<const char *>(file.data()),
+            static_cast<std::streamsize>(file.size()));
+}
+
+// ============================================================================
+TEST_CASE("BytesParser<NBT::Tag> on generated corpora") {
+  BytesParser<Tag> parser;
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+
+    std::ifstream file{std::string{corpus.path}, std::ios::binary};
+    const std::vector<StreamChar> bytes{std::istreambuf_iterator<char>{file},
+                                        std::istreambuf_iterator<char>{}};
+    REQUIRE(bytes.size() == corpus.n_bytes);
+
+    const StreamChar *strm = bytes.data();
+    unsigned long N = bytes.size();
+    parser.reset();
+    CHECK(parser.parse(strm, N) == ParseResult::SUCCESS);
+    CHECK(N == 0);
+    REQUIRE(parser.get() != nullptr);
+    CHECK_EQ(count_tags(*parser.get()), corpus.n_tags);
+  }
+}
+
+TEST_CASE("RegionFile on generated corpora") {
+  Reader reader;
+  std::vector<StreamChar> buffer;
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind != "region")
+      continue;
+    CAPTURE(corpus.name);
+
+    auto region = RegionFile::open(std::string{corpus.path});
+    REQUIRE(region.has_value());
+    std::size_t n_tags = 0, n_chunks = 0;
+    for (std::size_t i = 0; i < REGION_CHUNKS; i++) {
+      if (!region->contains(i)) {
+        CHECK_FALSE(region->parse_chunk(i, reader, buffer).has_value());
+        continue;
+      }
+      const auto chunk = region->read_chunk(i, buffer);
+      REQUIRE(chunk.has_value());
+      CHECK(chunk->compression == ChunkCompression::ZLIB);
+      CHECK_FALSE(chunk->external);
+
+      const auto root = region->parse_chunk(i, reader, buffer);
+      REQUIRE(root.has_value());
+      const auto &compound = root->as<Compound>();
+      CHECK(chunk_index(compound.at("xPos").as<int32_t>(),
+                        compound.at("zPos").as<int32_t>()) == i);
+      n_tags += count_tags(*root);
+      n_chunks++;
+    }
+    CHECK(n_chunks == region->size());
+    CHECK_EQ(n_tags, corpus.n_tags);
+  }
+  CHECK_FALSE(RegionFile::open("missing.mca").has_value());
+}
+
+TEST_CASE("RegionFile failures in an arena") {
+  // Truncated chunk whose partial tree outgrows the arena buffer
+  List blocks;
+  blocks.elem_tag = Tags::Compound;
+  for (int i = 0; i < 100000; i++) {
+    Compound block;
+    block.insert_or_assign("name", Tag{SmallString{"stone"}});
+    blocks.push_back(Tag{std::move(block)});
+  }
+  Compound root;
+  root.insert_or_assign("blocks", Tag{std::move(blocks)});
+  auto truncated = serialize(Tag{std::move(root)});
+  truncated.resize(truncated.size() - 10);
+  Compound valid;
+  valid.insert_or_assign("xPos", Tag{int32_t{1}});
+  const auto path = fs::temp_directory_path() / "solismc_truncated.mca";
+  write_region(path, {truncated, serialize(Tag{std::move(valid)})});
+
+  // The arena is rewound between the chunks, as in nbt-scan
+  std::array<std::byte, 4096> arena_buffer;
+  std::pmr::monotonic_buffer_resource arena{arena_buffer.data(),
+                                            arena_buffer.size()};
+  Reader reader{&arena};
+  std::vector<StreamChar> buffer;
+  auto region = RegionFile::open(path);
+  REQUIRE(region.has_value());
+  CHECK_FALSE(region->parse_chunk(0, reader, buffer).has_value());
+  arena.release();
+  const auto chunk = region->parse_chunk(1, reader, buffer);
+  REQUIRE(chunk.has_value());
+  CHECK(chunk->as<Compound>().at("xPos") == Tag{int32_t{1}});
+  fs::remove(path);
+}
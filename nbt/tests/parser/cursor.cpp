@@ -0,0 +1,189 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Pull parsing of NBT documents with a cursor.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/cursor.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/raw.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// "hello world" document of the NBT specification
+static constexpr UC HELLO_WORLD[]{
+    0x0a, 0x00, 0x0b, 'h',  'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l',
+    'd',  0x08, 0x00, 0x04, 'n', 'a', 'm', 'e', 0x00, 0x09, 'B', 'a', 'n',
+    'a',  'n',  'r',  'a',  'm', 'a', 0x00};
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+template <typename T> static Tag read_array(const Token &token) {
+  std::pmr::vector<T> array;
+  for (std::size_t i = 0; i < token.size; i++)
+    array.push_back(token.at<T>(i));
+  return Tag{std::move(array)};
+}
+
+/**
+ * @brief Build the tree of the value of the given token
+ */
+static Tag build(Cursor &cursor, const Token &token) {
+  switch (token.tag) {
+  case Tags::Byte:
+    return Tag{token.get<int8_t>()};
+  case Tags::Short:
+    return Tag{token.get<int16_t>()};
+  case Tags::Int:
+    return Tag{token.get<int32_t>()};
+  case Tags::Long:
+    return Tag{token.get<int64_t>()};
+  case Tags::Float:
+    return Tag{token.get<float>()};
+  case Tags::Double:
+    return Tag{token.get<double>()};
+  case Tags::String:
+    return Tag{SmallString{token.get<std::string_view>()}};
+  case Tags::ByteArray:
+    return read_array<int8_t>(token);
+  case Tags::IntArray:
+    return read_array<int32_t>(token);
+  case Tags::LongArray:
+    return read_array<int64_t>(token);
+  case Tags::List: {
+    Tag list{List{}};
+    list.as<List>().elem_tag = token.elem_tag;
+    for (auto elem = cursor.next(); elem && elem->kind != TokenKind::END;
+         elem = cursor.next())
+      list.as<List>().push_back(build(cursor, *elem));
+    return list;
+  }
+  default: {
+    Tag compound{Compound{}};
+    for (auto entry = cursor.next(); entry && entry->kind != TokenKind::END;
+         entry = cursor.next())
+      compound.as<Compound>().insert_or_assign(SmallString{entry->name},
+                                               build(cursor, *entry));
+    return compound;
+  }
+  }
+}
+
+// ============================================================================
+TEST_CASE("Cursor on the hello world document") {
+  Cursor cursor{std::span<const StreamChar>{HELLO_WORLD}};
+  std::vector<Token> tokens;
+  for (const auto &token : cursor)
+    tokens.push_back(token);
+  CHECK_FALSE(cursor.failed());
+  REQUIRE(tokens.size() == 3);
+  CHECK(tokens[0].kind == TokenKind::BEGIN);
+  CHECK(tokens[0].tag == Tags::Compound);
+  CHECK(tokens[0].name == "hello world");
+  CHECK(tokens[1].kind == TokenKind::VALUE);
+  CHECK(tokens[1].name == "name");
+  CHECK(tokens[1].get<std::string_view>() == "Bananrama");
+  CHECK(tokens[2].kind == TokenKind::END);
+  CHECK(cursor.depth() == 0);
+  CHECK_FALSE(cursor.next().has_value());
+
+  // Truncated
+  Cursor truncated{std::span<const StreamChar>{HELLO_WORLD}.first(20)};
+  CHECK(truncated.next().has_value());
+  CHECK_FALSE(truncated.next().has_value());
+  CHECK(truncated.failed());
+}
+
+TEST_CASE("Cursor on generated corpora") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const auto bytes = read_file(corpus.path);
+
+    BytesParser<Tag> reference;
+    const StreamChar *strm = bytes.data();
+    unsigned long N = bytes.size();
+    REQUIRE(reference.parse(strm, N) == ParseResult::SUCCESS);
+
+    Cursor cursor{bytes};
+    const auto root = cursor.next();
+    REQUIRE(root.has_value());
+    CHECK(build(cursor, *root) == *reference.get());
+    CHECK_FALSE(cursor.failed());
+    CHECK_FALSE(cursor.next().has_value());
+
+    // Skipping the whole document
+    Cursor skipping{bytes};
+    REQUIRE(skipping.next().has_value());
+    const auto payload = skipping.skip_value();
+    REQUIRE(payload.has_value());
+    CHECK(payload->data() == read_named(bytes)->payload.data());
+    CHECK(payload->size() == read_named(bytes)->payload.size());
+    CHECK_FALSE(skipping.skip_value().has_value());
+    CHECK_FALSE(skipping.next().has_value());
+    CHECK_FALSE(skipping.failed());
+  }
+}
+
+TEST_CASE("Cursor skipping the subtrees") {
+  std::string_view path;
+  for (const auto &corpus : CORPUS)
+    if (corpus.kind == "chunk")
+      path = corpus.path;
+  REQUIRE_FALSE(path.empty());
+  const auto bytes = read_file(path);
+  std::vector<RawTag> entries;
+  REQUIRE(read_entries(read_named(bytes)->payload, entries));
+
+  // Typed loading of the chunk position, skipping everything else
+  Cursor cursor{bytes};
+  std::size_t n_entries = 0;
+  int32_t x = 0, z = 0;
+  for (const auto &token : cursor) {
+    // Depth of the entries of the root
+    const bool begin = token.kind == TokenKind::BEGIN;
+    if (cursor.depth() - begin != 1 || token.kind == TokenKind::END)
+      continue;
+    REQUIRE(n_entries < entries.size());
+    const auto &entry = entries[n_entries++];
+    CHECK(token.name == entry.name);
+    if (token.name == "xPos")
+      x = token.get<int32_t>();
+    else if (token.name == "zPos")
+      z = token.get<int32_t>();
+    else if (begin) {
+      const auto payload = cursor.skip_value();
+      REQUIRE(payload.has_value());
+      CHECK(payload->data() == entry.payload.data());
+      CHECK(payload->size() == entry.payload.size());
+      CHECK(cursor.depth() == 1);
+    }
+  }
+  CHECK_FALSE(cursor.failed());
+  CHECK(n_entries == entries.size());
+
+  BytesParser<Tag> reference;
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  REQUIRE(reference.parse(strm, N) == ParseResult::SUCCESS);
+  CHECK(x == reference.get()->as<Compound>().at("xPos").as<int32_t>());
+  CHECK(z == reference.get()->as<Compound>().at("zPos").as<int32_t>());
+}
@@ -0,0 +1,224 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Structural diff and patch of NBT documents.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/diff.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+
+static std::vector<StreamChar> read_corpus(std::string_view name) {
+  for (const auto &corpus : CORPUS)
+    if (corpus.name == name) {
+      std::ifstream file{std::string{corpus.path}, std::ios::binary};
+      return {std::istreambuf_iterator<char>{file},
+              std::istreambuf_iterator<char>{}};
+    }
+  return {};
+}
+
+static Tag parse(const std::vector<StreamChar> &bytes) {
+  BytesParser<Tag> parser;
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  REQUIRE(parser.parse(strm, N) == ParseResult::SUCCESS);
+  CHECK(N == 0);
+  return parser.take();
+}
+
+/**
+ * @brief Check that the diff of the documents turns the old tree into the new,
+ * written back byte for byte
+ */
+static Patch check_diff(const std::vector<StreamChar> &old_doc,
+                        const std::vector<StreamChar> &new_doc) {
+  const auto patch = diff(old_doc, new_doc);
+  REQUIRE(patch.has_value());
+  BytesParser<Tag> parser;
+  const StreamChar *strm = old_doc.data();
+  unsigned long N = old_doc.size();
+  REQUIRE(parser.parse(strm, N) == ParseResult::SUCCESS);
+  const std::string name =
+      patch->name.value_or(std::string{parser.get_name().view()});
+  Tag tree = parser.take();
+  CHECK(patch->apply(tree));
+  CHECK(tree == parse(new_doc));
+  CHECK(serialize(tree, name) == new_doc);
+
+  const auto decoded = Patch::decode(patch->encode());
+  REQUIRE(decoded.has_value());
+  CHECK(*decoded == *patch);
+  return *patch;
+}
+
+// ============================================================================
+TEST_CASE("Writer round-trip on generated corpora") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const auto bytes = read_corpus(corpus.name);
+    const Tag tree = parse(bytes);
+    // The entries of the compounds may be written in another order
+    const auto written = serialize(tree);
+    CHECK(written.size() == bytes.size());
+    CHECK(parse(written) == tree);
+  }
+}
+
+TEST_CASE("Diff of identical documents") {
+  const auto bytes = read_corpus("chunk_large_palette");
+  REQUIRE_FALSE(bytes.empty());
+  const auto patch = diff(bytes, bytes);
+  REQUIRE(patch.has_value());
+  CHECK(patch->empty());
+}
+
+TEST_CASE("Diff of a modified chunk") {
+  const auto old_doc = read_corpus("chunk_small_palette");
+  REQUIRE_FALSE(old_doc.empty());
+  const Tag old_tree = parse(old_doc);
+
+  SUBCASE("Scalar change") {
+    Tag tree = old_tree;
+    tree.as<Compound>().at("xPos") = Tag{int32_t{42}};
+    const auto patch = check_diff(old_doc, serialize(tree));
+    REQUIRE(patch.entries.size() == 1);
+    CHECK(patch.entries[0].op == PatchOp::SET);
+    CHECK(patch.entries[0].path == Path{"xPos"});
+  }
+
+  SUBCASE("Entries removed and added") {
+    Tag tree = old_tree;
+    auto &chunk = tree.as<Compound>();
+    chunk.erase(chunk.find("LastUpdate"));
+    chunk.insert_or_assign("Added", Tag{SmallString{"value"}});
+    const auto patch = check_diff(old_doc, serialize(tree));
+    CHECK(patch.entries.size() == 2);
+  }
+
+  SUBCASE("Entries added in the middle") {
+    Tag tree = old_tree;
+    auto &chunk = tree.as<Compound>();
+    REQUIRE(chunk.size() > 4);
+    chunk.erase(chunk.begin() + 2);
+    chunk.insert(chunk.begin(), {SmallString{"First"}, Tag{int8_t{1}}});
+    chunk.insert(chunk.begin() + 3, {SmallString{"Third"}, Tag{int8_t{3}}});
+    const auto patch = check_diff(old_doc, serialize(tree));
+    REQUIRE(patch.entries.size() == 3);
+    CHECK(patch.entries[1].offset == 0);
+    CHECK(patch.entries[2].offset == 3);
+  }
+
+  SUBCASE("Entries reordered") {
+    Tag tree = old_tree;
+    auto &chunk = tree.as<Compound>();
+    REQUIRE(chunk.size() > 1);
+    std::swap(chunk.begin()->second, (chunk.begin() + 1)->second);
+    const std::string first{chunk.begin()->first.view()};
+    const std::string second{(chunk.begin() + 1)->first.view()};
+    REQUIRE(chunk.rename(chunk.begin(), "swapped"));
+    REQUIRE(chunk.rename(chunk.begin() + 1, first));
+    REQUIRE(chunk.rename(chunk.begin(), second));
+    const auto patch = check_diff(old_doc, serialize(tree, "chunk"));
+    REQUIRE(patch.entries.size() == 1);
+    CHECK(patch.entries[0].path.empty());
+  }
+
+  SUBCASE("Array runs") {
+    Tag tree = old_tree;
+    auto &sections = tree.as<Compound>().at("sections").as<List>();
+    auto &data = sections[0]
+                     .as<Compound>()
+                     .at("block_states")
+                     .as<Compound>()
+                     .at("data")
+                     .as<std::pmr::vector<int64_t>>();
+    REQUIRE(data.size() > 40);
+    data[3] ^= 1;
+    data[5] ^= 1;  // Merged with the previous run
+    data[30] ^= 1; // Separate run
+    auto &light = sections[1].as<Compound>().at("BlockLight");
+    light.as<std::pmr::vector<int8_t>>().resize(1000);
+    const auto patch = check_diff(old_doc, serialize(tree));
+    REQUIRE(patch.entries.size() == 3);
+    for (const auto &entry : patch.entries)
+      CHECK(entry.op == PatchOp::SPLICE);
+    CHECK(patch.entries[0].length == 3);
+    CHECK(patch.entries[1].length == 1);
+  }
+
+  SUBCASE("List append and truncate") {
+    Tag tree = old_tree;
+    auto &sections = tree.as<Compound>().at("sections").as<List>();
+    const auto n = sections.size();
+    REQUIRE(n > 2);
+    sections.push_back(sections[0]);
+    auto patch = check_diff(old_doc, serialize(tree));
+    REQUIRE(patch.entries.size() == 1);
+    CHECK(patch.entries[0].path ==
+          Path{"sections", static_cast<uint32_t>(n)});
+
+    sections.resize(n - 2);
+    patch = check_diff(old_doc, serialize(tree));
+    REQUIRE(patch.entries.size() == 1);
+    CHECK(patch.entries[0].op == PatchOp::TRUNCATE);
+  }
+
+  SUBCASE("Nested string and root name") {
+    Tag tree = old_tree;
+    auto &sections = tree.as<Compound>().at("sections").as<List>();
+    auto &palette = sections[0]
+                        .as<Compound>()
+                        .at("block_states")
+                        .as<Compound>()
+                        .at("palette")
+                        .as<List>();
+    palette[0].as<Compound>().at("Name") =
+        Tag{SmallString{"minecraft:diamond_block"}};
+    const auto patch = check_diff(old_doc, serialize(tree, "renamed"));
+    REQUIRE(patch.name.has_value());
+    CHECK(*patch.name == "renamed");
+    REQUIRE(patch.entries.size() == 1);
+    CHECK(patch.entries[0].path ==
+          Path{"sections", 0u, "block_states", "palette", 0u, "Name"});
+  }
+
+  SUBCASE("Root type change") {
+    const auto patch = check_diff(old_doc, serialize(Tag{int32_t{1}}));
+    REQUIRE(patch.entries.size() == 1);
+    CHECK(patch.entries[0].path.empty());
+  }
+}
+
+TEST_CASE("Diff of invalid documents") {
+  const auto bytes = read_corpus("chunk_small_palette");
+  const std::vector<StreamChar> truncated{bytes.begin(), bytes.end() - 10};
+  CHECK_FALSE(diff(bytes, truncated).has_value());
+  CHECK_FALSE(diff({}, bytes).has_value());
+
+  // Patches not matching the tree
+  Tag tree = parse(bytes);
+  Patch patch;
+  patch.entries.push_back({.op = PatchOp::REMOVE, .path = {"missing"}});
+  CHECK_FALSE(patch.apply(tree));
+  CHECK_FALSE(Patch::decode(bytes).has_value());
+  auto encoded = Patch{}.encode();
+  encoded.push_back(0);
+  CHECK_FALSE(Patch::decode(encoded).has_value());
+}
@@ -0,0 +1,157 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Content hashing of NBT documents and trees.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/hash.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+static Tag parse(const std::vector<StreamChar> &bytes) {
+  BytesParser<Tag> parser;
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  REQUIRE(parser.parse(strm, N) == ParseResult::SUCCESS);
+  return parser.take();
+}
+
+static std::span<const StreamChar> as_bytes(std::string_view str) {
+  return {reinterpret_cast<const StreamChar *>(str.data()), str.size()};
+}
+
+// ============================================================================
+TEST_CASE("XXH64 reference values") {
+  CHECK(hash_bytes({}) == 0xEF46DB3751D8E999ULL);
+  CHECK(hash_bytes(as_bytes("a")) == 0xD24EC4F1A98C6E5BULL);
+  CHECK(hash_bytes(as_bytes("abc")) == 0x44BC2CF5AD770999ULL);
+  CHECK(hash_bytes(as_bytes("Nobody inspects the spammish repetition")) ==
+        0xFBCEA83C8A378BF1ULL);
+}
+
+TEST_CASE("Hash of the generated corpora") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const auto bytes = read_file(corpus.path);
+    std::vector<SubtreeHash> subtrees;
+    const auto h = hash_document(bytes, &subtrees);
+    REQUIRE(h.has_value());
+
+    // Same hash from the tree, and from documents of the same tree with their
+    // compound entries in another order
+    const Tag tree = parse(bytes);
+    CHECK(hash(tree) == *h);
+    CHECK(hash_document(serialize(tree, "other name")) == h);
+
+    // Subtrees: the root first, each hashing its payload
+    REQUIRE_FALSE(subtrees.empty());
+    CHECK(subtrees[0].hash == *h);
+    CHECK(subtrees[0].offset + subtrees[0].size == bytes.size());
+    for (const auto &subtree : subtrees) {
+      const std::span<const StreamChar> payload{bytes.data() + subtree.offset,
+                                                subtree.size};
+      CHECK(hash_payload(subtree.tag, payload) == subtree.hash);
+    }
+  }
+}
+
+TEST_CASE("Hash of modified trees") {
+  std::string_view path;
+  for (const auto &corpus : CORPUS)
+    if (corpus.name == "chunk_small_palette")
+      path = corpus.path;
+  const auto bytes = read_file(path);
+  const Tag tree = parse(bytes);
+  const auto h = hash(tree);
+
+  SUBCASE("Scalar") {
+    Tag modified = tree;
+    modified.as<Compound>().at("LastUpdate").as<int64_t>()++;
+    CHECK(hash(modified) != h);
+    CHECK(hash_document(serialize(modified)) == hash(modified));
+  }
+  SUBCASE("Type") {
+    Tag modified = tree;
+    auto &x = modified.as<Compound>().at("xPos");
+    x = Tag{static_cast<int64_t>(x.as<int32_t>())};
+    CHECK(hash(modified) != h);
+  }
+  SUBCASE("Entry renamed") {
+    Tag modified = tree;
+    auto &chunk = modified.as<Compound>();
+    REQUIRE(chunk.rename(chunk.find("Status"), "status"));
+    CHECK(hash(modified) != h);
+    CHECK(hash_document(serialize(modified)) == hash(modified));
+  }
+  SUBCASE("Values swapped between entries") {
+    Tag modified = tree;
+    auto &chunk = modified.as<Compound>();
+    std::swap(chunk.at("xPos"), chunk.at("zPos"));
+    if (chunk.at("xPos") != chunk.at("zPos"))
+      CHECK(hash(modified) != h);
+  }
+  SUBCASE("List elements reordered") {
+    Tag modified = tree;
+    auto &sections = modified.as<Compound>().at("sections").as<List>();
+    REQUIRE(sections.size() > 1);
+    std::swap(sections[0], sections[1]);
+    CHECK(hash(modified) != h);
+    CHECK(hash_document(serialize(modified)) == hash(modified));
+  }
+}
+
+TEST_CASE("Hash of invalid documents") {
+  std::string_view path;
+  for (const auto &corpus : CORPUS)
+    if (corpus.name == "chunk_small_palette")
+      path = corpus.path;
+  const auto bytes = read_file(path);
+  for (std::size_t size : {0ul, 2ul, 100ul, bytes.size() - 1})
+    CHECK_FALSE(hash_document({bytes.data(), size}).has_value());
+  auto trailing = bytes;
+  trailing.push_back(0);
+  CHECK_FALSE(hash_document(trailing).has_value());
+
+  // Nested lists deeper than the limit
+  std::vector<StreamChar> nested{static_cast<StreamChar>(Tags::List), 0, 0};
+  for (int i = 0; i < 1000; i++)
+    nested.insert(nested.end(), {static_cast<StreamChar>(Tags::List), 0, 0, 0,
+                                 1});
+  nested.insert(nested.end(), {0, 0, 0, 0, 0});
+  CHECK_FALSE(hash_document(nested).has_value());
+
+  // Duplicated names, that the parsed tree merges into one entry
+  const auto byte = static_cast<StreamChar>(Tags::Byte);
+  const std::vector<StreamChar> unique{10, 0, 0, byte, 0, 1, 'a', 1,
+                                       byte, 0, 1, 'b', 2, 0};
+  auto duplicated = unique;
+  duplicated[11] = 'a';
+  CHECK(hash_document(unique).has_value());
+  CHECK_FALSE(hash_document(duplicated).has_value());
+  auto inner = std::vector<StreamChar>{10, 0, 0, 10, 0, 1, 'c'};
+  inner.insert(inner.end(), duplicated.begin() + 3, duplicated.end());
+  inner.push_back(0);
+  CHECK_FALSE(hash_document(inner).has_value());
+}
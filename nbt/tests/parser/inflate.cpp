@@ -0,0 +1,156 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// One-shot decompression of DEFLATE streams, compared with zlib.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/inflate.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+using namespace minecraft::nbt;
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Compress bytes with zlib
+ *
+ * @param window_bits 15 for zlib, + 16 for gzip, negative for raw DEFLATE
+ */
+static std::vector<StreamChar> compress(std::span<const StreamChar> bytes,
+                                        int level, int strategy,
+                                        int window_bits = 15) {
+  z_stream zs{};
+  REQUIRE(deflateInit2(&zs, level, Z_DEFLATED, window_bits, 8, strategy) ==
+          Z_OK);
+  std::vector<StreamChar> out(deflateBound(&zs, bytes.size()) + 64);
+  zs.next_in = const_cast<Bytef *>(bytes.data());
+  zs.avail_in = static_cast<uInt>(bytes.size());
+  zs.next_out = out.data();
+  zs.avail_out = static_cast<uInt>(out.size());
+  REQUIRE(deflate(&zs, Z_FINISH) == Z_STREAM_END);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+  return out;
+}
+
+/**
+ * @brief NBT documents followed by random bytes
+ */
+static std::vector<StreamChar> make_inputs() {
+  std::vector<StreamChar> bytes;
+  for (const auto &corpus : CORPUS)
+    if (corpus.kind == "chunk" || corpus.kind == "entities") {
+      const auto file = read_file(corpus.path);
+      bytes.insert(bytes.end(), file.begin(), file.end());
+    }
+  std::mt19937 rng{7};
+  for (int i = 0; i < 100000; i++)
+    bytes.push_back(static_cast<StreamChar>(rng()));
+  return bytes;
+}
+
+// ============================================================================
+TEST_CASE("One-shot inflate of zlib streams") {
+  const auto bytes = make_inputs();
+  std::vector<StreamChar> out(bytes.size());
+  std::size_t n_out = 0;
+
+  for (int level : {0, 1, 6, 9})
+    for (int strategy : {Z_DEFAULT_STRATEGY, Z_FIXED, Z_HUFFMAN_ONLY, Z_RLE})
+      for (int window_bits : {15, 15 + 16}) {
+        CAPTURE(level);
+        CAPTURE(strategy);
+        CAPTURE(window_bits);
+        const auto compressed = compress(bytes, level, strategy, window_bits);
+        REQUIRE(inflate_oneshot(compressed, out, n_out) ==
+                InflateResult::SUCCESS);
+        CHECK(n_out == bytes.size());
+        CHECK(out == bytes);
+      }
+
+  // Empty & tiny documents
+  for (std::size_t size : {0, 1, 3}) {
+    const auto compressed =
+        compress(std::span{bytes}.first(size), 6, Z_DEFAULT_STRATEGY);
+    REQUIRE(inflate_oneshot(compressed, out, n_out) == InflateResult::SUCCESS);
+    CHECK(n_out == size);
+  }
+}
+
+TEST_CASE("One-shot inflate of invalid streams") {
+  const auto bytes = make_inputs();
+  const auto compressed = compress(bytes, 6, Z_DEFAULT_STRATEGY);
+  std::vector<StreamChar> out(bytes.size());
+  std::size_t n_out = 0;
+
+  // Output too small
+  CHECK(inflate_oneshot(compressed, std::span{out}.first(bytes.size() - 1),
+                        n_out) == InflateResult::SHORT_OUTPUT);
+  // Truncated
+  CHECK(inflate_oneshot(std::span{compressed}.first(compressed.size() / 2),
+                        out, n_out) == InflateResult::BAD_DATA);
+  // Checksum mismatch
+  auto corrupted = compressed;
+  corrupted.back() ^= 1;
+  CHECK(inflate_oneshot(corrupted, out, n_out) == InflateResult::BAD_DATA);
+  // Bad header
+  corrupted = compressed;
+  corrupted[1] ^= 1;
+  CHECK(inflate_oneshot(corrupted, out, n_out) == InflateResult::BAD_DATA);
+  // Random bytes in the stream
+  std::mt19937 rng{3};
+  for (int i = 0; i < 200; i++) {
+    corrupted = compressed;
+    corrupted[2 + rng() % 1000] = static_cast<StreamChar>(rng());
+    CHECK(inflate_oneshot(corrupted, out, n_out) != InflateResult::SUCCESS);
+  }
+
+  // Raw streams: the bytes after the stream are not read
+  auto raw = compress(bytes, 6, Z_DEFAULT_STRATEGY, -15);
+  const auto n_raw = raw.size();
+  raw.insert(raw.end(), {1, 2, 3});
+  std::size_t n_in = 0;
+  REQUIRE(inflate_raw(raw, out, n_in, n_out) == InflateResult::SUCCESS);
+  CHECK(n_in == n_raw);
+  CHECK(out == bytes);
+}
+
+TEST_CASE("inflate_all") {
+  const auto bytes = make_inputs();
+  std::vector<StreamChar> out;
+
+  // Exact size of the gzip trailer
+  const auto gzip = compress(bytes, 6, Z_DEFAULT_STRATEGY, 15 + 16);
+  REQUIRE(inflate_all(gzip, out));
+  CHECK(out == bytes);
+
+  // Size guessed too small for the one-shot decompression: streamed
+  const auto zlib = compress(bytes, 9, Z_DEFAULT_STRATEGY);
+  out = {};
+  REQUIRE(inflate_all(zlib, out, 100));
+  CHECK(out == bytes);
+  // Then sized by the previous document
+  REQUIRE(inflate_all(zlib, out));
+  CHECK(out == bytes);
+
+  auto corrupted = zlib;
+  corrupted.back() ^= 1;
+  CHECK_FALSE(inflate_all(corrupted, out));
+}
@@ -0,0 +1,100 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Unittests for the batch loading of NBT files.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/loader.hpp"
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+namespace fs = std::filesystem;
+using UC = unsigned char;
+
+// clang-format off
+// "hello world" document of the NBT specification, gzip-compressed
+static constexpr UC HELLO_WORLD_GZIP[]{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe3, 0x62,
+    0xe0, 0xce, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f, 0xca, 0x49,
+    0xe1, 0x60, 0x60, 0xc9, 0x4b, 0xcc, 0x4d, 0x65, 0xe0, 0x74, 0x4a, 0xcc,
+    0x4b, 0xcc, 0x2b, 0x4a, 0xcc, 0x4d, 0x64, 0x00, 0x00, 0x77, 0xda, 0x5c,
+    0x3a, 0x21, 0x00, 0x00, 0x00};
+// clang-format on
+
+/**
+ * @brief Temporary directory of files, removed at the end of the test
+ */
+struct TempFiles {
+  fs::path dir;
+  std::vector<fs::path> paths;
+
+  TempFiles() {
+    dir = fs::temp_directory_path() / "solismc_nbt_loader_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+  }
+  ~TempFiles() { fs::remove_all(dir); }
+
+  void add(const UC *bytes, std::size_t size) {
+    paths.push_back(dir / (std::to_string(paths.size()) + ".dat"));
+    std::ofstream{paths.back(), std::ios::binary}.write(
+        reinterpret_cast<const char *>(bytes),
+        static_cast<std::streamsize>(size));
+  }
+};
+
+static void check_hello_world(const std::optional<Tag> &root) {
+  REQUIRE(root.has_value());
+  const auto &compound = root->as<Compound>();
+  REQUIRE(compound.contains("name"));
+  CHECK(compound.at("name").as<SmallString>() == "Bananrama");
+}
+
+// ============================================================================
+TEST_CASE("Batch loader") {
+  TempFiles files;
+  constexpr std::size_t N_FILES{300};
+  for (std::size_t i = 0; i < N_FILES; i++)
+    files.add(HELLO_WORLD_GZIP, sizeof(HELLO_WORLD_GZIP));
+  // Invalid files: truncated, empty and missing
+  files.add(HELLO_WORLD_GZIP, 20);
+  files.add(HELLO_WORLD_GZIP, 0);
+  files.paths.push_back(files.dir / "missing.dat");
+
+  for (auto backend : {LoadBackend::AUTO, LoadBackend::THREADS}) {
+    CAPTURE(static_cast<int>(backend));
+    BatchLoader loader{{.backend = backend, .queue_depth = 8, .n_threads = 4}};
+    if (backend == LoadBackend::THREADS)
+      CHECK(loader.get_backend() == LoadBackend::THREADS);
+
+    SUBCASE("All files") {
+      auto roots = loader.load(files.paths);
+      REQUIRE(roots.size() == N_FILES + 3);
+      for (std::size_t i = 0; i < N_FILES; i++)
+        check_hello_world(roots[i]);
+      CHECK_FALSE(roots[N_FILES].has_value());
+      CHECK_FALSE(roots[N_FILES + 1].has_value());
+      CHECK_FALSE(roots[N_FILES + 2].has_value());
+    }
+
+    SUBCASE("Several batches") {
+      for (int i = 0; i < 3; i++) {
+        auto roots = loader.load(std::span{files.paths}.first(5));
+        for (const auto &root : roots)
+          check_hello_world(root);
+      }
+      CHECK(loader.load({}).empty());
+    }
+  }
+}
@@ -0,0 +1,178 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Conversions between Modified UTF-8 and UTF-8.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/mutf8.hpp"
+#include <doctest/doctest.h>
+#include <random>
+#include <string>
+
+using namespace minecraft::nbt;
+using namespace std::string_literals;
+
+// "a", NUL, "é", "€" and U+1F600 in both encodings
+static const std::string UTF8 = "a\0\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"s;
+static const std::string MUTF8 =
+    "a\xC0\x80\xC3\xA9\xE2\x82\xAC\xED\xA0\xBD\xED\xB8\x80"s;
+
+/**
+ * @brief Append a code point encoded in UTF-8
+ */
+static void append_utf8(std::string &str, uint32_t cp) {
+  if (cp < 0x80)
+    str += static_cast<char>(cp);
+  else if (cp < 0x800) {
+    str += static_cast<char>(0xC0 | cp >> 6);
+    str += static_cast<char>(0x80 | (cp & 0x3F));
+  } else if (cp < 0x10000) {
+    str += static_cast<char>(0xE0 | cp >> 12);
+    str += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+    str += static_cast<char>(0x80 | (cp & 0x3F));
+  } else {
+    str += static_cast<char>(0xF0 | cp >> 18);
+    str += static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+    str += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+    str += static_cast<char>(0x80 | (cp & 0x3F));
+  }
+}
+
+// ============================================================================
+TEST_CASE("ASCII prefix") {
+  CHECK(ascii_prefix("") == 0);
+  for (std::size_t size = 0; size < 70; size++)
+    for (const char c : {'\x80', '\xFF', '\0'}) {
+      std::string str(size, 'x');
+      CHECK(ascii_prefix(str) == size);
+      str += c;
+      str += "tail";
+      CAPTURE(size);
+      CHECK(ascii_prefix(str) == size);
+    }
+}
+
+TEST_CASE("MUTF-8 conversions") {
+  std::string out;
+  REQUIRE(mutf8_to_utf8(MUTF8, out));
+  CHECK(out == UTF8);
+  REQUIRE(utf8_to_mutf8(UTF8, out));
+  CHECK(out == MUTF8);
+  CHECK(is_valid_mutf8(MUTF8));
+  CHECK(is_valid_utf8(UTF8));
+
+  // ASCII strings, and the runs between the other characters
+  const std::string ascii(100, 'k');
+  REQUIRE(mutf8_to_utf8(ascii, out));
+  CHECK(out == ascii);
+  REQUIRE(utf8_to_mutf8(ascii + UTF8 + ascii, out));
+  CHECK(out == ascii + MUTF8 + ascii);
+
+  // Overlong forms of MUTF-8 are decoded, raw NUL kept
+  REQUIRE(mutf8_to_utf8("\xC1\x81\xE0\x80\x80"s, out));
+  CHECK(out == "A\0"s);
+  REQUIRE(mutf8_to_utf8("\0"s, out));
+  CHECK(out == "\0"s);
+
+  // In the tree strings
+  std::pmr::string pmr;
+  REQUIRE(mutf8_to_utf8(MUTF8, pmr));
+  CHECK(std::string_view{pmr} == UTF8);
+}
+
+TEST_CASE("Invalid MUTF-8 and UTF-8") {
+  std::string out;
+  for (const auto &invalid : {
+           "\xF0\x9F\x98\x80"s, // 4-bytes sequence
+           "\xED\xA0\xBDx"s,    // Unpaired surrogates
+           "\xED\xB8\x80"s,
+           "\xED\xA0\xBD\xC3\xA9"s,
+           "ab\xC3"s, // Truncated
+           "\xE2\x82"s,
+           "\x80"s, // Continuation
+           "\xFF"s,
+       }) {
+    CHECK_FALSE(is_valid_mutf8(invalid));
+    CHECK_FALSE(mutf8_to_utf8(invalid, out));
+  }
+  for (const auto &invalid : {
+           "\xC0\x80"s, // Overlong
+           "\xE0\x80\xAF"s,
+           "\xF0\x80\x80\xAF"s,
+           "\xED\xA0\x80"s,     // Surrogate
+           "\xF4\x90\x80\x80"s, // Over U+10FFFF
+           "\xE2\x82"s,         // Truncated
+           "\x80"s,
+       }) {
+    CHECK_FALSE(is_valid_utf8(invalid));
+    CHECK_FALSE(utf8_to_mutf8(invalid, out));
+  }
+}
+
+TEST_CASE("MUTF-8 round trip of random text") {
+  std::mt19937 rng{11};
+  for (int n = 0; n < 100; n++) {
+    std::string utf8;
+    for (int i = 0; i < 200; i++) {
+      // Mostly ASCII
+      uint32_t cp = rng() % 4 ? rng() % 0x80 : rng() % 0x110000;
+      if (cp >= 0xD800 && cp <= 0xDFFF)
+        cp = 0xFFFD;
+      append_utf8(utf8, cp);
+    }
+    std::string mutf8, back;
+    REQUIRE(utf8_to_mutf8(utf8, mutf8));
+    CHECK(is_valid_mutf8(mutf8));
+    CHECK(mutf8.find('\0') == std::string::npos);
+    REQUIRE(mutf8_to_utf8(mutf8, back));
+    CHECK(back == utf8);
+  }
+}
+
+TEST_CASE("MUTF-8 conversions of trees") {
+  const auto pmr = [](const std::string &str) {
+    return SmallString{str};
+  };
+  const auto make = [&](const std::string &text) {
+    List lines;
+    lines.elem_tag = Tags::String;
+    lines.push_back(Tag{pmr(text)});
+    lines.push_back(Tag{pmr("plain")});
+    Compound display;
+    display.insert_or_assign(pmr("Name" + text), Tag{pmr(text)});
+    display.insert_or_assign("Lore", Tag{std::move(lines)});
+    Compound root;
+    root.insert_or_assign("display", Tag{std::move(display)});
+    root.insert_or_assign("Count", Tag{int8_t{1}});
+    return Tag{std::move(root)};
+  };
+
+  Tag tree = make(UTF8);
+  REQUIRE(tree_to_mutf8(tree));
+  CHECK(tree == make(MUTF8));
+  REQUIRE(tree_to_utf8(tree));
+  CHECK(tree == make(UTF8));
+
+  // Invalid strings, names becoming the same
+  tree = make("\xFF"s);
+  CHECK_FALSE(tree_to_mutf8(tree));
+  Compound names;
+  names.insert_or_assign("@", Tag{int8_t{1}});
+  names.insert_or_assign(pmr("\xC1\x80"s), Tag{int8_t{2}});
+  tree = Tag{std::move(names)};
+  CHECK_FALSE(tree_to_utf8(tree));
+
+  // Lists filled without their element type, written with the type of their
+  // first element
+  List untyped;
+  untyped.push_back(Tag{pmr(UTF8)});
+  tree = Tag{std::move(untyped)};
+  REQUIRE(tree_to_mutf8(tree));
+  CHECK(tree.as<List>()[0] == Tag{pmr(MUTF8)});
+}
@@ -0,0 +1,117 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Unittests for the reading of compressed NBT documents.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/reader.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <iterator>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// ============================================================================
+// Test documents
+// ============================================================================
+
+// clang-format off
+// "hello world" document of the NBT specification, zlib-compressed
+static constexpr UC HELLO_WORLD_ZLIB[]{
+    0x78, 0xda, 0xe3, 0x62, 0xe0, 0xce, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28,
+    0xcf, 0x2f, 0xca, 0x49, 0xe1, 0x60, 0x60, 0xc9, 0x4b, 0xcc, 0x4d, 0x65,
+    0xe0, 0x74, 0x4a, 0xcc, 0x4b, 0xcc, 0x2b, 0x4a, 0xcc, 0x4d, 0x64, 0x00,
+    0x00, 0x9c, 0xe8, 0x09, 0xa9};
+
+// Same document, gzip-compressed
+static constexpr UC HELLO_WORLD_GZIP[]{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe3, 0x62,
+    0xe0, 0xce, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f, 0xca, 0x49,
+    0xe1, 0x60, 0x60, 0xc9, 0x4b, 0xcc, 0x4d, 0x65, 0xe0, 0x74, 0x4a, 0xcc,
+    0x4b, 0xcc, 0x2b, 0x4a, 0xcc, 0x4d, 0x64, 0x00, 0x00, 0x77, 0xda, 0x5c,
+    0x3a, 0x21, 0x00, 0x00, 0x00};
+
+// Same document, uncompressed
+static constexpr UC HELLO_WORLD[]{
+    0x0a, 0x00, 0x0b, 'h',  'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l',
+    'd',  0x08, 0x00, 0x04, 'n', 'a', 'm', 'e', 0x00, 0x09, 'B', 'a', 'n',
+    'a',  'n',  'r',  'a',  'm', 'a', 0x00};
+// clang-format on
+
+static void check_hello_world(const Reader &reader) {
+  REQUIRE(reader.get() != nullptr);
+  CHECK(reader.get_name() == "hello world");
+  const auto &root = reader.get()->as<Compound>();
+  REQUIRE(root.contains("name"));
+  CHECK(root.at("name").as<SmallString>() == "Bananrama");
+}
+
+// ============================================================================
+TEST_CASE("Reader") {
+  Reader reader;
+
+  SUBCASE("[HELLO_WORLD_ZLIB] Normal case") {
+    const StreamChar *strm = HELLO_WORLD_ZLIB;
+    unsigned long N = sizeof(HELLO_WORLD_ZLIB);
+    CHECK(reader.parse(strm, N) == ParseResult::SUCCESS);
+    CHECK(N == 0);
+    CHECK(reader.get_compression() == Compression::ZLIB);
+    check_hello_world(reader);
+  }
+
+  SUBCASE("[HELLO_WORLD_GZIP] Byte-per-byte feeding") {
+    const StreamChar *strm = HELLO_WORLD_GZIP;
+    for (std::size_t i = 0; i < sizeof(HELLO_WORLD_GZIP) - 1; i++) {
+      unsigned long N = 1;
+      CHECK(reader.parse(strm, N) == ParseResult::UNFINISHED);
+      CHECK(N == 0);
+    }
+    unsigned long N = 1;
+    CHECK(reader.parse(strm, N) == ParseResult::SUCCESS);
+    CHECK(reader.get_compression() == Compression::GZIP);
+    check_hello_world(reader);
+  }
+
+  SUBCASE("[HELLO_WORLD] Uncompressed document") {
+    const StreamChar *strm = HELLO_WORLD;
+    unsigned long N = sizeof(HELLO_WORLD);
+    CHECK(reader.parse(strm, N) == ParseResult::SUCCESS);
+    CHECK(reader.get_compression() == Compression::NONE);
+    check_hello_world(reader);
+  }
+
+  SUBCASE("[MULTIPLE_DOCS] Several readings") {
+    for (int i = 0; i < 3; i++) {
+      const StreamChar *strm = HELLO_WORLD_ZLIB;
+      unsigned long N = sizeof(HELLO_WORLD_ZLIB);
+      CHECK(reader.parse(strm, N) == ParseResult::SUCCESS);
+      check_hello_world(reader);
+    }
+  }
+
+  SUBCASE("[CORRUPTED] Invalid compressed stream") {
+    UC corrupted[sizeof(HELLO_WORLD_ZLIB)];
+    std::copy(std::begin(HELLO_WORLD_ZLIB), std::end(HELLO_WORLD_ZLIB),
+              corrupted);
+    corrupted[10] ^= 0xff;
+    const StreamChar *strm = corrupted;
+    unsigned long N = sizeof(corrupted);
+    CHECK(reader.parse(strm, N) == ParseResult::FAILED);
+    CHECK(reader.get() == nullptr);
+  }
+
+  SUBCASE("parse_bytes") {
+    auto root = parse_bytes(HELLO_WORLD_GZIP, sizeof(HELLO_WORLD_GZIP));
+    REQUIRE(root.has_value());
+    CHECK(root->as<Compound>().size() == 1);
+    CHECK_FALSE(parse_bytes(HELLO_WORLD_GZIP, 10).has_value());
+  }
+}
@@ -0,0 +1,235 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Saving of modified chunks and regions, reusing their unmodified bytes.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/region.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+namespace fs = std::filesystem;
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+static std::string_view find_corpus(std::string_view kind) {
+  for (const auto &corpus : CORPUS)
+    if (corpus.kind == kind)
+      return corpus.path;
+  return {};
+}
+
+static Tag &section_y(Tag &root, std::size_t i) {
+  return root.as<Compound>()
+      .find("sections")
+      ->second.as<List>()[i]
+      .as<Compound>()
+      .find("Y")
+      ->second;
+}
+
+// ============================================================================
+TEST_CASE("serialize_modified") {
+  const auto path = find_corpus("chunk");
+  REQUIRE_FALSE(path.empty());
+  const auto bytes = read_file(path);
+  auto parsed = parse_bytes(bytes.data(), bytes.size());
+  REQUIRE(parsed.has_value());
+  const auto original = serialize(*parsed, "chunk");
+
+  SUBCASE("Unmodified tree") {
+    auto tree = *parsed;
+    const auto out = serialize_modified(tree, original, {});
+    REQUIRE(out.has_value());
+    CHECK(*out == original);
+    // Unmarked modifications are not seen
+    section_y(tree, 0) = Tag{static_cast<int8_t>(100)};
+    CHECK(serialize_modified(tree, original, {}) == original);
+  }
+
+  SUBCASE("Modified subtrees") {
+    auto tree = *parsed;
+    section_y(tree, 0) = Tag{static_cast<int8_t>(100)};
+    section_y(tree, 1) = Tag{static_cast<int8_t>(101)};
+    auto &compound = tree.as<Compound>();
+    compound.insert_or_assign("Extra", Tag{int32_t{7}});
+    compound.insert_or_assign("Status", Tag{int64_t{1}});
+    compound.erase("LastUpdate");
+    const std::vector<Path> modified{{"sections", 0u, "Y"},
+                                     {"Extra"},
+                                     {"Status"}};
+
+    const auto out = serialize_modified(tree, original, modified);
+    REQUIRE(out.has_value());
+    const auto reparsed = parse_bytes(out->data(), out->size());
+    REQUIRE(reparsed.has_value());
+    // Every modification but the unmarked section
+    auto expected = tree;
+    section_y(expected, 1) = section_y(*parsed, 1);
+    CHECK(*reparsed == expected);
+    CHECK(*out == serialize(expected, "chunk"));
+
+    // The whole tree
+    const std::vector<Path> everything{{}};
+    const auto whole = serialize_modified(tree, original, everything);
+    REQUIRE(whole.has_value());
+    CHECK(*whole == serialize(tree, "chunk"));
+  }
+
+  SUBCASE("Invalid original") {
+    const std::vector<StreamChar> truncated(original.begin(),
+                                            original.begin() + 10);
+    const std::vector<Path> modified{{"Extra"}};
+    CHECK_FALSE(serialize_modified(*parsed, truncated, modified).has_value());
+  }
+}
+
+TEST_CASE("save_region") {
+  const auto path = find_corpus("region");
+  REQUIRE_FALSE(path.empty());
+  const auto dir = fs::temp_directory_path() / "solismc_nbt_save_test";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  const auto file = dir / "r.0.0.mca";
+  fs::copy_file(path, file);
+
+  // Payloads of the original chunks
+  std::vector<std::vector<StreamChar>> payloads(REGION_CHUNKS);
+  std::vector<std::size_t> indices;
+  {
+    auto region = RegionFile::open(file);
+    REQUIRE(region.has_value());
+    std::vector<StreamChar> buffer;
+    for (std::size_t i = 0; i < REGION_CHUNKS; i++)
+      if (const auto chunk = region->read_chunk(i, buffer)) {
+        payloads[i].assign(chunk->bytes.begin(), chunk->bytes.end());
+        indices.push_back(i);
+      }
+  }
+  REQUIRE(indices.size() > 2);
+  const auto n_chunks = indices.size();
+
+  Reader reader;
+  std::vector<StreamChar> buffer;
+  auto modified = std::make_shared<Tag>(
+      *RegionFile::open(file)->parse_chunk(indices[0], reader, buffer));
+  modified->as<Compound>().insert_or_assign("InhabitedTime",
+                                            Tag{int64_t{123456}});
+  DirtyChunks dirty;
+  dirty.mark(indices[0], modified, {"InhabitedTime"});
+  dirty.mark(indices[0], modified, {"InhabitedTime"});
+  dirty.remove(indices[1]);
+  CHECK(dirty.size() == 2);
+  CHECK(dirty.find(indices[0])->modified.size() == 1);
+  CHECK(dirty.find(indices[2]) == nullptr);
+
+  SUBCASE("In place") {
+    const auto stats = save_region(file, file, dirty);
+    REQUIRE(stats.has_value());
+    CHECK(stats->copied == n_chunks - 2);
+    CHECK(stats->patched == 1);
+    CHECK(stats->encoded == 0);
+    CHECK(stats->removed == 1);
+    CHECK_FALSE(fs::exists(dir / "r.0.0.mca.tmp"));
+
+    auto region = RegionFile::open(file);
+    REQUIRE(region.has_value());
+    CHECK(region->size() == n_chunks - 1);
+    CHECK_FALSE(region->contains(indices[1]));
+    CHECK(region->get_timestamp(indices[0]) ==
+          dirty.find(indices[0])->timestamp);
+    const auto chunk = region->parse_chunk(indices[0], reader, buffer);
+    REQUIRE(chunk.has_value());
+    CHECK(*chunk == *modified);
+    // Unmodified chunks copied verbatim
+    for (std::size_t i = 2; i < n_chunks; i++) {
+      const auto data = region->read_chunk(indices[i], buffer);
+      REQUIRE(data.has_value());
+      CHECK(std::equal(data->bytes.begin(), data->bytes.end(),
+                       payloads[indices[i]].begin(),
+                       payloads[indices[i]].end()));
+    }
+  }
+
+  SUBCASE("New region") {
+    const auto target = dir / "r.1.0.mca";
+    const auto stats = save_region(dir / "r.2.0.mca", target, dirty,
+                                   {.compression = ChunkCompression::GZIP});
+    REQUIRE(stats.has_value());
+    CHECK(stats->copied == 0);
+    CHECK(stats->encoded == 1);
+    CHECK(stats->removed == 0);
+    auto region = RegionFile::open(target);
+    REQUIRE(region.has_value());
+    CHECK(region->size() == 1);
+    CHECK(region->read_chunk(indices[0], buffer)->compression ==
+          ChunkCompression::GZIP);
+    const auto chunk = region->parse_chunk(indices[0], reader, buffer);
+    REQUIRE(chunk.has_value());
+    CHECK(*chunk == *modified);
+  }
+
+  fs::remove_all(dir);
+}
+
+TEST_CASE("save_region of oversized chunks") {
+  const auto dir = fs::temp_directory_path() / "solismc_nbt_oversized_test";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+
+  // More than 255 sectors once stored without compression
+  Compound compound;
+  compound.insert_or_assign(
+      "data",
+      Tag{std::pmr::vector<int8_t>(256 * REGION_SECTOR_SIZE, int8_t{1})});
+  compound.insert_or_assign("xPos", Tag{int32_t{33}});
+  const auto root = std::make_shared<Tag>(std::move(compound));
+  const auto index = chunk_index(33, 2);
+  DirtyChunks dirty;
+  dirty.mark(index, root, {});
+  const SaveOptions options{.compression = ChunkCompression::NONE};
+
+  const auto target = dir / "r.1.0.mca";
+  REQUIRE(save_region(target, target, dirty, options).has_value());
+  auto region = RegionFile::open(target);
+  REQUIRE(region.has_value());
+  std::vector<StreamChar> buffer;
+  const auto chunk = region->read_chunk(index, buffer);
+  REQUIRE(chunk.has_value());
+  CHECK(chunk->external);
+  CHECK(chunk->compression == ChunkCompression::NONE);
+  CHECK(fs::file_size(target) == 3 * REGION_SECTOR_SIZE);
+  CHECK(read_file((dir / "c.33.2.mcc").string()) == serialize(*root));
+  CHECK_FALSE(fs::exists(dir / "c.33.2.mcc.tmp"));
+
+  // Copied as is with the region
+  DirtyChunks none;
+  CHECK(save_region(target, target, none, options)->copied == 1);
+  CHECK(RegionFile::open(target)->read_chunk(index, buffer)->external);
+
+  // Without coordinates, the chunk can't be stored
+  CHECK_FALSE(save_region(dir / "missing.mca", dir / "chunks.mca", dirty,
+                          options)
+                  .has_value());
+  CHECK_FALSE(fs::exists(dir / "chunks.mca"));
+  CHECK_FALSE(fs::exists(dir / "chunks.mca.tmp"));
+
+  fs::remove_all(dir);
+}
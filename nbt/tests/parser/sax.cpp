@@ -0,0 +1,174 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Event-based parsing of NBT documents.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/sax.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// "hello world" document of the NBT specification
+static constexpr UC HELLO_WORLD[]{
+    0x0a, 0x00, 0x0b, 'h',  'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l',
+    'd',  0x08, 0x00, 0x04, 'n', 'a', 'm', 'e', 0x00, 0x09, 'B', 'a', 'n',
+    'a',  'n',  'r',  'a',  'm', 'a', 0x00};
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Visitor rebuilding the tree of the document from its events
+ */
+struct TreeBuilder : SaxVisitor {
+  Tag root;
+  std::vector<Tag *> stack;
+  std::string name;
+
+  Tag &next() {
+    if (stack.empty())
+      return root;
+    if (auto *compound = stack.back()->as_ptr<Compound>())
+      return compound->insert_or_assign(SmallString{name}, Tag{})
+          .first->second;
+    return stack.back()->as<List>().emplace_back();
+  }
+
+  void key(std::string_view key) { name = key; }
+  void begin_compound(std::string_view) {
+    auto &tag = next();
+    tag = Tag{Compound{}};
+    stack.push_back(&tag);
+  }
+  void begin_list(Tags elem_tag, int32_t) {
+    auto &tag = next();
+    tag = Tag{List{}};
+    tag.as<List>().elem_tag = elem_tag;
+    stack.push_back(&tag);
+  }
+  void begin_array(Tags tag, int32_t) {
+    auto &array = next();
+    if (tag == Tags::ByteArray)
+      array = Tag{std::pmr::vector<int8_t>{}};
+    else if (tag == Tags::IntArray)
+      array = Tag{std::pmr::vector<int32_t>{}};
+    else
+      array = Tag{std::pmr::vector<int64_t>{}};
+    stack.push_back(&array);
+  }
+  template <typename T> void value(T value) {
+    if constexpr (std::is_same_v<T, std::string_view>)
+      next() = Tag{SmallString{value}};
+    else
+      next() = Tag{value};
+  }
+  template <typename T> void array_chunk(std::span<const T> chunk) {
+    auto &array = stack.back()->as<std::pmr::vector<T>>();
+    array.insert(array.end(), chunk.begin(), chunk.end());
+  }
+  void end() { stack.pop_back(); }
+};
+
+/**
+ * @brief Visitor counting the events, stopping at the given one
+ */
+struct Counter : SaxVisitor {
+  std::size_t events = 0;
+  std::size_t stop_at = SIZE_MAX;
+
+  bool key(std::string_view) { return ++events < stop_at; }
+  template <typename T> bool value(T) { return ++events < stop_at; }
+};
+
+// ============================================================================
+TEST_CASE("SaxParser on the hello world document") {
+  const std::span<const StreamChar> document{HELLO_WORLD};
+  TreeBuilder builder;
+  REQUIRE(visit_document(document, builder));
+  const auto &root = builder.root.as<Compound>();
+  CHECK(root.size() == 1);
+  CHECK(root.at("name").as<SmallString>() == "Bananrama");
+
+  Counter counter;
+  CHECK(visit_document(document, counter));
+  CHECK(counter.events == 3);
+  // Stopped by the visitor
+  counter = {};
+  counter.stop_at = 2;
+  CHECK_FALSE(visit_document(document, counter));
+  CHECK(counter.events == 2);
+
+  // Truncated, then completed
+  SaxParser parser{builder};
+  const StreamChar *strm = document.data();
+  unsigned long N = document.size() - 1;
+  CHECK(parser.parse(strm, N) == ParseResult::UNFINISHED);
+  CHECK_FALSE(parser.is_parsed());
+  N = 1;
+  CHECK(parser.parse(strm, N) == ParseResult::SUCCESS);
+  CHECK(parser.is_parsed());
+
+  // Invalid tag
+  std::vector<StreamChar> invalid{document.begin(), document.end()};
+  invalid[14] = 0x42;
+  parser.reset();
+  strm = invalid.data();
+  N = invalid.size();
+  CHECK(parser.parse(strm, N) == ParseResult::FAILED);
+  CHECK(parser.parse(strm, N) == ParseResult::FAILED);
+}
+
+TEST_CASE("SaxParser on generated corpora") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const auto bytes = read_file(corpus.path);
+
+    BytesParser<Tag> reference;
+    const StreamChar *strm = bytes.data();
+    unsigned long N = bytes.size();
+    REQUIRE(reference.parse(strm, N) == ParseResult::SUCCESS);
+
+    SUBCASE("Contiguous") {
+      TreeBuilder builder;
+      REQUIRE(visit_document(bytes, builder));
+      CHECK(builder.root == *reference.get());
+    }
+
+    SUBCASE("By parts") {
+      // Splitting the values, strings & arrays at every possible place
+      for (std::size_t part : {1, 3, 7, 4093}) {
+        TreeBuilder builder;
+        SaxParser parser{builder};
+        strm = bytes.data();
+        ParseResult ret = ParseResult::UNFINISHED;
+        for (std::size_t pos = 0; pos < bytes.size(); pos += part) {
+          N = std::min(part, bytes.size() - pos);
+          ret = parser.parse(strm, N);
+          if (ret != ParseResult::UNFINISHED)
+            break;
+        }
+        CHECK(ret == ParseResult::SUCCESS);
+        CHECK(builder.root == *reference.get());
+      }
+    }
+  }
+}
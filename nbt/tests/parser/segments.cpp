@@ -0,0 +1,130 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Parsing of NBT documents split into several segments.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/reader.hpp"
+#include "minecraft/nbt/sax.hpp"
+#include "minecraft/nbt/segments.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// clang-format off
+// "hello world" document of the NBT specification, zlib-compressed
+static constexpr UC HELLO_WORLD_ZLIB[]{
+    0x78, 0xda, 0xe3, 0x62, 0xe0, 0xce, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28,
+    0xcf, 0x2f, 0xca, 0x49, 0xe1, 0x60, 0x60, 0xc9, 0x4b, 0xcc, 0x4d, 0x65,
+    0xe0, 0x74, 0x4a, 0xcc, 0x4b, 0xcc, 0x2b, 0x4a, 0xcc, 0x4d, 0x64, 0x00,
+    0x00, 0x9c, 0xe8, 0x09, 0xa9};
+
+// Same document, uncompressed
+static constexpr UC HELLO_WORLD[]{
+    0x0a, 0x00, 0x0b, 'h',  'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l',
+    'd',  0x08, 0x00, 0x04, 'n', 'a', 'm', 'e', 0x00, 0x09, 'B', 'a', 'n',
+    'a',  'n',  'r',  'a',  'm', 'a', 0x00};
+// clang-format on
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Split the bytes in segments of the given sizes (cycling through
+ * them), empty segments included
+ */
+static std::vector<Segment> split(std::span<const StreamChar> bytes,
+                                  std::initializer_list<std::size_t> sizes) {
+  std::vector<Segment> segments;
+  for (std::size_t pos = 0, i = 0; pos < bytes.size(); i++) {
+    const auto size =
+        std::min(*(sizes.begin() + i % sizes.size()), bytes.size() - pos);
+    segments.push_back(bytes.subspan(pos, size));
+    pos += size;
+  }
+  return segments;
+}
+
+// ============================================================================
+TEST_CASE("Segmented hello world documents") {
+  const std::span<const StreamChar> plain{HELLO_WORLD};
+  const std::span<const StreamChar> zlib{HELLO_WORLD_ZLIB};
+
+  for (const auto &segments :
+       {split(plain, {1}), split(plain, {5, 0, 11}), split(zlib, {3, 0}),
+        split(zlib, {sizeof(HELLO_WORLD_ZLIB)})}) {
+    const auto root = parse_bytes(segments);
+    REQUIRE(root.has_value());
+    CHECK(root->as<Compound>().at("name").as<SmallString>() ==
+          "Bananrama");
+  }
+
+  // Truncated
+  const auto truncated = split(plain.first(plain.size() - 1), {4});
+  CHECK_FALSE(parse_bytes(truncated).has_value());
+  CHECK_FALSE(parse_bytes(std::span<const Segment>{}).has_value());
+}
+
+TEST_CASE("Segmented generated corpora") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const auto bytes = read_file(corpus.path);
+    const auto reference = parse_bytes(bytes.data(), bytes.size());
+    REQUIRE(reference.has_value());
+
+    // Segments of network packets, pages & odd sizes splitting the values
+    for (const auto &segments :
+         {split(bytes, {1500}), split(bytes, {4096, 0}),
+          split(bytes, {1, 2, 3, 5, 7, 11, 13})}) {
+      CAPTURE(segments.size());
+      const auto root = parse_bytes(segments);
+      REQUIRE(root.has_value());
+      CHECK(*root == *reference);
+
+      SaxVisitor visitor;
+      SaxParser parser{visitor};
+      CHECK(parse_segments(parser, segments) == ParseResult::SUCCESS);
+    }
+  }
+}
+
+TEST_CASE("Successive documents across segments") {
+  // Two documents back to back, their boundary inside a segment
+  std::vector<StreamChar> bytes{std::begin(HELLO_WORLD), std::end(HELLO_WORLD)};
+  bytes.insert(bytes.end(), std::begin(HELLO_WORLD), std::end(HELLO_WORLD));
+  const auto segments = split(bytes, {10});
+
+  BytesParser<Tag> parser;
+  SegmentPosition position;
+  REQUIRE(parse_segments(parser, segments, position) == ParseResult::SUCCESS);
+  CHECK(position.segment == 3);
+  CHECK(position.offset == 3);
+  const auto first = parser.take();
+
+  REQUIRE(parse_segments(parser, segments, position) == ParseResult::SUCCESS);
+  CHECK(position.segment == segments.size() - 1);
+  CHECK(position.offset == segments.back().size());
+  CHECK(*parser.get() == first);
+
+  // Nothing left
+  parser.reset();
+  CHECK(parse_segments(parser, segments, position) ==
+        ParseResult::UNFINISHED);
+}
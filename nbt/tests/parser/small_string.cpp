@@ -0,0 +1,154 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Strings of the tree, stored inline when short.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/small_string.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include <doctest/doctest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace minecraft::nbt;
+
+/**
+ * @brief Resource counting its allocations
+ */
+struct CountingResource : std::pmr::memory_resource {
+  std::size_t allocations{0};
+  std::size_t in_use{0};
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    allocations++;
+    in_use += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+  void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+    in_use -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// ============================================================================
+TEST_CASE("Inline and heap strings") {
+  CountingResource resource;
+  const std::string longest_inline(SmallString::INLINE_CAPACITY, 'i');
+  const std::string heap(SmallString::INLINE_CAPACITY + 1, 'h');
+  {
+    SmallString str{&resource};
+    CHECK(str.empty());
+    CHECK(str.c_str()[0] == '\0');
+
+    str = longest_inline;
+    CHECK(str.is_inline());
+    CHECK(str == longest_inline);
+    CHECK(str.c_str()[str.size()] == '\0');
+    CHECK(resource.allocations == 0);
+
+    str = heap;
+    CHECK_FALSE(str.is_inline());
+    CHECK(str == heap);
+    CHECK(str.c_str()[str.size()] == '\0');
+    CHECK(resource.allocations == 1);
+
+    // The buffer is reused for shorter strings
+    str = "short";
+    CHECK(str == "short");
+    CHECK(str.capacity() == heap.size());
+    CHECK(resource.allocations == 1);
+
+    // Aliasing assignment
+    str = heap;
+    str = str.view().substr(3);
+    CHECK(str == heap.substr(3));
+
+    str.resize(100);
+    CHECK(str.size() == 100);
+    CHECK(str[99] == '\0');
+    str.clear();
+    CHECK(str.empty());
+
+    CHECK(SmallString{"b"} > SmallString{"a"});
+    CHECK(SmallString{"ab"} < "b");
+  }
+  CHECK(resource.in_use == 0);
+}
+
+TEST_CASE("Allocators of the strings") {
+  CountingResource a, b;
+  const std::string heap(40, 'h');
+  {
+    SmallString str{heap, &a};
+    CHECK(str.get_allocator().resource() == &a);
+
+    // Moves keep the buffer, copies use the default resource
+    SmallString moved{std::move(str)};
+    CHECK(moved.get_allocator().resource() == &a);
+    CHECK(moved == heap);
+    CHECK(str.empty());
+    SmallString copy{moved};
+    CHECK(copy.get_allocator().resource() ==
+          std::pmr::get_default_resource());
+    CHECK(a.allocations == 1);
+
+    // Moving to another resource copies
+    SmallString other{std::move(moved), &b};
+    CHECK(other == heap);
+    CHECK(b.allocations == 1);
+    SmallString assigned{&b};
+    assigned = std::move(copy);
+    CHECK(assigned.get_allocator().resource() == &b);
+    CHECK(b.allocations == 2);
+
+    other.swap(moved);
+    CHECK(moved.get_allocator().resource() == &b);
+    CHECK(moved == heap);
+  }
+  CHECK(a.in_use == 0);
+  CHECK(b.in_use == 0);
+}
+
+TEST_CASE("Short names and values cost no allocation") {
+  Compound root;
+  List names;
+  names.elem_tag = Tags::String;
+  for (int i = 0; i < 100; i++)
+    names.push_back(Tag{SmallString{"minecraft:stone"}});
+  root.insert_or_assign("Names", Tag{std::move(names)});
+  root.insert_or_assign("a_name_of_exactly_23_ch", Tag{int8_t{1}});
+  const auto bytes = serialize(Tag{std::move(root)});
+
+  // The compound nodes and the list buffer only
+  CountingResource resource;
+  BytesParser<Tag> parser{&resource};
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  REQUIRE(parser.parse(strm, N) == ParseResult::SUCCESS);
+  CHECK(resource.allocations == 3);
+  const auto &parsed = parser.get()->as<Compound>();
+  CHECK(parsed.at("Names").as<List>()[7].as<SmallString>().is_inline());
+
+  // Split strings are parsed into the same storage
+  BytesParser<Tag> split{&resource};
+  for (std::size_t i = 0; i < bytes.size(); i++) {
+    strm = bytes.data() + i;
+    N = 1;
+    const auto ret = split.parse(strm, N);
+    REQUIRE(ret == (i + 1 < bytes.size() ? ParseResult::UNFINISHED
+                                         : ParseResult::SUCCESS));
+  }
+  CHECK(*split.get() == *parser.get());
+}
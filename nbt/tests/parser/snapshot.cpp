@@ -0,0 +1,207 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Snapshots of parsed documents, built, mapped and queried in place.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/snapshot.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+namespace fs = std::filesystem;
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+static void write_file(const fs::path &path,
+                       const std::vector<StreamChar> &bytes) {
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char *>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+}
+
+static Tag parse(const std::vector<StreamChar> &bytes) {
+  BytesParser<Tag> parser;
+  const StreamChar *strm = bytes.data();
+  unsigned long N = bytes.size();
+  REQUIRE(parser.parse(strm, N) == ParseResult::SUCCESS);
+  return parser.take();
+}
+
+/**
+ * @brief Compound holding every type of tag
+ */
+static Tag make_tree() {
+  Compound level;
+  level.insert_or_assign("xPos", Tag{int32_t{-3}});
+  level.insert_or_assign("zPos", Tag{int32_t{12}});
+  level.insert_or_assign("Status", Tag{SmallString{"full"}});
+  level.insert_or_assign("Heights",
+                         Tag{std::pmr::vector<int64_t>{1, -2, 1LL << 40}});
+  List sections;
+  sections.elem_tag = Tags::Compound;
+  for (int8_t y = -4; y < 0; y++) {
+    Compound section;
+    section.insert_or_assign("Y", Tag{y});
+    section.insert_or_assign("Blocks",
+                             Tag{std::pmr::vector<int8_t>(16, y)});
+    section.insert_or_assign("Status", Tag{SmallString{"full"}});
+    sections.push_back(Tag{std::move(section)});
+  }
+  level.insert_or_assign("Sections", Tag{std::move(sections)});
+
+  Compound root;
+  root.insert_or_assign("Level", Tag{std::move(level)});
+  root.insert_or_assign("DataVersion", Tag{int32_t{3953}});
+  root.insert_or_assign("Scale", Tag{0.5f});
+  root.insert_or_assign("Time", Tag{-1.25});
+  root.insert_or_assign("Flag", Tag{int16_t{-7}});
+  root.insert_or_assign("Seed", Tag{int64_t{-1}});
+  root.insert_or_assign("Empty", Tag{Compound{}});
+  root.insert_or_assign("Palette", Tag{std::pmr::vector<int32_t>{}});
+  return Tag{std::move(root)};
+}
+
+// ============================================================================
+TEST_CASE("Snapshot queries") {
+  const Tag tree = make_tree();
+  auto bytes = build_snapshot(tree, "chunk", 42);
+  REQUIRE(bytes.has_value());
+  const auto snapshot = Snapshot::from_bytes(std::move(*bytes));
+  REQUIRE(snapshot.has_value());
+  CHECK(snapshot->verify());
+  CHECK(snapshot->root_name() == "chunk");
+  CHECK(snapshot->source_hash() == 42);
+
+  const auto root = snapshot->root();
+  CHECK(root.tag() == Tags::Compound);
+  CHECK(root.size() == 8);
+  CHECK(root.find("DataVersion").get<int32_t>() == 3953);
+  CHECK(root.find("Scale").get<float>() == 0.5f);
+  CHECK(root.find("Time").get<double>() == -1.25);
+  CHECK(root.find("Flag").get<int16_t>() == -7);
+  CHECK(root.find("Seed").get<int64_t>() == -1);
+  CHECK(root.find("Empty").size() == 0);
+  CHECK(root.find("Palette").array<int32_t>().empty());
+
+  const auto level = root.find("Level");
+  CHECK(level.find("xPos").get<int32_t>() == -3);
+  CHECK(level.find("Status").string() == "full");
+  const auto heights = level.find("Heights").array<int64_t>();
+  REQUIRE(heights.size() == 3);
+  CHECK(heights[2] == 1LL << 40);
+
+  const auto sections = level.find("Sections");
+  CHECK(sections.elem_tag() == Tags::Compound);
+  REQUIRE(sections.size() == 4);
+  CHECK(sections[1].find("Y").get<int8_t>() == -3);
+  CHECK(sections[3].find("Blocks").array<int8_t>().size() == 16);
+
+  // Missing entries, out of range elements & type mismatches
+  CHECK_FALSE(root.find("Missing"));
+  CHECK_FALSE(root.find("Missing").find("xPos"));
+  CHECK_FALSE(sections[4]);
+  CHECK(root.find("DataVersion").get<int64_t>() == 0);
+  CHECK(root.find("DataVersion").string().empty());
+  CHECK(level.find("Heights").array<int32_t>().empty());
+
+  // Names in order, and copy back into a tree
+  for (std::size_t i = 1; i < root.size(); i++)
+    CHECK(root.name_at(i - 1) < root.name_at(i));
+  CHECK(root.to_tag() == tree);
+}
+
+TEST_CASE("Snapshots of the generated corpora") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const Tag tree = parse(read_file(corpus.path));
+    auto bytes = build_snapshot(tree);
+    REQUIRE(bytes.has_value());
+    const auto snapshot = Snapshot::from_bytes(std::move(*bytes));
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->verify());
+    CHECK(snapshot->root().to_tag() == tree);
+  }
+}
+
+TEST_CASE("load_snapshot") {
+  const auto dir = fs::temp_directory_path() / "solismc_snapshot_test";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  const auto source = dir / "level.dat";
+  const auto path = dir / "level.snap";
+
+  const Tag tree = make_tree();
+  write_file(source, serialize(tree, "Data"));
+
+  // Built on the first load, then mapped
+  auto snapshot = load_snapshot(source, path);
+  REQUIRE(snapshot.has_value());
+  CHECK(fs::exists(path));
+  CHECK(snapshot->root_name() == "Data");
+  CHECK(snapshot->root().to_tag() == tree);
+  const auto mapped = Snapshot::open(path);
+  REQUIRE(mapped.has_value());
+  CHECK(mapped->source_hash() == snapshot->source_hash());
+  CHECK(mapped->root().find("Level").find("zPos").get<int32_t>() == 12);
+
+  // Rebuilt once the source changes
+  auto modified = std::get<Compound>(tree);
+  modified.insert_or_assign("DataVersion", Tag{int32_t{4000}});
+  write_file(source, serialize(Tag{modified}, "Data"));
+  snapshot = load_snapshot(source, path);
+  REQUIRE(snapshot.has_value());
+  CHECK(snapshot->root().find("DataVersion").get<int32_t>() == 4000);
+  CHECK(Snapshot::open(path)->source_hash() == snapshot->source_hash());
+
+  // Missing or invalid sources
+  CHECK_FALSE(load_snapshot(dir / "missing.dat", path));
+  write_file(source, {1, 2, 3});
+  CHECK_FALSE(load_snapshot(source, path));
+  fs::remove_all(dir);
+}
+
+TEST_CASE("Invalid snapshots") {
+  auto bytes = *build_snapshot(make_tree());
+
+  auto corrupted = bytes;
+  corrupted[0] ^= 1; // Magic
+  CHECK_FALSE(Snapshot::from_bytes(corrupted));
+  corrupted = bytes;
+  corrupted[8] ^= 1; // Version
+  CHECK_FALSE(Snapshot::from_bytes(corrupted));
+  corrupted = bytes;
+  corrupted.pop_back(); // Size
+  CHECK_FALSE(Snapshot::from_bytes(corrupted));
+  CHECK_FALSE(Snapshot::from_bytes({}));
+  CHECK_FALSE(Snapshot::open("/nonexistent/snapshot"));
+
+  // Offsets out of the snapshot
+  corrupted = bytes;
+  SnapshotHeader header;
+  std::memcpy(&header, corrupted.data(), sizeof(header));
+  header.root.value = corrupted.size();
+  std::memcpy(corrupted.data(), &header, sizeof(header));
+  const auto snapshot = Snapshot::from_bytes(corrupted);
+  REQUIRE(snapshot.has_value());
+  CHECK_FALSE(snapshot->verify());
+}
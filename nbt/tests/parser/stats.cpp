@@ -0,0 +1,84 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Unittests for the parsing statistics.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/stats.hpp"
+#include <algorithm>
+#include <doctest/doctest.h>
+#include <thread>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// clang-format off
+static constexpr UC HELLO_WORLD[]{
+    0x0a, 0x00, 0x0b, 'h',  'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l',
+    'd',  0x08, 0x00, 0x04, 'n', 'a', 'm', 'e', 0x00, 0x09, 'B', 'a', 'n',
+    'a',  'n',  'r',  'a',  'm', 'a', 0x00};
+// clang-format on
+
+static void parse_hello_world(unsigned long step) {
+  BytesParser<Tag> parser;
+  const StreamChar *strm = HELLO_WORLD;
+  unsigned long left = sizeof(HELLO_WORLD);
+  ParseResult ret;
+  do {
+    unsigned long N = std::min(step, left);
+    left -= N;
+    ret = parser.parse(strm, N);
+  } while (ret == ParseResult::UNFINISHED && left > 0);
+  CHECK(ret == ParseResult::SUCCESS);
+}
+
+// ============================================================================
+TEST_CASE("Parse statistics") {
+  reset_thread_stats();
+
+  if constexpr (!STATS_ENABLED) {
+    parse_hello_world(sizeof(HELLO_WORLD));
+    CHECK(thread_stats().bytes == 0);
+    CHECK(collect_stats().documents == 0);
+    return;
+  }
+
+  SUBCASE("Thread counters") {
+    parse_hello_world(1);
+    const auto stats = thread_stats();
+    CHECK(stats.bytes == sizeof(HELLO_WORLD));
+    CHECK(stats.documents == 1);
+    CHECK(stats.failures == 0);
+    CHECK(stats.resumptions == sizeof(HELLO_WORLD) - 1);
+    CHECK(stats.values[static_cast<int>(Tags::Compound)] == 1);
+    CHECK(stats.values[static_cast<int>(Tags::String)] == 1);
+    CHECK(stats.largest_string == 11);
+    CHECK(stats.allocations == 1); // Compound entry
+  }
+
+  SUBCASE("Aggregation over threads") {
+    const auto before = collect_stats();
+    std::thread worker{[] { parse_hello_world(sizeof(HELLO_WORLD)); }};
+    worker.join();
+    parse_hello_world(sizeof(HELLO_WORLD));
+    const auto after = collect_stats();
+    CHECK(after.documents - before.documents == 2);
+    CHECK(after.bytes - before.bytes == 2 * sizeof(HELLO_WORLD));
+  }
+
+  SUBCASE("Prometheus export") {
+    parse_hello_world(sizeof(HELLO_WORLD));
+    const auto text = to_prometheus(thread_stats(), "nbt");
+    CHECK(text.find("# TYPE nbt_bytes_total counter\nnbt_bytes_total 33\n") !=
+          std::string::npos);
+    CHECK(text.find("nbt_values_total{tag=\"String\"} 1\n") !=
+          std::string::npos);
+  }
+}
@@ -78,4 +78,36 @@ TEST_CASE("BytesParser<NBT::String>") {
     CHECK_EQ(parser.get(), "");
     CHECK_EQ(n, 0);
   }
-}
\ No newline at end of file
+  SUBCASE("[LONG_STR] Move out") {
+    auto *p = static_cast<const StreamChar *>(LONG_STR::STREAM);
+    auto n = LONG_STR::LENGTH;
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+
+    const std::string value = parser.take();
+    CHECK_EQ(value, LONG_STR::VALUES[0]);
+    CHECK_FALSE(parser.is_parsed());
+    CHECK_EQ(parser.get(), "");
+
+    // The parser is ready for a new string
+    p = static_cast<const StreamChar *>(LONG_STR::STREAM);
+    n = LONG_STR::LENGTH;
+    auto ret = parser.parse(p, n);
+    CHECK_PARSED_STR(LONG_STR, SUCCESS, 0, 0);
+  }
+  SUBCASE("[LONG_STR] Buffers swap") {
+    std::string dest(1024, 'x');
+    const auto *dest_buffer = dest.data();
+
+    auto *p = static_cast<const StreamChar *>(LONG_STR::STREAM);
+    auto n = LONG_STR::LENGTH;
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    parser.take(dest);
+    CHECK_EQ(dest, LONG_STR::VALUES[0]);
+
+    // The parser now fills the former buffer of dest
+    p = static_cast<const StreamChar *>(LONG_STR::STREAM);
+    n = LONG_STR::LENGTH;
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    CHECK_EQ(parser.get().data(), dest_buffer);
+  }
+}
@@ -0,0 +1,218 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Unittests for NBT tree byte parsing.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/tag.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <memory_resource>
+#include <vector>
+
+using namespace minecraft::nbt;
+using UC = unsigned char;
+
+// ============================================================================
+// Test documents
+// ============================================================================
+
+// clang-format off
+// Reference "hello world" document of the NBT specification
+static constexpr UC HELLO_WORLD[]{
+    0x0a, 0x00, 0x0b, 'h',  'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l',
+    'd',  0x08, 0x00, 0x04, 'n', 'a', 'm', 'e', 0x00, 0x09, 'B', 'a', 'n',
+    'a',  'n',  'r',  'a',  'm', 'a', 0x00};
+
+// Document using every tag type
+static constexpr UC ALL_TAGS[]{
+    0x0a, 0x00, 0x04, 'r', 'o', 'o', 't',
+    // Primitives
+    0x01, 0x00, 0x01, 'b', 0x7f,
+    0x02, 0x00, 0x01, 's', 0xff, 0xfe,
+    0x03, 0x00, 0x01, 'i', 0x00, 0x00, 0x01, 0x5b,
+    0x04, 0x00, 0x01, 'l', 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x05, 0x00, 0x01, 'f', 0x3f, 0xc0, 0x00, 0x00,
+    0x06, 0x00, 0x01, 'd', 0xbf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // Arrays
+    0x07, 0x00, 0x02, 'b', 'a', 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x03,
+    0x0b, 0x00, 0x02, 'i', 'a', 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
+    0x0c, 0x00, 0x02, 'l', 'a', 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    // Lists
+    0x09, 0x00, 0x04, 'l', 'i', 's', 't', 0x0a, 0x00, 0x00, 0x00, 0x02,
+    0x08, 0x00, 0x01, 'n', 0x00, 0x01, 'x', 0x00,
+    0x00,
+    0x09, 0x00, 0x05, 'e', 'm', 'p', 't', 'y', 0x00, 0x00, 0x00, 0x00, 0x00,
+    // Nested compounds
+    0x0a, 0x00, 0x06, 'n', 'e', 's', 't', 'e', 'd',
+    0x0a, 0x00, 0x04, 'd', 'e', 'e', 'p',
+    0x03, 0x00, 0x01, 'v', 0x00, 0x00, 0x00, 0x07,
+    0x00,
+    0x00,
+    0x00};
+// clang-format on
+
+// Check the content of the ALL_TAGS document
+static void check_all_tags(const BytesParser<Tag> &parser) {
+  REQUIRE(parser.get() != nullptr);
+  CHECK_EQ(parser.get_name(), "root");
+
+  const auto &root = parser.get()->as<Compound>();
+  CHECK_EQ(root.size(), 12);
+  CHECK_EQ(root.at("b").as<int8_t>(), 127);
+  CHECK_EQ(root.at("s").as<int16_t>(), -2);
+  CHECK_EQ(root.at("i").as<int32_t>(), 347);
+  CHECK_EQ(root.at("l").as<int64_t>(), 1);
+  CHECK_EQ(root.at("f").as<float>(), 1.5f);
+  CHECK_EQ(root.at("d").as<double>(), -0.25);
+  const std::pmr::vector<int8_t> BA{1, 2, 3};
+  const std::pmr::vector<int32_t> IA{1, -1};
+  const std::pmr::vector<int64_t> LA{2};
+  CHECK_EQ(root.at("ba").as<std::pmr::vector<int8_t>>(), BA);
+  CHECK_EQ(root.at("ia").as<std::pmr::vector<int32_t>>(), IA);
+  CHECK_EQ(root.at("la").as<std::pmr::vector<int64_t>>(), LA);
+
+  const auto &list = root.at("list").as<List>();
+  CHECK_EQ(list.elem_tag, Tags::Compound);
+  REQUIRE_EQ(list.size(), 2);
+  CHECK_EQ(list[0].as<Compound>().at("n").as<SmallString>(), "x");
+  CHECK(list[1].as<Compound>().empty());
+
+  const auto &empty = root.at("empty").as<List>();
+  CHECK_EQ(empty.elem_tag, Tags::END);
+  CHECK(empty.empty());
+
+  const auto &nested = root.at("nested").as<Compound>();
+  CHECK_EQ(nested.at("deep").as<Compound>().at("v").as<int32_t>(), 7);
+}
+
+// ============================================================================
+/**
+ * @brief Document of the given number of nested lists (or compounds)
+ */
+static std::vector<StreamChar> make_nested(std::size_t depth, bool compounds) {
+  std::vector<StreamChar> bytes;
+  if (compounds) {
+    bytes.insert(bytes.end(), {0x0a, 0x00, 0x00});
+    for (std::size_t i = 1; i < depth; i++)
+      bytes.insert(bytes.end(), {0x0a, 0x00, 0x00});
+    bytes.insert(bytes.end(), depth, 0x00);
+    return bytes;
+  }
+  bytes.insert(bytes.end(), {0x09, 0x00, 0x00});
+  for (std::size_t i = 1; i < depth; i++)
+    bytes.insert(bytes.end(), {0x09, 0x00, 0x00, 0x00, 0x01});
+  bytes.insert(bytes.end(), {0x00, 0x00, 0x00, 0x00, 0x00});
+  return bytes;
+}
+
+TEST_CASE("BytesParser<NBT::Tag>") {
+  BytesParser<Tag> parser;
+
+  SUBCASE("[HELLO_WORLD] Normal case") {
+    auto *p = static_cast<const StreamChar *>(HELLO_WORLD);
+    auto n = sizeof(HELLO_WORLD);
+    auto ret = parser.parse(p, n);
+
+    CHECK_EQ(ret, ParseResult::SUCCESS);
+    CHECK_EQ(n, 0);
+    CHECK_EQ(parser.get_name(), "hello world");
+    REQUIRE(parser.get() != nullptr);
+    CHECK_EQ(parser.get()->tag(), Tags::Compound);
+    CHECK_EQ(parser.get()->as<Compound>().at("name").as<SmallString>(),
+             "Bananrama");
+  }
+  SUBCASE("[ALL_TAGS] Every tag type") {
+    auto *p = static_cast<const StreamChar *>(ALL_TAGS);
+    auto n = sizeof(ALL_TAGS);
+    auto ret = parser.parse(p, n);
+
+    CHECK_EQ(ret, ParseResult::SUCCESS);
+    CHECK_EQ(n, 0);
+    check_all_tags(parser);
+  }
+  SUBCASE("[ALL_TAGS] Byte-per-byte feeding") {
+    auto *p = static_cast<const StreamChar *>(ALL_TAGS);
+    for (std::size_t i = 0; i < sizeof(ALL_TAGS); i++) {
+      unsigned long n = 1;
+      auto ret = parser.parse(p, n);
+
+      CHECK_EQ(n, 0);
+      CHECK_EQ(ret, i + 1 == sizeof(ALL_TAGS) ? ParseResult::SUCCESS
+                                              : ParseResult::UNFINISHED);
+    }
+    check_all_tags(parser);
+  }
+  SUBCASE("[MULTIPLE_DOCS] Several readings") {
+    auto *p = static_cast<const StreamChar *>(HELLO_WORLD);
+    auto n = sizeof(HELLO_WORLD);
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+
+    p = static_cast<const StreamChar *>(ALL_TAGS);
+    n = sizeof(ALL_TAGS);
+    CHECK_EQ(parser.parse(p, n), ParseResult::SUCCESS);
+    check_all_tags(parser);
+  }
+  SUBCASE("[ALL_TAGS] Memory resource") {
+    // Fixed arena without upstream: any allocation out of it would throw
+    std::array<std::byte, 1 << 14> buffer;
+    std::pmr::monotonic_buffer_resource arena{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    BytesParser<Tag> arena_parser{&arena};
+    auto *p = static_cast<const StreamChar *>(ALL_TAGS);
+    auto n = sizeof(ALL_TAGS);
+
+    CHECK_EQ(arena_parser.parse(p, n), ParseResult::SUCCESS);
+    check_all_tags(arena_parser);
+    const auto &root = arena_parser.get()->as<Compound>();
+    CHECK_EQ(root.get_allocator().resource(), &arena);
+    CHECK_EQ(root.begin()->first.get_allocator().resource(), &arena);
+    CHECK_EQ(root.at("list").as<List>().get_allocator().resource(), &arena);
+    CHECK_EQ(root.at("ia").as<std::pmr::vector<int32_t>>()
+                 .get_allocator()
+                 .resource(),
+             &arena);
+  }
+  SUBCASE("[INVALID_TAG] Unknown tag ID") {
+    static constexpr UC INVALID[]{0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00};
+    auto *p = static_cast<const StreamChar *>(INVALID);
+    auto n = sizeof(INVALID);
+
+    CHECK_EQ(parser.parse(p, n), ParseResult::FAILED);
+    CHECK_EQ(parser.parse(p, n), ParseResult::FAILED);
+    CHECK_EQ(parser.get(), nullptr);
+  }
+  SUBCASE("[NEGATIVE_LIST] Negative list size") {
+    static constexpr UC INVALID[]{0x09, 0x00, 0x00, 0x01,
+                                  0xff, 0xff, 0xff, 0xff};
+    auto *p = static_cast<const StreamChar *>(INVALID);
+    auto n = sizeof(INVALID);
+
+    CHECK_EQ(parser.parse(p, n), ParseResult::FAILED);
+  }
+  SUBCASE("[NESTING] Nesting limit") {
+    for (const bool compounds : {false, true}) {
+      CAPTURE(compounds);
+      for (const auto depth : {BytesParser<Tag>::MAX_DEPTH,
+                               BytesParser<Tag>::MAX_DEPTH + 1}) {
+        const auto bytes = make_nested(depth, compounds);
+        const StreamChar *p = bytes.data();
+        unsigned long n = bytes.size();
+        CHECK_EQ(parser.parse(p, n), depth > BytesParser<Tag>::MAX_DEPTH
+                                         ? ParseResult::FAILED
+                                         : ParseResult::SUCCESS);
+        parser.reset();
+      }
+    }
+  }
+}
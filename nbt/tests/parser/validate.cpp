@@ -0,0 +1,182 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Validation of untrusted documents, and bounded allocations of the parsers.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/parsers/list.hpp"
+#include "minecraft/nbt/parsers/tag.hpp"
+#include "minecraft/nbt/validate.hpp"
+#include "minecraft/nbt/writer.hpp"
+#include "solismc_dataset/nbt/corpus.hpp"
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace minecraft::nbt;
+
+static std::vector<StreamChar> read_file(std::string_view path) {
+  std::ifstream file{std::string{path}, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Document of a small compound
+ */
+static std::vector<StreamChar> make_document() {
+  Compound root;
+  root.insert_or_assign("Name", Tag{SmallString{"stone"}});
+  root.insert_or_assign("Count", Tag{int8_t{64}});
+  root.insert_or_assign("Damage", Tag{int16_t{3}});
+  root.insert_or_assign("Heights", Tag{std::pmr::vector<int64_t>{1, 2, 3}});
+  List lore;
+  lore.elem_tag = Tags::String;
+  lore.push_back(Tag{SmallString{"first"}});
+  lore.push_back(Tag{SmallString{"second"}});
+  root.insert_or_assign("Lore", Tag{std::move(lore)});
+  List pos;
+  pos.elem_tag = Tags::Double;
+  pos.assign(3, Tag{0.5});
+  root.insert_or_assign("Pos", Tag{std::move(pos)});
+  root.insert_or_assign("tag", Tag{Compound{}});
+  return serialize(Tag{std::move(root)}, "item");
+}
+
+/**
+ * @brief Lists nested to the given depth
+ */
+static std::vector<StreamChar> make_nested(std::size_t depth) {
+  Tag tag{List{}};
+  for (std::size_t i = 1; i < depth; i++) {
+    List list;
+    list.elem_tag = Tags::List;
+    list.push_back(std::move(tag));
+    tag = Tag{std::move(list)};
+  }
+  return serialize(tag);
+}
+
+// ============================================================================
+TEST_CASE("Validation of the generated corpora") {
+  for (const auto &corpus : CORPUS) {
+    if (corpus.kind == "region")
+      continue;
+    CAPTURE(corpus.name);
+    const auto bytes = read_file(corpus.path);
+    const auto validation = validate(bytes);
+    CHECK(validation.error == ValidationError::NONE);
+    CHECK(validation.offset == bytes.size());
+  }
+}
+
+TEST_CASE("Validation of malformed documents") {
+  auto bytes = make_document();
+  REQUIRE(validate(bytes));
+
+  // Trailing bytes are not read
+  auto extended = bytes;
+  extended.insert(extended.end(), {0xFF, 0xFF});
+  CHECK(validate(extended).offset == bytes.size());
+
+  // Every truncation
+  for (std::size_t size = 0; size < bytes.size(); size++) {
+    CAPTURE(size);
+    CHECK(validate(std::span{bytes}.first(size)).error ==
+          ValidationError::TRUNCATED);
+  }
+
+  // Huge array in a few bytes
+  const std::vector<StreamChar> huge{0x0B, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+                                     0x00, 0x00, 0x00, 0x01, 0x00, 0x00};
+  CHECK(validate(huge).error == ValidationError::TRUNCATED);
+  // Negative arrays and lists
+  CHECK(validate(std::vector<StreamChar>{0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+                                         0xFF})
+            .error == ValidationError::NEGATIVE_SIZE);
+  CHECK(validate(std::vector<StreamChar>{0x09, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+                                         0xFF, 0xFF})
+            .error == ValidationError::NEGATIVE_SIZE);
+  // Lists of END, unknown tags & END values
+  CHECK(validate(std::vector<StreamChar>{0x09, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+                                         0xFF, 0xFF})
+            .error == ValidationError::INVALID_TAG);
+  CHECK(validate(std::vector<StreamChar>{0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                         0x00, 0x00}));
+  CHECK(validate(std::vector<StreamChar>{0x0D, 0x00, 0x00}).error ==
+        ValidationError::INVALID_TAG);
+  CHECK(validate(std::vector<StreamChar>{0x00, 0x00, 0x00}).error ==
+        ValidationError::INVALID_TAG);
+  CHECK(validate(std::vector<StreamChar>{0x0A, 0x00, 0x00, 0x0D, 0x00, 0x00,
+                                         0x00})
+            .error == ValidationError::INVALID_TAG);
+  // Lists of compounds longer than the document
+  CHECK(validate(std::vector<StreamChar>{0x09, 0x00, 0x00, 0x0A, 0x00, 0x00,
+                                         0x00, 0x03, 0x00, 0x00})
+            .error == ValidationError::TRUNCATED);
+}
+
+TEST_CASE("Validation limits") {
+  const auto bytes = make_document();
+
+  ValidationLimits limits;
+  limits.max_string_size = 6; // "Heights"
+  CHECK(validate(bytes, limits).error == ValidationError::STRING_TOO_LONG);
+  limits.max_string_size = 7;
+  CHECK(validate(bytes, limits));
+
+  // 7 entries, 3 + 2 + 3 elements
+  limits = {};
+  limits.max_elements = 14;
+  CHECK(validate(bytes, limits).error == ValidationError::TOO_MANY_ELEMENTS);
+  limits.max_elements = 15;
+  CHECK(validate(bytes, limits));
+
+  limits = {};
+  limits.max_array_size = 2;
+  CHECK(validate(bytes, limits).error == ValidationError::ARRAY_TOO_LARGE);
+  limits.max_array_size = 3;
+  CHECK(validate(bytes, limits));
+
+  limits = {};
+  limits.max_depth = 10;
+  CHECK(validate(make_nested(10), limits));
+  CHECK(validate(make_nested(11), limits).error == ValidationError::TOO_DEEP);
+  // Never deeper than MAX_DEPTH
+  limits.max_depth = 100000;
+  CHECK(validate(make_nested(ValidationLimits::MAX_DEPTH)));
+  CHECK(validate(make_nested(ValidationLimits::MAX_DEPTH + 1), limits).error ==
+        ValidationError::TOO_DEEP);
+}
+
+TEST_CASE("Parsers reserve only the bytes at hand") {
+  // The whole array length is not reserved upfront
+  const std::vector<StreamChar> huge{0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+                                     0x00, 0x01, 0x00, 0x00};
+  BytesParser<std::vector<int32_t>> array;
+  const StreamChar *strm = huge.data();
+  unsigned long N = huge.size();
+  CHECK(array.parse(strm, N) == ParseResult::UNFINISHED);
+
+  const std::vector<StreamChar> negative{0xFF, 0xFF, 0xFF, 0xFF};
+  array.reset();
+  strm = negative.data();
+  N = negative.size();
+  CHECK(array.parse(strm, N) == ParseResult::FAILED);
+
+  // Neither is the length of a list
+  const std::vector<StreamChar> list{0x09, 0x00, 0x00, 0x0A, 0x7F,
+                                     0xFF, 0xFF, 0xFF, 0x00};
+  BytesParser<Tag> parser;
+  strm = list.data();
+  N = list.size();
+  CHECK(parser.parse(strm, N) == ParseResult::UNFINISHED);
+}
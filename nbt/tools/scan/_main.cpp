@@ -0,0 +1,149 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// nbt-scan: parallel scanner of the files of a world.
+//
+// Usage: nbt-scan <world> [--threads <n>] [--aggregate <names>] [--top <n>]
+//                 [--json]
+//
+// Aggregations: blocks, entities, block-entities, status, data-version, all
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "scanner.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace minecraft::nbt::scan;
+
+/**
+ * @brief Write a string as a JSON string literal
+ */
+static void write_json_string(std::FILE *out, std::string_view str) {
+  std::fputc('"', out);
+  for (char c : str) {
+    if (c == '"' || c == '\\')
+      std::fprintf(out, "\\%c", c);
+    else if (static_cast<unsigned char>(c) < 0x20)
+      std::fprintf(out, "\\u%04x", c);
+    else
+      std::fputc(c, out);
+  }
+  std::fputc('"', out);
+}
+
+static void write_counts_json(std::FILE *out, const char *name,
+                              const Counts &counts, std::size_t top,
+                              bool &first) {
+  std::fprintf(out, "%s\n  \"%s\": {", first ? "" : ",", name);
+  first = false;
+  bool first_entry = true;
+  for (const auto &[key, n] : counts.top(top)) {
+    std::fprintf(out, "%s\n    ", first_entry ? "" : ",");
+    write_json_string(out, key);
+    std::fprintf(out, ": %llu", static_cast<unsigned long long>(n));
+    first_entry = false;
+  }
+  std::fprintf(out, "\n  }");
+}
+
+static void write_counts_table(std::FILE *out, const char *name,
+                               const Counts &counts, std::size_t top) {
+  std::fprintf(out, "\n%s (%zu distinct)\n", name, counts.size());
+  for (const auto &[key, n] : counts.top(top))
+    std::fprintf(out, "  %-48.*s %14llu\n", static_cast<int>(key.size()),
+                 key.data(), static_cast<unsigned long long>(n));
+}
+
+// ============================================================================
+int main(int argc, char **argv) {
+  // Parse arguments
+  const char *world = nullptr;
+  unsigned n_threads = 0;
+  uint8_t selection = ALL_AGGREGATIONS;
+  std::size_t top = 20;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (!std::strcmp(argv[i], "--threads") && has_value)
+      n_threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+    else if (!std::strcmp(argv[i], "--aggregate") && has_value)
+      selection = parse_aggregations(argv[++i]);
+    else if (!std::strcmp(argv[i], "--top") && has_value)
+      top = std::strtoul(argv[++i], nullptr, 10);
+    else if (!std::strcmp(argv[i], "--json"))
+      json = true;
+    else if (world == nullptr && argv[i][0] != '-')
+      world = argv[i];
+    else {
+      world = nullptr;
+      break;
+    }
+  }
+  if (world == nullptr || selection == 0) {
+    std::fprintf(stderr,
+                 "Usage: %s <world> [--threads <n>] [--aggregate <names>] "
+                 "[--top <n>] [--json]\n"
+                 "Aggregations (comma-separated): blocks, entities, "
+                 "block-entities, status, data-version, all\n",
+                 argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Scan
+  const auto files = find_files(world);
+  if (files.empty()) {
+    std::fprintf(stderr, "No region or .dat file found in %s\n", world);
+    return EXIT_FAILURE;
+  }
+  const auto r = scan(files, selection, n_threads);
+  const double mb_per_s = r.bytes / r.seconds / (1 << 20);
+  const double chunks_per_s = r.chunks / r.seconds;
+
+  // Report
+  const auto &a = r.aggregates;
+  const std::pair<const char *, const Counts *> aggregations[]{
+      {"blocks", selection & BLOCKS ? &a.blocks : nullptr},
+      {"entities", selection & ENTITIES ? &a.entities : nullptr},
+      {"block_entities", selection & BLOCK_ENTITIES ? &a.block_entities
+                                                    : nullptr},
+      {"items", selection & BLOCK_ENTITIES ? &a.items : nullptr},
+      {"status", selection & STATUS ? &a.status : nullptr},
+      {"data_versions", selection & DATA_VERSION ? &a.data_versions : nullptr},
+  };
+  if (json) {
+    std::printf("{\n  \"files\": %llu, \"chunks\": %llu, \"documents\": %llu,"
+                " \"bytes\": %llu, \"failures\": %llu,\n  \"seconds\": %.3f,"
+                " \"chunks_per_s\": %.1f, \"mb_per_s\": %.2f",
+                static_cast<unsigned long long>(r.files),
+                static_cast<unsigned long long>(r.chunks),
+                static_cast<unsigned long long>(r.documents),
+                static_cast<unsigned long long>(r.bytes),
+                static_cast<unsigned long long>(r.failures), r.seconds,
+                chunks_per_s, mb_per_s);
+    bool first = false;
+    for (const auto &[name, counts] : aggregations)
+      if (counts != nullptr)
+        write_counts_json(stdout, name, *counts, top, first);
+    std::printf("\n}\n");
+  } else {
+    std::printf("Scanned %llu files (%llu chunks, %llu documents, %.1f MB) in "
+                "%.2f s: %.0f chunks/s, %.1f MB/s, %llu failures\n",
+                static_cast<unsigned long long>(r.files),
+                static_cast<unsigned long long>(r.chunks),
+                static_cast<unsigned long long>(r.documents),
+                r.bytes / double(1 << 20), r.seconds, chunks_per_s, mb_per_s,
+                static_cast<unsigned long long>(r.failures));
+    for (const auto &[name, counts] : aggregations)
+      if (counts != nullptr)
+        write_counts_table(stdout, name, *counts, top);
+  }
+  return r.failures > 0 ? 2 : EXIT_SUCCESS;
+}
@@ -0,0 +1,242 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Aggregations computed by the world scanner implementation
+//
+// Only the chunk format of the 1.18+ versions (sections at the root of the
+// chunk) is aggregated for the blocks.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "aggregates.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string>
+
+namespace minecraft::nbt::scan {
+
+// Number of blocks in a chunk section
+static constexpr std::size_t SECTION_BLOCKS{16 * 16 * 16};
+
+static constexpr std::array<std::pair<std::string_view, Aggregation>, 6>
+    AGGREGATIONS_NAMES{{{"blocks", BLOCKS},
+                        {"entities", ENTITIES},
+                        {"block-entities", BLOCK_ENTITIES},
+                        {"status", STATUS},
+                        {"data-version", DATA_VERSION},
+                        {"all", ALL_AGGREGATIONS}}};
+
+uint8_t parse_aggregations(std::string_view names) {
+  uint8_t selection = 0;
+  while (!names.empty()) {
+    const auto comma = std::min(names.find(','), names.size());
+    const auto name = names.substr(0, comma);
+    const auto it = std::find_if(
+        AGGREGATIONS_NAMES.begin(), AGGREGATIONS_NAMES.end(),
+        [name](const auto &entry) { return entry.first == name; });
+    if (it == AGGREGATIONS_NAMES.end())
+      return 0;
+    selection |= it->second;
+    names.remove_prefix(std::min(comma + 1, names.size()));
+  }
+  return selection;
+}
+
+// ============================================================================
+// Counts
+// ============================================================================
+
+void Counts::add(std::string_view key, uint64_t n) {
+  if (auto it = find(key); it != end())
+    it->second += n;
+  else
+    emplace(key, n);
+}
+
+Counts &Counts::operator+=(const Counts &other) {
+  for (const auto &[key, n] : other)
+    add(key, n);
+  return *this;
+}
+
+std::vector<std::pair<std::string_view, uint64_t>>
+Counts::top(std::size_t n) const {
+  std::vector<std::pair<std::string_view, uint64_t>> out{begin(), end()};
+  std::sort(out.begin(), out.end(), [](const auto &a, const auto &b) {
+    return a.second != b.second ? a.second > b.second : a.first < b.first;
+  });
+  if (n > 0 && out.size() > n)
+    out.resize(n);
+  return out;
+}
+
+// ============================================================================
+// Tree accessors
+// ============================================================================
+
+/**
+ * @brief Get the value of type T under the key, nullptr if it is missing or
+ * of another type
+ */
+template <typename T>
+static const T *get(const Compound &compound, std::string_view key) {
+  const auto it = compound.find(key);
+  return it == compound.end() ? nullptr : it->second.as_ptr<T>();
+}
+
+/**
+ * @brief Call f on every compound of the list under the key
+ */
+template <typename F>
+static void for_each_compound(const Compound &compound, std::string_view key,
+                              F &&f) {
+  if (const auto *list = get<List>(compound, key))
+    for (const auto &elem : *list)
+      if (const auto *c = elem.as_ptr<Compound>())
+        f(*c);
+}
+
+/**
+ * @brief Count the blocks of a chunk section from its palette and its packed
+ * indices (entries do not span two longs)
+ */
+static void count_section(Counts &blocks, const Compound &section) {
+  const auto *states = get<Compound>(section, "block_states");
+  if (states == nullptr)
+    return;
+  const auto *palette = get<List>(*states, "palette");
+  if (palette == nullptr || palette->empty())
+    return;
+  std::vector<std::string_view> names;
+  names.reserve(palette->size());
+  for (const auto &entry : *palette) {
+    const auto *state = entry.as_ptr<Compound>();
+    const auto *name = state ? get<SmallString>(*state, "Name") : nullptr;
+    names.push_back(name ? std::string_view{*name} : "?");
+  }
+
+  // Single block: no indices
+  const auto *data = get<std::pmr::vector<int64_t>>(*states, "data");
+  if (names.size() == 1 || data == nullptr) {
+    blocks.add(names[0], SECTION_BLOCKS);
+    return;
+  }
+
+  const unsigned bits =
+      std::max(4u, static_cast<unsigned>(std::bit_width(names.size() - 1)));
+  const std::size_t per_long = 64 / bits;
+  if (data->size() * per_long < SECTION_BLOCKS)
+    return;
+  const uint64_t mask = (uint64_t{1} << bits) - 1;
+  std::vector<uint32_t> histogram(names.size(), 0);
+  for (std::size_t i = 0; i < SECTION_BLOCKS; i++) {
+    const auto word = static_cast<uint64_t>((*data)[i / per_long]);
+    const auto index = (word >> ((i % per_long) * bits)) & mask;
+    if (index < histogram.size())
+      histogram[index]++;
+  }
+  for (std::size_t i = 0; i < names.size(); i++)
+    if (histogram[i] > 0)
+      blocks.add(names[i], histogram[i]);
+}
+
+/**
+ * @brief Count an entity and its passengers
+ */
+static void count_entity(Counts &entities, const Compound &entity) {
+  const auto *id = get<SmallString>(entity, "id");
+  entities.add(id ? std::string_view{*id} : "?");
+  for_each_compound(entity, "Passengers", [&](const Compound &passenger) {
+    count_entity(entities, passenger);
+  });
+}
+
+/**
+ * @brief Count a block entity and the items it holds
+ */
+static void count_block_entity(Aggregates &out, const Compound &entity) {
+  const auto *id = get<SmallString>(entity, "id");
+  out.block_entities.add(id ? std::string_view{*id} : "?");
+  for_each_compound(entity, "Items", [&](const Compound &item) {
+    const auto *item_id = get<SmallString>(item, "id");
+    if (item_id == nullptr)
+      return;
+    // "count" since 1.20.5, "Count" before
+    uint64_t n = 1;
+    if (const auto *count = get<int32_t>(item, "count"))
+      n = static_cast<uint64_t>(std::max(*count, 0));
+    else if (const auto *old_count = get<int8_t>(item, "Count"))
+      n = static_cast<uint64_t>(std::max<int8_t>(*old_count, 0));
+    out.items.add(*item_id, n);
+  });
+}
+
+/**
+ * @brief Count the DataVersion of a chunk or document
+ */
+static void count_data_version(Counts &versions, const Compound &root) {
+  if (const auto *version = get<int32_t>(root, "DataVersion"))
+    versions.add(std::to_string(*version));
+  else
+    versions.add("none");
+}
+
+// ============================================================================
+// Aggregates
+// ============================================================================
+
+void Aggregates::add_chunk(const Compound &chunk) {
+  if (selection & BLOCKS)
+    for_each_compound(chunk, "sections", [this](const Compound &section) {
+      count_section(blocks, section);
+    });
+  if (selection & ENTITIES)
+    for_each_compound(chunk, "Entities", [this](const Compound &entity) {
+      count_entity(entities, entity);
+    });
+  if (selection & BLOCK_ENTITIES)
+    for_each_compound(chunk, "block_entities", [this](const Compound &entity) {
+      count_block_entity(*this, entity);
+    });
+  if (selection & STATUS) {
+    const auto *value = get<SmallString>(chunk, "Status");
+    status.add(value ? std::string_view{*value} : "?");
+  }
+  if (selection & DATA_VERSION)
+    count_data_version(data_versions, chunk);
+}
+
+void Aggregates::add_entities(const Compound &chunk) {
+  if (selection & ENTITIES)
+    for_each_compound(chunk, "Entities", [this](const Compound &entity) {
+      count_entity(entities, entity);
+    });
+  if (selection & DATA_VERSION)
+    count_data_version(data_versions, chunk);
+}
+
+void Aggregates::add_document(const Compound &root) {
+  if (!(selection & DATA_VERSION))
+    return;
+  // level.dat holds its data in a "Data" compound
+  const auto *data = get<Compound>(root, "Data");
+  count_data_version(data_versions, data ? *data : root);
+}
+
+Aggregates &Aggregates::operator+=(const Aggregates &other) {
+  blocks += other.blocks;
+  entities += other.entities;
+  block_entities += other.block_entities;
+  items += other.items;
+  status += other.status;
+  data_versions += other.data_versions;
+  return *this;
+}
+
+} // namespace minecraft::nbt::scan
@@ -0,0 +1,103 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Aggregations computed by the world scanner
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_SCAN_AGGREGATES_HPP
+#define SOLISMC_NBT_SCAN_AGGREGATES_HPP
+
+#include "minecraft/nbt/tag.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace minecraft::nbt::scan {
+
+/**
+ * @brief Aggregations that can be selected on the command line
+ */
+enum Aggregation : uint8_t {
+  BLOCKS = 1 << 0,         // Block states per block name
+  ENTITIES = 1 << 1,       // Entities per type
+  BLOCK_ENTITIES = 1 << 2, // Block entities per type & their items
+  STATUS = 1 << 3,         // Chunks per generation status
+  DATA_VERSION = 1 << 4,   // Chunks & documents per DataVersion
+  ALL_AGGREGATIONS = 0x1f,
+};
+
+/**
+ * @brief Parse a comma-separated list of aggregations names
+ *
+ * @return the selected aggregations, 0 if a name is unknown
+ */
+uint8_t parse_aggregations(std::string_view names);
+
+/**
+ * @brief Hash of strings usable with string views (no temporary keys)
+ */
+struct StringHash {
+  using is_transparent = void;
+  inline std::size_t operator()(std::string_view str) const {
+    return std::hash<std::string_view>{}(str);
+  }
+};
+
+/**
+ * @brief Occurrences per key
+ */
+struct Counts : std::unordered_map<std::string, uint64_t, StringHash,
+                                   std::equal_to<>> {
+  void add(std::string_view key, uint64_t n = 1);
+  Counts &operator+=(const Counts &other);
+
+  /**
+   * @brief Entries sorted by decreasing count, limited to the first n ones
+   * (all when n is 0)
+   */
+  std::vector<std::pair<std::string_view, uint64_t>> top(std::size_t n) const;
+};
+
+/**
+ * @brief Results of a scan (of a worker, or of the whole world once merged)
+ */
+struct Aggregates {
+  uint8_t selection = ALL_AGGREGATIONS;
+
+  Counts blocks;         // Block name -> number of blocks
+  Counts entities;       // Entity type -> number of entities
+  Counts block_entities; // Block entity type -> number of block entities
+  Counts items;          // Item -> number of items in the block entities
+  Counts status;         // Generation status -> number of chunks
+  Counts data_versions;  // DataVersion -> number of chunks & documents
+
+  /**
+   * @brief Aggregate a chunk of a region file
+   */
+  void add_chunk(const Compound &chunk);
+
+  /**
+   * @brief Aggregate a chunk of an entities region file
+   */
+  void add_entities(const Compound &chunk);
+
+  /**
+   * @brief Aggregate a standalone document (.dat)
+   */
+  void add_document(const Compound &root);
+
+  Aggregates &operator+=(const Aggregates &other);
+};
+
+} // namespace minecraft::nbt::scan
+
+#endif
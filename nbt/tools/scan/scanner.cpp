@@ -0,0 +1,179 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Parallel scanner of the files of a world implementation
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "scanner.hpp"
+#include "minecraft/nbt/reader.hpp"
+#include "minecraft/nbt/region.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+
+namespace minecraft::nbt::scan {
+
+namespace fs = std::filesystem;
+
+// Initial size of the per-worker arena (most chunks fit in it)
+static constexpr std::size_t ARENA_SIZE{4 << 20};
+
+std::vector<ScanFile> find_files(const fs::path &world) {
+  std::vector<ScanFile> files;
+  std::error_code error;
+  for (fs::recursive_directory_iterator it{
+           world, fs::directory_options::skip_permission_denied, error},
+       end;
+       it != end; it.increment(error)) {
+    if (error || !it->is_regular_file(error))
+      continue;
+    const auto &path = it->path();
+    const auto extension = path.extension();
+    const auto dir = path.parent_path().filename();
+    FileKind kind;
+    if (extension == ".mca")
+      kind = dir == "entities" ? FileKind::ENTITIES
+             : dir == "poi"    ? FileKind::POI
+                               : FileKind::CHUNKS;
+    else if (extension == ".dat")
+      kind = FileKind::DOCUMENT;
+    else
+      continue;
+    files.push_back({path, kind, static_cast<std::size_t>(it->file_size())});
+  }
+  std::sort(files.begin(), files.end(),
+            [](const auto &a, const auto &b) { return a.size > b.size; });
+  return files;
+}
+
+// ============================================================================
+// Workers
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief State of a worker, reused for every file it scans
+ */
+struct Worker {
+  ScanResult result;
+  std::vector<std::byte> arena_buffer;
+  std::pmr::monotonic_buffer_resource arena;
+  Reader reader;
+  std::vector<StreamChar> buffer;
+
+  explicit Worker(uint8_t selection)
+      : arena_buffer(ARENA_SIZE),
+        arena(arena_buffer.data(), arena_buffer.size()), reader(&arena) {
+    result.aggregates.selection = selection;
+  }
+
+  void scan_region(const ScanFile &file) {
+    auto region = RegionFile::open(file.path);
+    if (!region) {
+      result.failures++;
+      return;
+    }
+    for (std::size_t i = 0; i < REGION_CHUNKS; i++) {
+      if (!region->contains(i))
+        continue;
+      result.chunks++;
+      {
+        const auto root = region->parse_chunk(i, reader, buffer);
+        const auto *chunk = root ? root->as_ptr<Compound>() : nullptr;
+        if (chunk == nullptr)
+          result.failures++;
+        else if (file.kind == FileKind::CHUNKS)
+          result.aggregates.add_chunk(*chunk);
+        else if (file.kind == FileKind::ENTITIES)
+          result.aggregates.add_entities(*chunk);
+      }
+      // The tree is dropped, with the reader's state: rewind the arena
+      reader.reset();
+      arena.release();
+    }
+  }
+
+  void scan_document(const ScanFile &file) {
+    std::ifstream in{file.path, std::ios::binary};
+    buffer.resize(file.size);
+    in.read(reinterpret_cast<char *>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size()));
+    result.documents++;
+    {
+      reader.reset();
+      const StreamChar *strm = buffer.data();
+      unsigned long N = in ? buffer.size() : 0;
+      const Tag *root = N > 0 && reader.parse(strm, N) == ParseResult::SUCCESS
+                            ? reader.get()
+                            : nullptr;
+      const auto *compound = root ? root->as_ptr<Compound>() : nullptr;
+      if (compound == nullptr)
+        result.failures++;
+      else
+        result.aggregates.add_document(*compound);
+      reader.reset();
+    }
+    arena.release();
+  }
+
+  void scan(const ScanFile &file) {
+    result.files++;
+    result.bytes += file.size;
+    if (file.kind == FileKind::DOCUMENT)
+      scan_document(file);
+    else
+      scan_region(file);
+  }
+};
+
+} // namespace
+
+ScanResult scan(const std::vector<ScanFile> &files, uint8_t selection,
+                unsigned n_threads) {
+  const auto start = std::chrono::steady_clock::now();
+  if (n_threads == 0)
+    n_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+  ScanResult total;
+  total.aggregates.selection = selection;
+  std::mutex mutex;
+  std::atomic<std::size_t> next{0};
+  const auto work = [&]() {
+    Worker worker{selection};
+    for (auto i = next++; i < files.size(); i = next++)
+      worker.scan(files[i]);
+
+    // Merge the results of the worker
+    const auto &r = worker.result;
+    std::lock_guard lock{mutex};
+    total.aggregates += r.aggregates;
+    total.files += r.files;
+    total.chunks += r.chunks;
+    total.documents += r.documents;
+    total.bytes += r.bytes;
+    total.failures += r.failures;
+  };
+  {
+    std::vector<std::jthread> workers;
+    for (unsigned i = 0; i < n_threads; i++)
+      workers.emplace_back(work);
+  }
+
+  total.seconds = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+  return total;
+}
+
+} // namespace minecraft::nbt::scan
@@ -0,0 +1,73 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// Parallel scanner of the files of a world
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+#ifndef SOLISMC_NBT_SCAN_SCANNER_HPP
+#define SOLISMC_NBT_SCAN_SCANNER_HPP
+
+#include "aggregates.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace minecraft::nbt::scan {
+
+/**
+ * @brief Kind of a file of the world
+ */
+enum class FileKind : uint8_t {
+  CHUNKS,   // region/*.mca
+  ENTITIES, // entities/*.mca
+  POI,      // poi/*.mca
+  DOCUMENT, // *.dat
+};
+
+/**
+ * @brief A file to scan
+ */
+struct ScanFile {
+  std::filesystem::path path;
+  FileKind kind;
+  std::size_t size;
+};
+
+/**
+ * @brief Find the files of a world (every dimension included)
+ *
+ * @return the files, largest first so that the workers finish together
+ */
+std::vector<ScanFile> find_files(const std::filesystem::path &world);
+
+/**
+ * @brief Summary of a scan
+ */
+struct ScanResult {
+  Aggregates aggregates;
+  uint64_t files = 0;
+  uint64_t chunks = 0;   // Chunks of every kind (region, entities, POI)
+  uint64_t documents = 0;
+  uint64_t bytes = 0;    // Bytes of the scanned files
+  uint64_t failures = 0; // Chunks & documents that couldn't be parsed
+  double seconds = 0;
+};
+
+/**
+ * @brief Scan the files on n_threads threads (one per core if 0)
+ *
+ * The chunks are parsed one at a time by each worker, in an arena released
+ * after each chunk, so that the memory used is bounded by the largest chunk.
+ */
+ScanResult scan(const std::vector<ScanFile> &files, uint8_t selection,
+                unsigned n_threads);
+
+} // namespace minecraft::nbt::scan
+
+#endif
@@ -0,0 +1,155 @@
+// ============================================================================
+// Project: SOLISMC-FILEIO
+//
+// nbt-transcode: rewrite the regions of a world in another chunk compression.
+//
+// Usage: nbt-transcode <world | region.mca> [--compression <name>]
+//                      [--level <n>] [--threads <n>]
+//
+// Compressions: gzip, zlib (default), none, lz4
+//
+// The regions are rewritten in place, each one being renamed over the
+// original once complete.
+//
+// Author    Meltwin (github@meltwin.fr)
+// Date      19/10/2026 (created 19/10/2026)
+// Version   1.0.0
+// Copyright Solis Forge | 2026
+//           Distributed under MIT License (https://opensource.org/licenses/MIT)
+// ============================================================================
+
+#include "minecraft/nbt/region.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace minecraft::nbt;
+namespace fs = std::filesystem;
+
+static std::optional<ChunkCompression> parse_compression(const char *name) {
+  const std::pair<const char *, ChunkCompression> names[]{
+      {"gzip", ChunkCompression::GZIP},
+      {"zlib", ChunkCompression::ZLIB},
+      {"none", ChunkCompression::NONE},
+      {"lz4", ChunkCompression::LZ4},
+  };
+  for (const auto &[key, compression] : names)
+    if (!std::strcmp(name, key))
+      return compression;
+  return std::nullopt;
+}
+
+/**
+ * @brief Find the region files of a world (every dimension & kind of region
+ * included), largest first so that the workers finish together
+ */
+static std::vector<fs::path> find_regions(const fs::path &world) {
+  std::vector<fs::path> files;
+  if (fs::is_regular_file(world))
+    files.push_back(world);
+  else {
+    std::error_code error;
+    for (fs::recursive_directory_iterator it{world, error}, end;
+         !error && it != end; it.increment(error))
+      if (it->is_regular_file() && it->path().extension() == ".mca")
+        files.push_back(it->path());
+  }
+  std::sort(files.begin(), files.end(), [](const auto &a, const auto &b) {
+    return fs::file_size(a) > fs::file_size(b);
+  });
+  return files;
+}
+
+// ============================================================================
+int main(int argc, char **argv) {
+  // Parse arguments
+  const char *world = nullptr;
+  std::optional<ChunkCompression> compression = ChunkCompression::ZLIB;
+  int level = 6;
+  unsigned n_threads = 0;
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (!std::strcmp(argv[i], "--compression") && has_value)
+      compression = parse_compression(argv[++i]);
+    else if (!std::strcmp(argv[i], "--level") && has_value)
+      level = std::atoi(argv[++i]);
+    else if (!std::strcmp(argv[i], "--threads") && has_value)
+      n_threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+    else if (world == nullptr && argv[i][0] != '-')
+      world = argv[i];
+    else {
+      world = nullptr;
+      break;
+    }
+  }
+  if (world == nullptr || !compression) {
+    std::fprintf(stderr,
+                 "Usage: %s <world | region.mca> [--compression <name>] "
+                 "[--level <n>] [--threads <n>]\n"
+                 "Compressions: gzip, zlib (default), none, lz4\n",
+                 argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const auto files = find_regions(world);
+  if (files.empty()) {
+    std::fprintf(stderr, "No region file found in %s\n", world);
+    return EXIT_FAILURE;
+  }
+  if (n_threads == 0)
+    n_threads = std::max(1u, std::thread::hardware_concurrency());
+  n_threads = std::min<unsigned>(n_threads, files.size());
+
+  // Transcode, one region at a time per worker
+  const auto start = std::chrono::steady_clock::now();
+  std::atomic<std::size_t> next{0};
+  std::mutex mutex;
+  SaveStats total;
+  uint64_t bytes_before = 0, bytes_after = 0, failures = 0;
+  const auto work = [&]() {
+    for (std::size_t i; (i = next++) < files.size();) {
+      const auto before = fs::file_size(files[i]);
+      const auto stats =
+          transcode_region(files[i], files[i], *compression, level);
+      std::lock_guard lock{mutex};
+      if (!stats) {
+        std::fprintf(stderr, "Failed to transcode %s\n",
+                     files[i].string().c_str());
+        failures++;
+        continue;
+      }
+      total.copied += stats->copied;
+      total.recompressed += stats->recompressed;
+      bytes_before += before;
+      bytes_after += fs::file_size(files[i]);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (unsigned i = 1; i < n_threads; i++)
+    workers.emplace_back(work);
+  work();
+  for (auto &worker : workers)
+    worker.join();
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+  // Report
+  std::printf("Transcoded %zu regions (%zu chunks recompressed, %zu already "
+              "in the compression) in %.2f s: %.1f MB -> %.1f MB, "
+              "%llu failures\n",
+              files.size() - failures, total.recompressed, total.copied,
+              seconds, bytes_before / double(1 << 20),
+              bytes_after / double(1 << 20),
+              static_cast<unsigned long long>(failures));
+  return failures > 0 ? 2 : EXIT_SUCCESS;
+}